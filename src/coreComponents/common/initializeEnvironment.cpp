@@ -115,6 +115,26 @@ void setupMPI( int argc, char * argv[] )
   MPI_COMM_GEOSX = MpiWrapper::commDup( MPI_COMM_WORLD );
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void setupTimeSlices( integer const numTimeSlices )
+{
+  int const worldSize = MpiWrapper::commSize( MPI_COMM_GEOSX );
+  GEOSX_THROW_IF( numTimeSlices < 1 || worldSize % numTimeSlices != 0,
+                  "The number of MPI ranks (" << worldSize << ") must be a multiple of the number of time slices (" << numTimeSlices << ")",
+                  InputError );
+  if( numTimeSlices == 1 )
+  {
+    return;
+  }
+
+  int const rank = MpiWrapper::commRank( MPI_COMM_GEOSX );
+  int const sliceSize = worldSize / numTimeSlices;
+
+  MPI_Comm const sliceComm = MpiWrapper::commSplit( MPI_COMM_GEOSX, rank / sliceSize, rank );
+  MpiWrapper::commFree( MPI_COMM_GEOSX );
+  MPI_COMM_GEOSX = sliceComm;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 void finalizeMPI()
 {
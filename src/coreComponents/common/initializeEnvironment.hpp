@@ -82,6 +82,9 @@ struct CommandLineOptions
 
   /// Suppress logging of host-device data migration.
   integer suppressMoveLogging = false;
+
+  /// The number of time slices used by the parallel-in-time driver.
+  integer numTimeSlices = 1;
 };
 
 /**
@@ -122,6 +125,14 @@ void setupOpenMP();
  */
 void setupMPI( int argc, char * argv[] );
 
+/**
+ * @brief Split MPI_COMM_GEOSX into contiguous blocks of ranks, one per time slice.
+ * @param [in] numTimeSlices the number of time slices.
+ * @details Each block owns a window of the time horizon in the parallel-in-time driver
+ *          of the EventManager. Point-to-point transfers between slices go through MPI_COMM_WORLD.
+ */
+void setupTimeSlices( integer const numTimeSlices );
+
 /**
  * @brief Finalize MPI.
  */
@@ -57,6 +57,9 @@ public:
 
   virtual string getCatalogName() const override { return catalogName(); }
 
+  virtual bool isStateDependent() const override
+  { return false; }
+
   /// Type of kernel wrapper for in-kernel update
   using KernelWrapper = ConstantPermeabilityUpdate;
 
@@ -121,6 +121,14 @@ public:
   virtual void initializeState() const
   {}
 
+  /**
+   * @brief Check whether the permeability may change during the simulation.
+   * @return true if the permeability is updated from the state (pressure, porosity, aperture...),
+   *         false if it keeps its initial value, in which case the transmissibilities can be cached
+   */
+  virtual bool isStateDependent() const
+  { return true; }
+
 protected:
 
   array3d< real64 > m_permeability;
@@ -17,10 +17,13 @@
  */
 
 #include "EventBase.hpp"
+#include <algorithm>
 #include <cstring>
 
 #include "common/DataTypes.hpp"
 #include "common/TimingMacros.hpp"
+#include "fileIO/Outputs/OutputBase.hpp"
+#include "fileIO/timeHistory/TimeHistoryCollection.hpp"
 
 namespace geosx
 {
@@ -48,7 +51,8 @@ EventBase::EventBase( const string & name,
   m_timeStepEventCount( 0 ),
   m_eventProgress( 0 ),
   m_currentEventDtRequest( 0.0 ),
-  m_target( nullptr )
+  m_target( nullptr ),
+  m_skipTarget( false )
 {
   setInputFlags( InputFlags::OPTIONAL_NONUNIQUE );
 
@@ -193,7 +197,7 @@ void EventBase::signalToPrepareForExecution( real64 const time,
                                              integer const cycle,
                                              DomainPartition & domain )
 {
-  if( m_target != nullptr )
+  if( m_target != nullptr && !m_skipTarget )
   {
     m_target->signalToPrepareForExecution( time, dt, cycle, domain );
   }
@@ -219,7 +223,7 @@ bool EventBase::execute( real64 const time_n,
 
   // If m_targetExecFlag is set, then the code has resumed at a point
   // after the target has executed.
-  if((m_target != nullptr) && (m_targetExecFlag == 0))
+  if((m_target != nullptr) && (m_targetExecFlag == 0) && !m_skipTarget)
   {
     m_targetExecFlag = 1;
     earlyReturn = earlyReturn ||
@@ -316,6 +320,34 @@ real64 EventBase::getTimestepRequest( real64 const time )
 }
 
 
+void EventBase::setOutputTargetsEnabled( bool const enabled )
+{
+  // The time history collections buffer the rows written by their outputs, so that they are disabled with them
+  m_skipTarget = !enabled && ( dynamic_cast< OutputBase * >( m_target ) != nullptr ||
+                               dynamic_cast< HistoryCollection * >( m_target ) != nullptr );
+
+  this->forSubGroups< EventBase >( [&]( EventBase & subEvent )
+  {
+    subEvent.setOutputTargetsEnabled( enabled );
+  } );
+}
+
+
+void EventBase::getOutputTargets( std::vector< OutputBase * > & outputs ) const
+{
+  OutputBase * const output = dynamic_cast< OutputBase * >( m_target );
+  if( output != nullptr && std::find( outputs.begin(), outputs.end(), output ) == outputs.end() )
+  {
+    outputs.emplace_back( output );
+  }
+
+  this->forSubGroups< EventBase >( [&]( EventBase const & subEvent )
+  {
+    subEvent.getOutputTargets( outputs );
+  } );
+}
+
+
 integer EventBase::getExitFlag()
 {
   this->forSubGroups< EventBase >( [&]( EventBase & subEvent )
@@ -22,10 +22,14 @@
 #include "dataRepository/Group.hpp"
 #include "dataRepository/ExecutableGroup.hpp"
 
+#include <vector>
+
 
 namespace geosx
 {
 
+class OutputBase;
+
 /**
  * @class EventBase
  * A base class for managing code event targets (solver applications, etc.)
@@ -177,6 +181,19 @@ public:
    */
   void setProgressIndicator( array1d< integer > & eventCounters );
 
+  /**
+   * @brief Enable or disable the targets of the event/sub-events that are outputs or time history collections.
+   * @param enabled if false, these targets are neither signaled nor executed,
+   *                while the event timing is still updated as if they had been
+   */
+  void setOutputTargetsEnabled( bool const enabled );
+
+  /**
+   * @brief Collect the targets of the event/sub-events that are outputs.
+   * @param outputs The output targets in the execution order, each one listed once even if targeted by several events
+   */
+  void getOutputTargets( std::vector< OutputBase * > & outputs ) const;
+
   /// @cond DO_NOT_DOCUMENT
   struct viewKeyStruct
   {
@@ -331,6 +348,9 @@ private:
 
   /// A pointer to the optional event target
   ExecutableGroup * m_target;
+
+  /// Flag to skip the target, set when the target is a disabled output
+  bool m_skipTarget;
 };
 
 } /* namespace geosx */
@@ -18,8 +18,11 @@
 
 #include "EventManager.hpp"
 
+#include "common/MpiWrapper.hpp"
 #include "common/TimingMacros.hpp"
 #include "events/EventBase.hpp"
+#include "fileIO/Outputs/OutputBase.hpp"
+#include "mesh/DomainPartition.hpp"
 #include "mesh/mpiCommunications/CommunicationTools.hpp"
 
 namespace geosx
@@ -36,7 +39,10 @@ EventManager::EventManager( string const & name,
   m_time(),
   m_dt(),
   m_cycle(),
-  m_currentSubEvent()
+  m_currentSubEvent(),
+  m_pararealCoarseningFactor(),
+  m_pararealMaxIterations(),
+  m_pararealTolerance()
 {
   setInputFlags( InputFlags::REQUIRED );
 
@@ -69,6 +75,23 @@ EventManager::EventManager( string const & name,
     setRestartFlags( RestartFlags::WRITE_AND_READ ).
     setDescription( "Index of the current subevent." );
 
+  registerWrapper( viewKeyStruct::pararealCoarseningFactorString(), &m_pararealCoarseningFactor ).
+    setApplyDefaultValue( 10.0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Ratio between the timesteps of the coarse and fine propagators of the Parareal driver. "
+                    "Only used when the run is split in several time slices (time-slices command line option)." );
+
+  registerWrapper( viewKeyStruct::pararealMaxIterationsString(), &m_pararealMaxIterations ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Maximum number of Parareal iterations. "
+                    "If 0, the number of time slices is used, for which Parareal reproduces the sequential solution." );
+
+  registerWrapper( viewKeyStruct::pararealToleranceString(), &m_pararealTolerance ).
+    setApplyDefaultValue( 1e-6 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Relative tolerance on the change of the mesh fields at the window ends between two Parareal iterations." );
+
 }
 
 
@@ -85,6 +108,20 @@ Group * EventManager::createChild( string const & childKey, string const & child
 }
 
 
+void EventManager::postProcessInput()
+{
+  GEOSX_THROW_IF_LT_MSG( m_pararealCoarseningFactor, 1.0,
+                         getName() << ": " << viewKeyStruct::pararealCoarseningFactorString() << " must be >= 1",
+                         InputError );
+  GEOSX_THROW_IF_LT_MSG( m_pararealMaxIterations, 0,
+                         getName() << ": " << viewKeyStruct::pararealMaxIterationsString() << " must be >= 0",
+                         InputError );
+  GEOSX_THROW_IF_LE_MSG( m_pararealTolerance, 0.0,
+                         getName() << ": " << viewKeyStruct::pararealToleranceString() << " must be > 0",
+                         InputError );
+}
+
+
 void EventManager::expandObjectCatalogs()
 {
   // During schema generation, register one of each type derived from EventBase here
@@ -95,6 +132,181 @@ void EventManager::expandObjectCatalogs()
 }
 
 
+namespace
+{
+
+/**
+ * @brief Get the number of time slices and the index of the time slice of this rank.
+ * @param[out] numSlices the number of time slices
+ * @param[out] slice the index of the local time slice
+ * @param[out] sliceSize the number of ranks in a time slice
+ */
+void getTimeSlices( int & numSlices, int & slice, int & sliceSize )
+{
+  sliceSize = MpiWrapper::commSize( MPI_COMM_GEOSX );
+  numSlices = MpiWrapper::commSize( MPI_COMM_WORLD ) / sliceSize;
+  slice = MpiWrapper::commRank( MPI_COMM_WORLD ) / sliceSize;
+}
+
+/**
+ * @brief Copy the restart representation of a group into a compact conduit node.
+ * @param[in] root the group to snapshot
+ * @param[out] state the snapshot
+ */
+void snapshotState( Group & root, conduit::Node & state )
+{
+  root.prepareToWrite();
+  state.reset();
+  root.getConduitNode().compact_to( state );
+  root.finishWriting();
+}
+
+/**
+ * @brief Overwrite the data of a group with a snapshot, as a restart would.
+ * @param[inout] root the group to restore
+ * @param[in] state the snapshot
+ */
+void restoreState( Group & root, conduit::Node const & state )
+{
+  root.getConduitNode().update( state );
+  root.loadFromConduit();
+  root.postRestartInitializationRecursive();
+}
+
+/**
+ * @brief Get the path of a group relative to one of its ancestors, as used in the snapshots of the ancestor.
+ * @param[in] group the group
+ * @param[in] root the ancestor
+ * @return the path of the group in the snapshots of @p root
+ */
+string snapshotPath( Group const & group, Group const & root )
+{
+  string path = group.getName();
+  for( Group const * parent = &group.getParent(); parent != &root; parent = &parent->getParent() )
+  {
+    path = parent->getName() + "/" + path;
+  }
+  return path;
+}
+
+/**
+ * @brief Apply the Parareal correction U = F + G_new - G_old on the floating point leaves of a snapshot.
+ * @param[inout] state the fine snapshot F on input, the corrected snapshot on output
+ * @param[in] coarseNew the coarse snapshot from the updated window start
+ * @param[in] coarseOld the coarse snapshot from the previous window start
+ * @details Only called on the mesh fields: the other leaves (time, dt, cycle, event and solver data, ...)
+ *          are taken from the fine snapshot.
+ */
+void correctState( conduit::Node & state,
+                   conduit::Node const & coarseNew,
+                   conduit::Node const & coarseOld )
+{
+  if( state.dtype().is_float64() )
+  {
+    conduit::float64_array u = state.as_float64_array();
+    conduit::float64_array const gNew = coarseNew.as_float64_array();
+    conduit::float64_array const gOld = coarseOld.as_float64_array();
+    GEOSX_ERROR_IF( gNew.number_of_elements() != u.number_of_elements() ||
+                    gOld.number_of_elements() != u.number_of_elements(),
+                    "Parareal: the coarse and fine states have different sizes at " << state.path() );
+    for( conduit::index_t i = 0; i < u.number_of_elements(); ++i )
+    {
+      u[i] += gNew[i] - gOld[i];
+    }
+    return;
+  }
+
+  for( conduit::index_t i = 0; i < state.number_of_children(); ++i )
+  {
+    conduit::Node & child = state.child( i );
+    correctState( child, coarseNew[ child.name() ], coarseOld[ child.name() ] );
+  }
+}
+
+/**
+ * @brief Accumulate the squared norms of the difference between two snapshots and of the reference snapshot.
+ * @param[in] state the new snapshot
+ * @param[in] reference the reference snapshot
+ * @param[inout] diffNorm the squared norm of the difference of the floating point leaves
+ * @param[inout] refNorm the squared norm of the floating point leaves of the reference
+ */
+void accumulateStateDifference( conduit::Node const & state,
+                                conduit::Node const & reference,
+                                real64 & diffNorm,
+                                real64 & refNorm )
+{
+  if( state.dtype().is_float64() )
+  {
+    conduit::float64_array const u = state.as_float64_array();
+    conduit::float64_array const v = reference.as_float64_array();
+    for( conduit::index_t i = 0; i < u.number_of_elements(); ++i )
+    {
+      diffNorm += ( u[i] - v[i] ) * ( u[i] - v[i] );
+      refNorm += v[i] * v[i];
+    }
+    return;
+  }
+
+  for( conduit::index_t i = 0; i < state.number_of_children(); ++i )
+  {
+    conduit::Node const & child = state.child( i );
+    accumulateStateDifference( child, reference[ child.name() ], diffNorm, refNorm );
+  }
+}
+
+/// Tag of the messages exchanged between time slices
+constexpr int pararealTag = 7300;
+
+/**
+ * @brief Send a snapshot to the same rank of another time slice.
+ * @param[in] state the snapshot
+ * @param[in] dest the destination rank in MPI_COMM_WORLD
+ */
+void sendState( conduit::Node const & state, int const dest )
+{
+#ifdef GEOSX_USE_MPI
+  conduit::Node compact;
+  state.compact_to( compact );
+  string const schema = compact.schema().to_json();
+  std::vector< conduit::uint8 > data;
+  compact.serialize( data );
+
+  GEOSX_ERROR_IF_GT_MSG( data.size(), static_cast< std::size_t >( std::numeric_limits< int >::max() ),
+                         "Parareal: the state is too large to be sent in a single message" );
+  int sizes[2] = { static_cast< int >( schema.size() ), static_cast< int >( data.size() ) };
+  MPI_Send( sizes, 2, MPI_INT, dest, pararealTag, MPI_COMM_WORLD );
+  MPI_Send( schema.data(), sizes[0], MPI_CHAR, dest, pararealTag, MPI_COMM_WORLD );
+  MPI_Send( data.data(), sizes[1], MPI_BYTE, dest, pararealTag, MPI_COMM_WORLD );
+#else
+  GEOSX_UNUSED_VAR( state, dest );
+#endif
+}
+
+/**
+ * @brief Receive a snapshot from the same rank of another time slice.
+ * @param[out] state the snapshot
+ * @param[in] source the source rank in MPI_COMM_WORLD
+ */
+void receiveState( conduit::Node & state, int const source )
+{
+#ifdef GEOSX_USE_MPI
+  int sizes[2];
+  MPI_Recv( sizes, 2, MPI_INT, source, pararealTag, MPI_COMM_WORLD, MPI_STATUS_IGNORE );
+  string schema( sizes[0], ' ' );
+  std::vector< conduit::uint8 > data( sizes[1] );
+  MPI_Recv( &schema[0], sizes[0], MPI_CHAR, source, pararealTag, MPI_COMM_WORLD, MPI_STATUS_IGNORE );
+  MPI_Recv( data.data(), sizes[1], MPI_BYTE, source, pararealTag, MPI_COMM_WORLD, MPI_STATUS_IGNORE );
+
+  state.reset();
+  state.set_data_using_schema( conduit::Schema( schema ), data.data() );
+#else
+  GEOSX_UNUSED_VAR( state, source );
+#endif
+}
+
+}
+
+
 bool EventManager::run( DomainPartition & domain )
 {
   GEOSX_MARK_FUNCTION;
@@ -115,28 +327,83 @@ bool EventManager::run( DomainPartition & domain )
     subEvent.setProgressIndicator( eventCounters );
   } );
 
-  // Inform user if it appears this is a mid-loop restart
-  if((m_currentSubEvent > 0))
+  int numSlices, slice, sliceSize;
+  getTimeSlices( numSlices, slice, sliceSize );
+  if( numSlices > 1 )
+  {
+    runParareal( domain );
+  }
+  else
+  {
+    // Inform user if it appears this is a mid-loop restart
+    if((m_currentSubEvent > 0))
+    {
+      GEOSX_LOG_RANK_0( "Resuming from step " << m_currentSubEvent << " of the event loop." );
+    }
+
+    // Run problem
+    // Note: if currentSubEvent > 0, then we are resuming from a restart file
+    if( advance( m_maxTime, 1.0, true, exitFlag, domain ) )
+    {
+      return true;
+    }
+  }
+
+  // Cleanup
+  GEOSX_LOG_RANK_0( "Cleaning up events" );
+
+  this->forSubGroups< EventBase >( [&]( EventBase & subEvent )
+  {
+    subEvent.cleanup( m_time, m_cycle, 0, 0, domain );
+  } );
+
+  if( numSlices > 1 )
   {
-    GEOSX_LOG_RANK_0( "Resuming from step " << m_currentSubEvent << " of the event loop." );
+    // Each time slice wrote its outputs in its own directory, see OutputBase::setTimeSlice
+    std::vector< OutputBase * > outputs;
+    this->forSubGroups< EventBase >( [&]( EventBase const & subEvent )
+    {
+      subEvent.getOutputTargets( outputs );
+    } );
+    MpiWrapper::barrier( MPI_COMM_WORLD );
+    for( OutputBase * const output : outputs )
+    {
+      output->mergeTimeSlices( numSlices );
+    }
   }
 
-  // Run problem
-  // Note: if currentSubEvent > 0, then we are resuming from a restart file
-  while((m_time < m_maxTime) && (m_cycle < m_maxCycle) && (exitFlag == 0))
+  return false;
+}
+
+
+bool EventManager::advance( real64 const endTime,
+                            real64 const dtScale,
+                            bool const executeOutputs,
+                            integer & exitFlag,
+                            DomainPartition & domain )
+{
+  // Outputs are skipped in the intermediate propagations of the Parareal driver, at any depth of the event tree
+  this->forSubGroups< EventBase >( [&]( EventBase & subEvent )
+  {
+    subEvent.setOutputTargetsEnabled( executeOutputs );
+  } );
+
+  while((m_time < endTime) && (m_cycle < m_maxCycle) && (exitFlag == 0))
   {
     // Determine the cycle timestep
     if( m_currentSubEvent == 0 )
     {
       // The max dt request
-      m_dt = m_maxTime - m_time;
+      m_dt = endTime - m_time;
 
       // Determine the dt requests for each event
+      real64 dtRequest = m_dt;
       for(; m_currentSubEvent<this->numSubGroups(); ++m_currentSubEvent )
       {
         EventBase * subEvent = static_cast< EventBase * >( this->getSubGroups()[m_currentSubEvent] );
-        m_dt = std::min( subEvent->getTimestepRequest( m_time ), m_dt );
+        dtRequest = std::min( subEvent->getTimestepRequest( m_time ), dtRequest );
       }
+      m_dt = std::min( dtScale * dtRequest, m_dt );
       m_currentSubEvent = 0;
 
 #ifdef GEOSX_USE_MPI
@@ -147,7 +414,8 @@ bool EventManager::run( DomainPartition & domain )
 #endif
     }
 
-    GEOSX_LOG_RANK_0( "Time: " << m_time << "s, dt:" << m_dt << "s, Cycle: " << m_cycle );
+    GEOSX_LOG_RANK_0_IF( executeOutputs || this->getLogLevel() >= 1,
+                         "Time: " << m_time << "s, dt:" << m_dt << "s, Cycle: " << m_cycle );
 
     // Execute
     for(; m_currentSubEvent<this->numSubGroups(); ++m_currentSubEvent )
@@ -186,20 +454,135 @@ bool EventManager::run( DomainPartition & domain )
     }
 
     // Increment time/cycle, reset the subevent counter
-    m_time += m_dt;
+    // Note: the end time is hit exactly so that consecutive windows of the Parareal driver line up
+    m_time = ( m_dt < endTime - m_time ) ? m_time + m_dt : endTime;
     ++m_cycle;
     m_currentSubEvent = 0;
   }
 
-  // Cleanup
-  GEOSX_LOG_RANK_0( "Cleaning up events" );
+  return false;
+}
 
-  this->forSubGroups< EventBase >( [&]( EventBase & subEvent )
+
+void EventManager::runParareal( DomainPartition & domain )
+{
+  GEOSX_MARK_FUNCTION;
+
+  int numSlices, slice, sliceSize;
+  getTimeSlices( numSlices, slice, sliceSize );
+
+  GEOSX_THROW_IF( m_currentSubEvent > 0,
+                  "Parareal: cannot resume from a restart file written in the middle of a cycle",
+                  InputError );
+  GEOSX_THROW_IF( m_maxTime >= std::numeric_limits< real64 >::max(),
+                  "Parareal: " << viewKeyStruct::maxTimeString() << " must be set to split the run in time slices",
+                  InputError );
+
+  Group & problemManager = this->getParent();
+
+  // The Parareal correction only applies to the mesh fields
+  string const meshPath = snapshotPath( domain.getMeshBodies(), problemManager );
+
+  // Window [windowStart, windowEnd] of this slice
+  real64 const startTime = m_time;
+  real64 const windowLength = ( m_maxTime - startTime ) / numSlices;
+  real64 const windowStart = startTime + slice * windowLength;
+  real64 const windowEnd = ( slice == numSlices - 1 ) ? m_maxTime : windowStart + windowLength;
+
+  // Same rank in the previous/next time slices
+  int const worldRank = MpiWrapper::commRank( MPI_COMM_WORLD );
+  int const prevRank = worldRank - sliceSize;
+  int const nextRank = worldRank + sliceSize;
+  bool const isFirstSlice = ( slice == 0 );
+  bool const isLastSlice = ( slice == numSlices - 1 );
+
+  // The Parareal messages are printed once for all the time slices, whatever the communicator of the logger
+  bool const isLogRank = ( worldRank == 0 );
+
+  integer const maxIterations = ( m_pararealMaxIterations > 0 ) ? std::min( m_pararealMaxIterations, numSlices ) : numSlices;
+
+  GEOSX_LOG_RANK_0_IF( isLogRank, "Parareal: " << numSlices << " time slices of " << sliceSize << " rank(s), window length " << windowLength << "s" );
+
+  // Run a propagator over the window of this slice, from a given window start state
+  auto propagate = [&]( conduit::Node const & start,
+                        conduit::Node & end,
+                        real64 const dtScale,
+                        bool const executeOutputs )
   {
-    subEvent.cleanup( m_time, m_cycle, 0, 0, domain );
-  } );
+    restoreState( problemManager, start );
+    m_time = windowStart;
+    m_currentSubEvent = 0;
+    integer exitFlag = 0;
+    advance( windowEnd, dtScale, executeOutputs, exitFlag, domain );
+    snapshotState( problemManager, end );
+  };
+
+  // U_n: state at the start of the window, G: coarse propagation of U_n, F: fine propagation of U_n
+  // U_{n+1}: corrected state at the end of the window, sent to the next slice
+  conduit::Node windowStartState;
+  conduit::Node coarseOld;
+  conduit::Node coarseNew;
+  conduit::Node windowEndState;
+  conduit::Node windowEndStateOld;
+
+  // Initial coarse sweep, sequential across the slices
+  if( isFirstSlice )
+  {
+    snapshotState( problemManager, windowStartState );
+  }
+  else
+  {
+    receiveState( windowStartState, prevRank );
+  }
+  propagate( windowStartState, coarseOld, m_pararealCoarseningFactor, false );
+  if( !isLastSlice )
+  {
+    sendState( coarseOld, nextRank );
+  }
+  coarseOld.compact_to( windowEndStateOld );
 
-  return false;
+  for( integer iter = 1; iter <= maxIterations; ++iter )
+  {
+    // Fine propagation, concurrent across the slices
+    propagate( windowStartState, windowEndState, 1.0, false );
+
+    // Coarse propagation from the corrected window start, sequential across the slices.
+    // The first window start never changes, so that its coarse propagation is reused.
+    if( isFirstSlice )
+    {
+      coarseOld.compact_to( coarseNew );
+    }
+    else
+    {
+      receiveState( windowStartState, prevRank );
+      propagate( windowStartState, coarseNew, m_pararealCoarseningFactor, false );
+    }
+    correctState( windowEndState[ meshPath ], coarseNew[ meshPath ], coarseOld[ meshPath ] );
+    if( !isLastSlice )
+    {
+      sendState( windowEndState, nextRank );
+    }
+
+    real64 diffNorm = 0.0;
+    real64 refNorm = 0.0;
+    accumulateStateDifference( windowEndState[ meshPath ], windowEndStateOld[ meshPath ], diffNorm, refNorm );
+    real64 const change = MpiWrapper::max( std::sqrt( diffNorm / std::max( refNorm, std::numeric_limits< real64 >::min() ) ),
+                                           MPI_COMM_WORLD );
+
+    GEOSX_LOG_RANK_0_IF( isLogRank, "Parareal iteration " << iter << ": relative change of the mesh fields = " << change );
+
+    coarseNew.compact_to( coarseOld );
+    windowEndState.compact_to( windowEndStateOld );
+
+    if( change < m_pararealTolerance )
+    {
+      break;
+    }
+  }
+
+  // Final fine sweep from the converged window start states, with outputs.
+  // The slices write concurrently in their own output directories, merged by run() once all the slices are done.
+  propagate( windowStartState, windowEndState, 1.0, true );
 }
 
 } /* namespace geosx */
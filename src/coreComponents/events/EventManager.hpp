@@ -79,6 +79,19 @@ public:
    */
   bool run( DomainPartition & domain );
 
+  /**
+   * @brief Run the event loop with the Parareal parallel-in-time algorithm.
+   * @param[in] domain the current DomainPartition on which the Events will be ran.
+   * @details The horizon [time, maxTime] is split into one window per time slice (see the
+   *          --time-slices command line option). The window of a slice is first advanced with a coarse
+   *          propagator (the event loop with a dt scaled by pararealCoarseningFactor), and the mesh fields
+   *          of the window states are then iteratively corrected with fine solves executed concurrently on all slices.
+   *          The state of the problem is moved between windows through the restart (conduit) representation.
+   *          Once converged, a last fine sweep is executed with the output events enabled. Each slice writes
+   *          its outputs in its own subdirectory of the output directory, and run() merges them once all the slices are done.
+   */
+  void runParareal( DomainPartition & domain );
+
   /**
    * @name viewKeyStruct/groupKeyStruct
    */
@@ -94,6 +107,10 @@ public:
     static constexpr char const * cycleString() { return "cycle"; }
     static constexpr char const * currentSubEventString() { return "currentSubEvent"; }
 
+    static constexpr char const * pararealCoarseningFactorString() { return "pararealCoarseningFactor"; }
+    static constexpr char const * pararealMaxIterationsString() { return "pararealMaxIterations"; }
+    static constexpr char const * pararealToleranceString() { return "pararealTolerance"; }
+
     dataRepository::ViewKey time = { "time" };
     dataRepository::ViewKey dt = { "dt" };
     dataRepository::ViewKey cycle = { "cycle" };
@@ -110,7 +127,27 @@ public:
   /// @copydoc dataRepository::Group::getCatalog()
   static CatalogInterface::CatalogType & getCatalog();
 
+protected:
+
+  virtual void postProcessInput() override;
+
 private:
+
+  /**
+   * @brief Advance the event loop until a given time is reached.
+   * @param[in] endTime the time at which the loop stops
+   * @param[in] dtScale the factor applied to the cycle timestep requested by the events
+   * @param[in] executeOutputs if false, the output and time history collection targets of the events and sub-events are not executed
+   * @param[inout] exitFlag the exit flag set by the events
+   * @param[in] domain the current DomainPartition on which the Events will be ran.
+   * @return True iff an event requested an early return.
+   */
+  bool advance( real64 const endTime,
+                real64 const dtScale,
+                bool const executeOutputs,
+                integer & exitFlag,
+                DomainPartition & domain );
+
   /// Max time for a simulation
   real64 m_maxTime;
 
@@ -128,6 +165,15 @@ private:
 
   /// Current subevent index
   integer m_currentSubEvent;
+
+  /// Ratio between the coarse and fine timesteps of the Parareal driver
+  real64 m_pararealCoarseningFactor;
+
+  /// Maximum number of Parareal iterations
+  integer m_pararealMaxIterations;
+
+  /// Relative tolerance on the change of the mesh fields at the window ends between two Parareal iterations
+  real64 m_pararealTolerance;
 };
 
 
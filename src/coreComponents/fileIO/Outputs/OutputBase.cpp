@@ -24,6 +24,7 @@ namespace geosx
 {
 string OutputBase::m_outputDirectory;
 string OutputBase::m_fileNameRoot;
+integer OutputBase::m_timeSlice = -1;
 
 using namespace dataRepository;
 
@@ -68,11 +69,29 @@ void OutputBase::setOutputDirectory( string const & outputDir )
   m_outputDirectory = outputDir;
 }
 
+string OutputBase::getOutputDirectory()
+{
+  return ( m_timeSlice < 0 ) ? m_outputDirectory : joinPath( m_outputDirectory, getTimeSliceDirectory( m_timeSlice ) );
+}
+
 void OutputBase::setFileNameRoot( string const & root )
 {
   m_fileNameRoot = root;
 }
 
+void OutputBase::setTimeSlice( integer const slice )
+{
+  m_timeSlice = slice;
+}
+
+string OutputBase::getTimeSliceDirectory( integer const slice )
+{
+  return GEOSX_FMT( "timeSlice_{}", slice );
+}
+
+void OutputBase::mergeTimeSlices( integer const GEOSX_UNUSED_PARAM( numSlices ) )
+{}
+
 
 void OutputBase::setupDirectoryStructure()
 {
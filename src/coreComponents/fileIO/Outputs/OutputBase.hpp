@@ -53,9 +53,32 @@ public:
 
   /**
    * @brief Getter for the output directory
-   * @return The output directory
+   * @return The output directory, or the directory of the local time slice if the run is split in time slices
    **/
-  static string getOutputDirectory() {return m_outputDirectory;}
+  static string getOutputDirectory();
+
+  /**
+   * @brief Setter for the time slice of the parallel-in-time driver
+   * @param slice The index of the local time slice
+   * @details Each time slice writes its outputs in its own subdirectory of the output directory,
+   *          see mergeTimeSlices().
+   **/
+  static void setTimeSlice( integer const slice );
+
+  /**
+   * @brief Getter for the output directory of a time slice
+   * @param slice The index of the time slice
+   * @return The directory, relative to the output directory
+   **/
+  static string getTimeSliceDirectory( integer const slice );
+
+  /**
+   * @brief Merge the outputs written by each time slice into the output directory.
+   * @param numSlices The number of time slices
+   * @details Called on all the ranks of all the time slices once the event loop has completed.
+   *          The outputs without a time-ordered index file are left in the time slice directories.
+   **/
+  virtual void mergeTimeSlices( integer const numSlices );
 
   /**
    * @brief Setter for the file name root
@@ -98,6 +121,12 @@ public:
   integer parallelThreads() const { return m_parallelThreads; }
 
 protected:
+  /**
+   * @brief Getter for the directory in which the outputs of the time slices are merged
+   * @return The output directory, whether or not the run is split in time slices
+   **/
+  static string getMergedOutputDirectory() { return m_outputDirectory; }
+
   /**
    * @brief Do initialization prior to calling initialization operations
    *        on the subgroups.
@@ -111,6 +140,7 @@ private:
 
   static string m_outputDirectory;
   static string m_fileNameRoot;
+  static integer m_timeSlice;
 
 };
 
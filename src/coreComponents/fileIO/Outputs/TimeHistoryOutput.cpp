@@ -161,5 +161,21 @@ void TimeHistoryOutput::cleanup( real64 const time_n,
   }
 }
 
+void TimeHistoryOutput::mergeTimeSlices( integer const numSlices )
+{
+  // The time slices cover consecutive time windows, so that their histories are concatenated in the slice order
+  if( MpiWrapper::commRank( MPI_COMM_WORLD ) == 0 )
+  {
+    string const outputDirectory = getMergedOutputDirectory();
+    std::vector< string > sliceFiles;
+    for( integer slice = 0; slice < numSlices; ++slice )
+    {
+      sliceFiles.emplace_back( joinPath( outputDirectory, getTimeSliceDirectory( slice ), m_filename ) );
+    }
+    mergeHDFHistoryFiles( sliceFiles, joinPath( outputDirectory, m_filename ) );
+  }
+  MpiWrapper::barrier( MPI_COMM_WORLD );
+}
+
 REGISTER_CATALOG_ENTRY( OutputBase, TimeHistoryOutput, string const &, Group * const )
 }
@@ -79,6 +79,12 @@ public:
                         real64 const eventProgress,
                         DomainPartition & domain ) override;
 
+  /**
+   * @brief Concatenate the time history files of the time slices into one file.
+   * @copydoc OutputBase::mergeTimeSlices()
+   */
+  virtual void mergeTimeSlices( integer const numSlices ) override;
+
   /// @cond DO_NOT_DOCUMENT
   struct viewKeys
   {
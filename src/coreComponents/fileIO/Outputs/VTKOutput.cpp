@@ -82,6 +82,24 @@ bool VTKOutput::execute( real64 const time_n,
   return false;
 }
 
+void VTKOutput::mergeTimeSlices( integer const numSlices )
+{
+  // The last output of a time slice and the first output of the next one may share their time-step,
+  // in which case the later slice is skipped
+  if( MpiWrapper::commRank( MPI_COMM_WORLD ) == 0 )
+  {
+    string const outputDirectory = getMergedOutputDirectory();
+    vtk::VTKPVDWriter const pvd( joinPath( outputDirectory, m_plotFileRoot + ".pvd" ) );
+    real64 lastTime = std::numeric_limits< real64 >::lowest();
+    for( integer slice = 0; slice < numSlices; ++slice )
+    {
+      string const sliceDirectory = getTimeSliceDirectory( slice );
+      lastTime = pvd.addFile( joinPath( outputDirectory, sliceDirectory, m_plotFileRoot + ".pvd" ), sliceDirectory, lastTime );
+    }
+    pvd.save();
+  }
+  MpiWrapper::barrier( MPI_COMM_WORLD );
+}
 
 REGISTER_CATALOG_ENTRY( OutputBase, VTKOutput, string const &, Group * const )
 } /* namespace geosx */
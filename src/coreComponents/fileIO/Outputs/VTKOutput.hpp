@@ -71,6 +71,12 @@ public:
     execute( time_n, 0, cycleNumber, eventCounter, eventProgress, domain );
   }
 
+  /**
+   * @brief Write a PVD file which collects the vtk files of all the time slices
+   * @copydoc OutputBase::mergeTimeSlices()
+   */
+  virtual void mergeTimeSlices( integer const numSlices ) override;
+
   /// @cond DO_NOT_DOCUMENT
   struct viewKeysStruct : OutputBase::viewKeysStruct
   {
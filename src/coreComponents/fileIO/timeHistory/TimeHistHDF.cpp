@@ -435,4 +435,120 @@ void HDFHistIO::updateCollectingCount( localIndex count )
   }
 }
 
+/**
+ * @brief Get the names of the data sets at the root of an HDF file.
+ * @param fileId The HDF file id.
+ * @return The names of the data sets.
+ */
+static std::vector< string > getDatasetNames( hid_t const fileId )
+{
+  H5G_info_t info;
+  H5Gget_info( fileId, &info );
+
+  std::vector< string > names;
+  for( hsize_t idx = 0; idx < info.nlinks; ++idx )
+  {
+    ssize_t const length = H5Lget_name_by_idx( fileId, ".", H5_INDEX_NAME, H5_ITER_INC, idx, nullptr, 0, H5P_DEFAULT );
+    std::vector< char > name( length + 1 );
+    H5Lget_name_by_idx( fileId, ".", H5_INDEX_NAME, H5_ITER_INC, idx, name.data(), name.size(), H5P_DEFAULT );
+
+    H5G_stat_t stat;
+    if( H5Gget_objinfo( fileId, name.data(), 0, &stat ) >= 0 && stat.type == H5G_DATASET )
+    {
+      names.emplace_back( name.data() );
+    }
+  }
+  return names;
+}
+
+void mergeHDFHistoryFiles( std::vector< string > const & sourceFiles, string const & targetFile )
+{
+  std::vector< hid_t > sourceIds;
+  for( string const & sourceFile : sourceFiles )
+  {
+    string const filename = sourceFile + ".hdf5";
+    hid_t const fileId = H5Fopen( filename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT );
+    GEOSX_ERROR_IF( fileId < 0, "Cannot open the history file " << filename );
+    sourceIds.emplace_back( fileId );
+  }
+
+  string const targetFilename = targetFile + ".hdf5";
+  hid_t const targetId = H5Fcreate( targetFilename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT );
+  GEOSX_ERROR_IF( targetId < 0, "Cannot create the history file " << targetFilename );
+
+  for( string const & name : getDatasetNames( sourceIds.front() ) )
+  {
+    // the data set of each source, with its extents, or a negative id if the source does not hold the data set
+    std::vector< hid_t > datasets( sourceIds.size(), -1 );
+    std::vector< std::vector< hsize_t > > dims( sourceIds.size() );
+    std::vector< hsize_t > mergedDims;
+    hid_t type = -1;
+    for( std::size_t src = 0; src < sourceIds.size(); ++src )
+    {
+      if( H5Lexists( sourceIds[src], name.c_str(), H5P_DEFAULT ) <= 0 )
+      {
+        continue;
+      }
+      datasets[src] = H5Dopen( sourceIds[src], name.c_str(), H5P_DEFAULT );
+      hid_t const space = H5Dget_space( datasets[src] );
+      dims[src].resize( H5Sget_simple_extent_ndims( space ) );
+      H5Sget_simple_extent_dims( space, dims[src].data(), nullptr );
+      H5Sclose( space );
+
+      if( type < 0 )
+      {
+        type = H5Dget_type( datasets[src] );
+        mergedDims.assign( dims[src].size(), 0 );
+      }
+      GEOSX_ERROR_IF( dims[src].size() != mergedDims.size(),
+                      "The data set " << name << " has different ranks in the history files to merge" );
+      mergedDims[0] += dims[src][0];
+      for( std::size_t dd = 1; dd < mergedDims.size(); ++dd )
+      {
+        mergedDims[dd] = std::max( mergedDims[dd], dims[src][dd] );
+      }
+    }
+
+    hid_t const mergedSpace = H5Screate_simple( LvArray::integerConversion< int >( mergedDims.size() ), mergedDims.data(), nullptr );
+    hid_t const mergedDataset = H5Dcreate( targetId, name.c_str(), type, mergedSpace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+
+    // copy the rows of each source after those of the previous ones
+    std::vector< hsize_t > offset( mergedDims.size(), 0 );
+    for( std::size_t src = 0; src < sourceIds.size(); ++src )
+    {
+      if( datasets[src] < 0 )
+      {
+        continue;
+      }
+      hsize_t count = 1;
+      for( hsize_t const extent : dims[src] )
+      {
+        count *= extent;
+      }
+      if( count > 0 )
+      {
+        std::vector< buffer_unit_type > buffer( count * H5Tget_size( type ) );
+        H5Dread( datasets[src], type, H5S_ALL, H5S_ALL, H5P_DEFAULT, buffer.data() );
+
+        hid_t const memSpace = H5Screate_simple( LvArray::integerConversion< int >( dims[src].size() ), dims[src].data(), nullptr );
+        H5Sselect_hyperslab( mergedSpace, H5S_SELECT_SET, offset.data(), nullptr, dims[src].data(), nullptr );
+        H5Dwrite( mergedDataset, type, memSpace, mergedSpace, H5P_DEFAULT, buffer.data() );
+        H5Sclose( memSpace );
+      }
+      offset[0] += dims[src][0];
+      H5Dclose( datasets[src] );
+    }
+
+    H5Dclose( mergedDataset );
+    H5Sclose( mergedSpace );
+    H5Tclose( type );
+  }
+
+  H5Fclose( targetId );
+  for( hid_t const sourceId : sourceIds )
+  {
+    H5Fclose( sourceId );
+  }
+}
+
 }
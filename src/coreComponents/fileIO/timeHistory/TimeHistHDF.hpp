@@ -242,6 +242,16 @@ private:
   bool m_sizeChanged;
 };
 
+/**
+ * @brief Concatenate the history rows of the data sets of several history files into a new file.
+ * @param sourceFiles The filenames of the files to merge, in the order of their history rows.
+ * @param targetFile The filename of the merged file, overwritten if it exists.
+ * @details This is a serial operation on the calling rank. The data sets are those of the first file.
+ *   The second dimension of a merged data set is the largest one of the sources, the rows of the
+ *   sources which collected fewer indices are padded with zeros.
+ */
+void mergeHDFHistoryFiles( std::vector< string > const & sourceFiles, string const & targetFile );
+
 }
 
 #endif
@@ -15,6 +15,7 @@
 #include "VTKPVDWriter.hpp"
 
 #include "common/MpiWrapper.hpp"
+#include "common/Path.hpp"
 
 namespace geosx
 {
@@ -56,5 +57,23 @@ void VTKPVDWriter::addData( real64 time, string const & filePath ) const
   dataSetNode.append_attribute( "timestep" ) = time;
   dataSetNode.append_attribute( "file" ) = filePath.c_str();
 }
+
+real64 VTKPVDWriter::addFile( string const & fileName, string const & directory, real64 minTime ) const
+{
+  xmlWrapper::xmlDocument pvdFile;
+  xmlWrapper::xmlResult const result = pvdFile.load_file( fileName.c_str() );
+  GEOSX_ERROR_IF( !result, "Cannot read the PVD file " << fileName << ": " << result.description() );
+
+  for( xmlWrapper::xmlNode dataSetNode : pvdFile.child( "VTKFile" ).child( "Collection" ).children( "DataSet" ) )
+  {
+    real64 const time = dataSetNode.attribute( "timestep" ).as_double();
+    if( time > minTime )
+    {
+      addData( time, joinPath( directory, dataSetNode.attribute( "file" ).value() ) );
+      minTime = time;
+    }
+  }
+  return minTime;
+}
 }
 }
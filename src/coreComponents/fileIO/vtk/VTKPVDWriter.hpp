@@ -55,6 +55,15 @@ public:
    */
   void addData( real64 time, string const & filePath ) const;
 
+  /*!
+   * @brief Add the datasets of another PVD file
+   * @param[in] fileName the PVD file to read
+   * @param[in] directory the directory of the PVD file, relative to the directory of this file
+   * @param[in] minTime only the datasets of a later time-step are added
+   * @return the last time-step of this file once the datasets are added
+   */
+  real64 addFile( string const & fileName, string const & directory, real64 minTime ) const;
+
 private:
 
   /// PVD XML file
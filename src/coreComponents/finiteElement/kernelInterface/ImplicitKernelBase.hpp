@@ -41,12 +41,18 @@ namespace finiteElement
  * Provides a common base for kernels that require the assembly of a system of
  * equations. The types required to assemble the system, such as DOF
  * information, the Matrix and Vector object, etc., are declared and set here.
+ *
+ * If @p RESIDUAL_ONLY is true, derived kernels only assemble the residual:
+ * they skip the computation of the element Jacobian and never write into the
+ * matrix, which is then left untouched. This is meant for the residual
+ * evaluations of line searches and Jacobian-free products.
  */
 template< typename SUBREGION_TYPE,
           typename CONSTITUTIVE_TYPE,
           typename FE_TYPE,
           int NUM_DOF_PER_TEST_SP,
-          int NUM_DOF_PER_TRIAL_SP >
+          int NUM_DOF_PER_TRIAL_SP,
+          bool RESIDUAL_ONLY = false >
 class ImplicitKernelBase : public KernelBase< SUBREGION_TYPE,
                                               CONSTITUTIVE_TYPE,
                                               FE_TYPE,
@@ -67,6 +73,9 @@ public:
   using Base::numDofPerTrialSupportPoint;
   using Base::m_elemsToNodes;
 
+  /// Compile time flag to skip the Jacobian computation and the matrix scatter
+  static constexpr bool residualOnly = RESIDUAL_ONLY;
+
 
   /**
    * @brief Constructor
@@ -242,6 +242,53 @@ public:
   }
   //END_kernelLauncher
 
+  /**
+   * @brief Kernel Launcher processing the elements one color at a time.
+   * @tparam POLICY The RAJA policy to use for the launch.
+   * @tparam KERNEL_TYPE The type of Kernel to execute.
+   * @param colorOffsets The offsets of each color in @p elementsByColor.
+   * @param elementsByColor The elements sorted by color.
+   * @param kernelComponent The instantiation of KERNEL_TYPE to execute.
+   * @return The maximum residual contribution.
+   *
+   * Elements of the same color do not share a node, so that the scatter of the element contributions
+   * in complete() never touches the same row concurrently within a launch. With host-parallel policies,
+   * this removes the contention on the atomics of the shared rows.
+   */
+  template< typename POLICY,
+            typename KERNEL_TYPE >
+  static
+  real64
+  kernelLaunchColored( arrayView1d< localIndex const > const & colorOffsets,
+                       arrayView1d< localIndex const > const & elementsByColor,
+                       KERNEL_TYPE const & kernelComponent )
+  {
+    GEOSX_MARK_FUNCTION;
+
+    real64 maxResidual = 0;
+    for( localIndex color = 0; color < colorOffsets.size() - 1; ++color )
+    {
+      localIndex const firstElem = colorOffsets[color];
+      RAJA::ReduceMax< ReducePolicy< POLICY >, real64 > maxColorResidual( 0 );
+
+      forAll< POLICY >( colorOffsets[color + 1] - firstElem,
+                        [=] GEOSX_HOST_DEVICE ( localIndex const i )
+      {
+        localIndex const k = elementsByColor[firstElem + i];
+        typename KERNEL_TYPE::StackVariables stack;
+
+        kernelComponent.setup( k, stack );
+        for( integer q=0; q<numQuadraturePointsPerElem; ++q )
+        {
+          kernelComponent.quadraturePointKernel( k, q, stack );
+        }
+        maxColorResidual.max( kernelComponent.complete( k, stack ) );
+      } );
+      maxResidual = std::max( maxResidual, maxColorResidual.get() );
+    }
+    return maxResidual;
+  }
+
 protected:
   /// The element to nodes map.
   traits::ViewTypeConst< typename SUBREGION_TYPE::NodeMapType::base_type > const m_elemsToNodes;
@@ -349,6 +396,8 @@ private:
  * @param finiteElementName The name of the finite element.
  * @param constitutiveStringName The key to the constitutive model name found on the Region.
  * @param kernelFactory The object used to construct the kernel.
+ * @param coloredLaunch If true, the elements are processed one color at a time
+ *   (see #::geosx::finiteElement::KernelBase::kernelLaunchColored()).
  * @return The maximum contribution to the residual, which may be used to scale the residual.
  *
  * @details Loops over all regions Applies/Launches a kernel specified by the @p KERNEL_TEMPLATE through
@@ -363,7 +412,8 @@ real64 regionBasedKernelApplication( MeshLevel & mesh,
                                      arrayView1d< string const > const & targetRegions,
                                      string const & finiteElementName,
                                      string const & constitutiveStringName,
-                                     KERNEL_FACTORY & kernelFactory )
+                                     KERNEL_FACTORY & kernelFactory,
+                                     bool const coloredLaunch = false )
 {
   GEOSX_MARK_FUNCTION;
   // save the maximum residual contribution for scaling residuals for convergence criteria.
@@ -382,11 +432,16 @@ real64 regionBasedKernelApplication( MeshLevel & mesh,
                                                                 &edgeManager,
                                                                 &faceManager,
                                                                 &kernelFactory,
-                                                                &finiteElementName]
+                                                                &finiteElementName,
+                                                                coloredLaunch]
                                                                  ( localIndex const targetRegionIndex, auto & elementSubRegion )
   {
     localIndex const numElems = elementSubRegion.size();
 
+    // Elements sharing a node get different colors, fall back to the plain launch if the coloring failed
+    bool const useColors = coloredLaunch &&
+                           elementSubRegion.computeElementColoring( elementSubRegion.nodeList().toViewConst(), nodeManager.size() );
+
     // Get the constitutive model...and allocate a null constitutive model if required.
 
     constitutive::ConstitutiveBase * constitutiveRelation = nullptr;
@@ -412,7 +467,8 @@ real64 regionBasedKernelApplication( MeshLevel & mesh,
                                                                        &kernelFactory,
                                                                        &elementSubRegion,
                                                                        &finiteElementName,
-                                                                       numElems]
+                                                                       numElems,
+                                                                       useColors]
                                                                         ( auto & castedConstitutiveRelation )
     {
       FiniteElementBase &
@@ -427,6 +483,7 @@ real64 regionBasedKernelApplication( MeshLevel & mesh,
                                   &kernelFactory,
                                   &elementSubRegion,
                                   numElems,
+                                  useColors,
                                   &castedConstitutiveRelation] ( auto const finiteElement )
       {
         auto kernel = kernelFactory.createKernel( nodeManager,
@@ -440,9 +497,20 @@ real64 regionBasedKernelApplication( MeshLevel & mesh,
         using KERNEL_TYPE = decltype( kernel );
 
         // Call the kernelLaunch function, and store the maximum contribution to the residual.
-        maxResidualContribution =
-          std::max( maxResidualContribution,
-                    KERNEL_TYPE::template kernelLaunch< POLICY, KERNEL_TYPE >( numElems, kernel ) );
+        if( useColors )
+        {
+          maxResidualContribution =
+            std::max( maxResidualContribution,
+                      KERNEL_TYPE::template kernelLaunchColored< POLICY, KERNEL_TYPE >( elementSubRegion.getColorOffsets(),
+                                                                                         elementSubRegion.getElementsByColor(),
+                                                                                         kernel ) );
+        }
+        else
+        {
+          maxResidualContribution =
+            std::max( maxResidualContribution,
+                      KERNEL_TYPE::template kernelLaunch< POLICY, KERNEL_TYPE >( numElems, kernel ) );
+        }
       } );
     } );
 
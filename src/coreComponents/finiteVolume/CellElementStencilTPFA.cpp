@@ -48,6 +48,8 @@ void CellElementStencilTPFA::add( localIndex const numPts,
 {
   GEOSX_ERROR_IF_NE_MSG( numPts, 2, "Number of cells in TPFA stencil should be 2" );
 
+  clearCachedWeights();
+
   localIndex const oldSize = m_elementRegionIndices.size( 0 );
   localIndex const newSize = oldSize + 1;
   m_elementRegionIndices.resize( newSize, numPts );
@@ -69,6 +71,8 @@ void CellElementStencilTPFA::addVectors( real64 const & transMultiplier,
                                          real64 const (&faceNormal)[3],
                                          real64 const (&cellToFaceVec)[2][3] )
 {
+  clearCachedWeights();
+
   localIndex const oldSize = m_faceNormal.size( 0 );
   localIndex const newSize = oldSize + 1;
   m_faceNormal.resize( newSize );
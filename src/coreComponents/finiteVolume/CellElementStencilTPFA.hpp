@@ -222,13 +222,15 @@ public:
    */
   StencilWrapper createStencilWrapper() const
   {
-    return StencilWrapper( m_elementRegionIndices,
-                           m_elementSubRegionIndices,
-                           m_elementIndices,
-                           m_weights,
-                           m_faceNormal,
-                           m_cellToFaceVec,
-                           m_transMultiplier );
+    StencilWrapper stencilWrapper( m_elementRegionIndices,
+                                   m_elementSubRegionIndices,
+                                   m_elementIndices,
+                                   m_weights,
+                                   m_faceNormal,
+                                   m_cellToFaceVec,
+                                   m_transMultiplier );
+    passCachedWeights( stencilWrapper );
+    return stencilWrapper;
   }
 
 private:
@@ -247,6 +249,11 @@ inline void CellElementStencilTPFAWrapper::computeWeights( localIndex iconn,
 {
   GEOSX_UNUSED_VAR( dCoeff_dVar );
 
+  if( getCachedWeights( iconn, weight, dWeight_dVar ) )
+  {
+    return;
+  }
+
   real64 halfWeight[2];
 
   // real64 const tolerance = 1e-30 * lengthTolerance; // TODO: choice of constant based on physics?
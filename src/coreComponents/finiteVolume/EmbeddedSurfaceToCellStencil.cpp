@@ -39,6 +39,8 @@ void EmbeddedSurfaceToCellStencil::add( localIndex const numPts,
 {
   GEOSX_ERROR_IF_NE_MSG( numPts, 2, "Number of cells in TPFA stencil should be 2" );
 
+  clearCachedWeights();
+
   localIndex const oldSize = m_elementRegionIndices.size( 0 );
   localIndex const newSize = oldSize + 1;
   m_elementRegionIndices.resize( newSize, numPts );
@@ -204,10 +204,12 @@ public:
    */
   StencilWrapper createStencilWrapper() const
   {
-    return StencilWrapper( m_elementRegionIndices,
-                           m_elementSubRegionIndices,
-                           m_elementIndices,
-                           m_weights );
+    StencilWrapper stencilWrapper( m_elementRegionIndices,
+                                   m_elementSubRegionIndices,
+                                   m_elementIndices,
+                                   m_weights );
+    passCachedWeights( stencilWrapper );
+    return stencilWrapper;
   }
 
 
@@ -240,6 +242,11 @@ inline void EmbeddedSurfaceToCellStencilWrapper::computeWeights( localIndex icon
                                                                  real64 ( & weight )[1][2],
                                                                  real64 ( & dWeight_dVar )[1][2] ) const
 {
+  if( getCachedWeights( iconn, weight, dWeight_dVar ) )
+  {
+    return;
+  }
+
   localIndex const er0  =  m_elementRegionIndices[iconn][0];
   localIndex const esr0 =  m_elementSubRegionIndices[iconn][0];
   localIndex const ei0  =  m_elementIndices[iconn][0];
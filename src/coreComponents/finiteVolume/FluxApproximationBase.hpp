@@ -86,6 +86,12 @@ public:
   template< typename LAMBDA >
   void forAllStencils( MeshLevel const & mesh, LAMBDA && lambda ) const;
 
+  /**
+   * @copydoc forAllStencils(MeshLevel const &, LAMBDA &&) const
+   */
+  template< typename LAMBDA >
+  void forAllStencils( MeshLevel & mesh, LAMBDA && lambda ) const;
+
   /**
    * @brief Call a user-provided function for the each stencil according to the provided TYPE.
    * @tparam TYPE The type to be passed to forWrappers
@@ -97,6 +103,12 @@ public:
   template< typename TYPE, typename ... TYPES, typename LAMBDA >
   void forStencils( MeshLevel const & mesh, LAMBDA && lambda ) const;
 
+  /**
+   * @copydoc forStencils(MeshLevel const &, LAMBDA &&) const
+   */
+  template< typename TYPE, typename ... TYPES, typename LAMBDA >
+  void forStencils( MeshLevel & mesh, LAMBDA && lambda ) const;
+
   /**
    * @brief Add a new fracture stencil.
    * @param[in,out] mesh the mesh on which to add the fracture stencil
@@ -285,6 +297,15 @@ void FluxApproximationBase::forAllStencils( MeshLevel const & mesh, LAMBDA && la
                FaceElementToCellStencil >( mesh, std::forward< LAMBDA >( lambda ) );
 }
 
+template< typename LAMBDA >
+void FluxApproximationBase::forAllStencils( MeshLevel & mesh, LAMBDA && lambda ) const
+{
+  forStencils< CellElementStencilTPFA,
+               SurfaceElementStencil,
+               EmbeddedSurfaceToCellStencil,
+               FaceElementToCellStencil >( mesh, std::forward< LAMBDA >( lambda ) );
+}
+
 template< typename TYPE, typename ... TYPES, typename LAMBDA >
 void FluxApproximationBase::forStencils( MeshLevel const & mesh, LAMBDA && lambda ) const
 {
@@ -295,6 +316,16 @@ void FluxApproximationBase::forStencils( MeshLevel const & mesh, LAMBDA && lambd
   } );
 }
 
+template< typename TYPE, typename ... TYPES, typename LAMBDA >
+void FluxApproximationBase::forStencils( MeshLevel & mesh, LAMBDA && lambda ) const
+{
+  Group & stencilGroup = mesh.getGroup( groupKeyStruct::stencilMeshGroupString() ).getGroup( getName() );
+  stencilGroup.forWrappers< TYPE, TYPES... >( [&] ( auto & wrapper )
+  {
+    lambda( wrapper.reference() );
+  } );
+}
+
 } // namespace geosx
 
 #endif //GEOSX_FINITEVOLUME_FLUXAPPROXIMATIONBASE_HPP_
@@ -35,7 +35,8 @@ using namespace mimeticInnerProduct;
 
 HybridMimeticDiscretization::HybridMimeticDiscretization( string const & name,
                                                           Group * const parent )
-  : Group( name, parent )
+  : Group( name, parent ),
+  m_precomputeTransmissibility( 0 )
 {
   setInputFlags( InputFlags::OPTIONAL_NONUNIQUE );
 
@@ -44,6 +45,13 @@ HybridMimeticDiscretization::HybridMimeticDiscretization( string const & name,
   registerWrapper( viewKeyStruct::innerProductTypeString(), &m_innerProductType ).
     setInputFlag( InputFlags::REQUIRED ).
     setDescription( "Type of inner product used in the hybrid FVM solver" );
+
+  registerWrapper( viewKeyStruct::precomputeTransmissibilityString(), &m_precomputeTransmissibility ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Flag to compute the one-sided transmissibility matrices once and store them per element, "
+                    "instead of recomputing them in each flux assembly. "
+                    "The stored matrices are only used when the permeability does not depend on the state" );
 }
 
 void HybridMimeticDiscretization::initializePostInitialConditionsPreSubGroups()
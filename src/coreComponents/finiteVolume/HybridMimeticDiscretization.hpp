@@ -74,8 +74,17 @@ public:
 
     /// @return The key for the inner product
     static constexpr char const * innerProductString() { return "innerProduct"; }
+
+    /// @return The key for the flag enabling the storage of the transmissibility matrices
+    static constexpr char const * precomputeTransmissibilityString() { return "precomputeTransmissibility"; }
   };
 
+  /**
+   * @brief Return the flag enabling the storage of the one-sided transmissibility matrices.
+   * @return true if the transmissibility matrices are computed once and stored per element
+   */
+  bool precomputeTransmissibility() const { return m_precomputeTransmissibility != 0; }
+
 protected:
 
   virtual void initializePostInitialConditionsPreSubGroups() override;
@@ -85,6 +94,9 @@ private:
   /// type of of inner product used in the hybrid FVM solver
   string m_innerProductType;
 
+  /// flag to store the transmissibility matrices instead of recomputing them in each flux assembly
+  integer m_precomputeTransmissibility;
+
   /**
    * @brief Factory method to instantiate a type of mimetic inner product.
    * @return A unique_ptr< MimeticInnerProductBase > which contains the new
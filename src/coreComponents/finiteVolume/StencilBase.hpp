@@ -20,6 +20,7 @@
 #define GEOSX_FINITEVOLUME_STENCILBASE_HPP_
 
 #include "common/DataTypes.hpp"
+#include "common/GEOS_RAJA_Interface.hpp"
 #include "codingUtilities/Utilities.hpp"
 #include "mesh/ElementRegionManager.hpp"
 
@@ -82,6 +83,48 @@ public:
    */
   virtual localIndex size() const = 0;
 
+  /**
+   * @brief Set the transmissibilities cached by the stencil.
+   * @param[in] cachedWeights the cached weights (connection, connection pair, point)
+   * @param[in] cachedDWeight_dVar the cached derivatives of the weights
+   */
+  void setCachedWeights( arrayView3d< real64 const > const & cachedWeights,
+                         arrayView3d< real64 const > const & cachedDWeight_dVar )
+  {
+    m_cachedWeights = cachedWeights;
+    m_cachedDWeight_dVar = cachedDWeight_dVar;
+  }
+
+  /**
+   * @brief Copy the cached weights and derivatives of a connection, if they are available.
+   * @tparam NUM_CONNECTIONS the maximum number of connection pairs in a stencil entry
+   * @param[in] iconn connection index
+   * @param[out] weight the weights
+   * @param[out] dWeight_dVar the derivatives of the weights
+   * @return true if the weights are cached, false if they must be computed
+   */
+  template< localIndex NUM_CONNECTIONS >
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  bool getCachedWeights( localIndex const iconn,
+                         real64 ( &weight )[NUM_CONNECTIONS][2],
+                         real64 ( &dWeight_dVar )[NUM_CONNECTIONS][2] ) const
+  {
+    if( m_cachedWeights.size( 0 ) == 0 )
+    {
+      return false;
+    }
+    for( localIndex k = 0; k < NUM_CONNECTIONS; ++k )
+    {
+      for( localIndex i = 0; i < 2; ++i )
+      {
+        weight[k][i] = m_cachedWeights[iconn][k][i];
+        dWeight_dVar[k][i] = m_cachedDWeight_dVar[iconn][k][i];
+      }
+    }
+    return true;
+  }
+
 protected:
   /// The container for the element region indices for each point in each stencil
   typename LEAFCLASSTRAITS::IndexContainerViewConstType m_elementRegionIndices;
@@ -95,6 +138,12 @@ protected:
   /// The container for the weights for each point in each stencil
   typename LEAFCLASSTRAITS::WeightContainerViewConstType m_weights;
 
+  /// The cached transmissibilities (empty if they are computed on the fly)
+  arrayView3d< real64 const > m_cachedWeights;
+
+  /// The cached derivatives of the transmissibilities
+  arrayView3d< real64 const > m_cachedDWeight_dVar;
+
 };
 
 
@@ -113,7 +162,9 @@ public:
     m_elementSubRegionIndices(),
     m_elementIndices(),
     m_weights(),
-    m_connectorIndices()
+    m_connectorIndices(),
+    m_cachedWeights(),
+    m_cachedDWeight_dVar()
   {}
 
   /**
@@ -208,7 +259,51 @@ public:
    */
   typename LEAFCLASSTRAITS::WeightContainerViewConstType getWeights() const { return m_weights.toViewConst(); }
 
+  /**
+   * @brief Compute the transmissibilities once and store them with their derivatives.
+   * @tparam POLICY the policy used in the RAJA kernel
+   * @param[in] coefficient view accessor to the coefficient used to compute the weights
+   * @param[in] dCoeff_dVar view accessor to the derivative of the coefficient w.r.t to the variable
+   *
+   * The stencil wrappers then return the cached values in computeWeights instead of recomputing them,
+   * which is valid as long as the coefficient does not change. The cache is dropped when the stencil is modified.
+   */
+  template< typename POLICY >
+  void cacheWeights( ElementRegionManager::ElementViewConst< arrayView3d< real64 const > > const & coefficient,
+                     ElementRegionManager::ElementViewConst< arrayView3d< real64 const > > const & dCoeff_dVar );
+
+  /**
+   * @brief Drop the cached transmissibilities, so that they are computed on the fly again.
+   */
+  void clearCachedWeights()
+  {
+    m_cachedWeights.clear();
+    m_cachedDWeight_dVar.clear();
+  }
+
+  /**
+   * @brief Check whether the transmissibilities are cached.
+   * @return true if every stencil entry has cached weights
+   */
+  bool hasCachedWeights() const
+  { return m_cachedWeights.size( 0 ) > 0 && m_cachedWeights.size( 0 ) == static_cast< LEAFCLASS const * >(this)->size(); }
+
 protected:
+
+  /**
+   * @brief Pass the cached transmissibilities, if any, to a stencil wrapper.
+   * @tparam WRAPPER the type of the stencil wrapper
+   * @param[inout] wrapper the stencil wrapper
+   */
+  template< typename WRAPPER >
+  void passCachedWeights( WRAPPER & wrapper ) const
+  {
+    if( hasCachedWeights() )
+    {
+      wrapper.setCachedWeights( m_cachedWeights.toViewConst(), m_cachedDWeight_dVar.toViewConst() );
+    }
+  }
+
   /// The container for the element region indices for each point in each stencil
   typename LEAFCLASSTRAITS::IndexContainerType m_elementRegionIndices;
 
@@ -224,6 +319,12 @@ protected:
   /// The map that provides the stencil index given the index of the underlying connector object.
   map< localIndex, localIndex > m_connectorIndices;
 
+  /// The cached transmissibilities for each connection (empty if they are computed on the fly)
+  array3d< real64 > m_cachedWeights;
+
+  /// The cached derivatives of the transmissibilities for each connection
+  array3d< real64 > m_cachedDWeight_dVar;
+
 };
 
 
@@ -241,6 +342,7 @@ void StencilBase< LEAFCLASSTRAITS, LEAFCLASS >::reserve( localIndex const size )
 template< typename LEAFCLASSTRAITS, typename LEAFCLASS >
 bool StencilBase< LEAFCLASSTRAITS, LEAFCLASS >::zero( localIndex const connectorIndex )
 {
+  clearCachedWeights();
   return
     executeOnMapValue( m_connectorIndices, connectorIndex, [&]( localIndex const connectionListIndex )
   {
@@ -258,6 +360,8 @@ void StencilBase< LEAFCLASSTRAITS, LEAFCLASS >::setName( string const & name )
   m_elementSubRegionIndices.setName( name + "/elementSubRegionIndices" );
   m_elementIndices.setName( name + "/elementIndices" );
   m_weights.setName( name + "/weights" );
+  m_cachedWeights.setName( name + "/cachedWeights" );
+  m_cachedDWeight_dVar.setName( name + "/cachedDWeight_dVar" );
 }
 
 template< typename LEAFCLASSTRAITS, typename LEAFCLASS >
@@ -267,6 +371,46 @@ void StencilBase< LEAFCLASSTRAITS, LEAFCLASS >::move( LvArray::MemorySpace const
   m_elementSubRegionIndices.move( space, true );
   m_elementIndices.move( space, true );
   m_weights.move( space, true );
+  m_cachedWeights.move( space, false );
+  m_cachedDWeight_dVar.move( space, false );
+}
+
+template< typename LEAFCLASSTRAITS, typename LEAFCLASS >
+template< typename POLICY >
+void StencilBase< LEAFCLASSTRAITS, LEAFCLASS >::cacheWeights( ElementRegionManager::ElementViewConst< arrayView3d< real64 const > > const & coefficient,
+                                                              ElementRegionManager::ElementViewConst< arrayView3d< real64 const > > const & dCoeff_dVar )
+{
+  using StencilWrapper = typename LEAFCLASS::StencilWrapper;
+  localIndex constexpr maxNumConnections = LEAFCLASSTRAITS::MAX_NUM_OF_CONNECTIONS;
+
+  // the wrapper must compute the weights, not return the old ones
+  clearCachedWeights();
+  StencilWrapper const stencilWrapper = static_cast< LEAFCLASS const * >(this)->createStencilWrapper();
+
+  localIndex const numConnections = stencilWrapper.size();
+  array3d< real64 > cachedWeights( numConnections, maxNumConnections, 2 );
+  array3d< real64 > cachedDWeight_dVar( numConnections, maxNumConnections, 2 );
+  arrayView3d< real64 > const cachedWeightsView = cachedWeights.toView();
+  arrayView3d< real64 > const cachedDWeight_dVarView = cachedDWeight_dVar.toView();
+
+  forAll< POLICY >( numConnections, [=] GEOSX_HOST_DEVICE ( localIndex const iconn )
+  {
+    real64 weight[maxNumConnections][2]{};
+    real64 dWeight_dVar[maxNumConnections][2]{};
+    stencilWrapper.computeWeights( iconn, coefficient, dCoeff_dVar, weight, dWeight_dVar );
+
+    for( localIndex k = 0; k < maxNumConnections; ++k )
+    {
+      for( localIndex i = 0; i < 2; ++i )
+      {
+        cachedWeightsView[iconn][k][i] = weight[k][i];
+        cachedDWeight_dVarView[iconn][k][i] = dWeight_dVar[k][i];
+      }
+    }
+  } );
+
+  m_cachedWeights = std::move( cachedWeights );
+  m_cachedDWeight_dVar = std::move( cachedDWeight_dVar );
 }
 
 } /* namespace geosx */
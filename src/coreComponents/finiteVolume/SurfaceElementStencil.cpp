@@ -41,6 +41,8 @@ void SurfaceElementStencil::add( localIndex const numPts,
 {
   GEOSX_ERROR_IF( numPts >= MAX_STENCIL_SIZE, "Maximum stencil size exceeded" );
 
+  clearCachedWeights();
+
   typename decltype( m_connectorIndices )::iterator iter = m_connectorIndices.find( connectorIndex );
   if( iter==m_connectorIndices.end() )
   {
@@ -72,6 +74,8 @@ void SurfaceElementStencil::add( localIndex const numPts,
 {
   GEOSX_ERROR_IF( numPts >= MAX_STENCIL_SIZE, "Maximum stencil size exceeded" );
 
+  clearCachedWeights();
+
   typename decltype( m_connectorIndices )::iterator iter = m_connectorIndices.find( connectorIndex );
   if( iter==m_connectorIndices.end() )
   {
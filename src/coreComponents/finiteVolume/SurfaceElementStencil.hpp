@@ -278,12 +278,14 @@ public:
    */
   StencilWrapper createStencilWrapper() const
   {
-    return StencilWrapper( m_elementRegionIndices,
-                           m_elementSubRegionIndices,
-                           m_elementIndices,
-                           m_weights,
-                           m_cellCenterToEdgeCenters,
-                           m_meanPermCoefficient );
+    StencilWrapper stencilWrapper( m_elementRegionIndices,
+                                   m_elementSubRegionIndices,
+                                   m_elementIndices,
+                                   m_weights,
+                                   m_cellCenterToEdgeCenters,
+                                   m_meanPermCoefficient );
+    passCachedWeights( stencilWrapper );
+    return stencilWrapper;
   }
 
 
@@ -316,6 +318,7 @@ public:
   void setMeanPermCoefficient( real64 const & meanPermCoefficient )
   {
     m_meanPermCoefficient = meanPermCoefficient;
+    clearCachedWeights();
   }
 
 private:
@@ -335,6 +338,10 @@ inline void SurfaceElementStencilWrapper::computeWeights( localIndex iconn,
                                                           real64 ( & weight )[MAX_NUM_OF_CONNECTIONS][2],
                                                           real64 ( & dWeight_dVar )[MAX_NUM_OF_CONNECTIONS][2] ) const
 {
+  if( getCachedWeights( iconn, weight, dWeight_dVar ) )
+  {
+    return;
+  }
 
   real64 sumOfTrans = 0.0;
   for( localIndex k=0; k<numPointsInFlux( iconn ); ++k )
@@ -59,6 +59,18 @@ public:
    */
   virtual void solve( Vector const & rhs, Vector & sol ) const = 0;
 
+  /**
+   * @brief Release the numeric factorization, keeping only data that depends on the sparsity pattern.
+   *
+   * The solver is no longer ready() afterwards. A subsequent setup() with a matrix of the same
+   * sparsity pattern may reuse the retained data (e.g. a symbolic factorization).
+   * By default the solver is cleared.
+   */
+  virtual void releaseNumericFactorization()
+  {
+    this->clear();
+  }
+
   /**
    * @brief @return parameters of the solver.
    */
@@ -271,6 +271,34 @@ protected:
     close();
   }
 
+  /**
+   * @brief Update values of a parallel matrix from a local CRS matrix with unchanged sparsity.
+   * @param localMatrix The input local matrix.
+   *
+   * Unlike create(), this keeps the existing distributed structure (row/column maps,
+   * communication patterns) and only overwrites the values of existing nonzero entries.
+   *
+   * @note The sparsity pattern of @p localMatrix must be identical to (or a subset of)
+   *       the one used in the last call to create(); entries outside of it are not allowed.
+   * @todo Replace generic implementation with more efficient ones in each package.
+   */
+  virtual void updateValues( CRSMatrixView< real64 const, globalIndex const > const & localMatrix )
+  {
+    GEOSX_LAI_ASSERT( ready() );
+    GEOSX_LAI_ASSERT_EQ( localMatrix.numRows(), numLocalRows() );
+
+    localMatrix.move( LvArray::MemorySpace::host, false );
+
+    globalIndex const rankOffset = ilower();
+
+    open();
+    for( localIndex localRow = 0; localRow < localMatrix.numRows(); ++localRow )
+    {
+      set( localRow + rankOffset, localMatrix.getColumns( localRow ), localMatrix.getEntries( localRow ) );
+    }
+    close();
+  }
+
   ///@}
 
   /**
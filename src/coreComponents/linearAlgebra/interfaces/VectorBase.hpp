@@ -214,6 +214,39 @@ protected:
    */
   virtual real64 dot( Vector const & vec ) const = 0;
 
+  /**
+   * @brief Dot products with a set of vectors, using a single global reduction.
+   * @param vecs pointers to vectors to dot-product with
+   * @param result output array of dot products, must be the same size as @p vecs
+   */
+  virtual void multiDot( arraySlice1d< Vector const * const > const & vecs,
+                         arraySlice1d< real64 > const & result ) const
+  {
+    GEOSX_LAI_ASSERT( ready() );
+    GEOSX_LAI_ASSERT_EQ( vecs.size(), result.size() );
+
+    array1d< real64 > localResult( vecs.size() );
+    arrayView1d< real64 const > const values = m_values.toViewConst();
+    for( localIndex k = 0; k < vecs.size(); ++k )
+    {
+      GEOSX_LAI_ASSERT( vecs[k]->ready() );
+      GEOSX_LAI_ASSERT_EQ( localSize(), vecs[k]->localSize() );
+
+      arrayView1d< real64 const > const otherValues = vecs[k]->values();
+      RAJA::ReduceSum< parallelHostReduce, real64 > localDot( 0.0 );
+      forAll< parallelHostPolicy >( localSize(), [localDot, values, otherValues]( localIndex const i )
+      {
+        localDot += values[i] * otherValues[i];
+      } );
+      localResult[k] = localDot.get();
+    }
+    MpiWrapper::allReduce( localResult.data(),
+                         result.dataIfContiguous(),
+                         LvArray::integerConversion< int >( localResult.size() ),
+                         MPI_SUM,
+                         comm() );
+  }
+
   /**
    * @brief Update vector <tt>y</tt> as <tt>y</tt> = <tt>x</tt>.
    * @param x vector to copy
@@ -0,0 +1,367 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file BatchedDenseLA.hpp
+ */
+#ifndef GEOSX_LINEARALGEBRA_INTERFACES_BATCHEDDENSELA_HPP_
+#define GEOSX_LINEARALGEBRA_INTERFACES_BATCHEDDENSELA_HPP_
+
+#include "common/DataTypes.hpp"
+#include "common/GEOS_RAJA_Interface.hpp"
+#include "linearAlgebra/interfaces/native/BlockKernels.hpp"
+
+namespace geosx
+{
+
+/**
+ * @struct BatchedDenseLA
+ * @brief Fixed-size dense linear algebra kernels for large batches of small matrices.
+ *
+ * Per-matrix kernels operate on C arrays of compile-time size and can be called from within
+ * element or cell kernels (on host or device). Batched drivers apply them to all matrices stored
+ * in an interleaved layout, in which the batch index has unit stride: entry (i,j) of consecutive
+ * matrices is contiguous in memory, so that loads and stores are vectorized on host and coalesced
+ * on device. This replaces one small LAPACK call per element as done with BlasLapackLA.
+ */
+struct BatchedDenseLA
+{
+  /// Permutation of batched matrix storage (batch, row, column), with unit stride on the batch index
+  using MatrixPermutation = RAJA::PERM_JKI;
+
+  /// Permutation of batched vector storage (batch, row), with unit stride on the batch index
+  using VectorPermutation = RAJA::PERM_JI;
+
+  /// Unit stride dimension of batched storage
+  static constexpr int USD = LvArray::typeManipulation::getStrideOneDimension( MatrixPermutation {} );
+
+  /// Alias for a view of a batch of matrices
+  template< typename T >
+  using BatchMat = arrayView3d< T, USD >;
+
+  /// Alias for a view of a batch of vectors
+  template< typename T >
+  using BatchVec = arrayView2d< T, USD >;
+
+  /**
+   * @name Per-matrix kernels
+   */
+  ///@{
+
+  /**
+   * @brief Solve a linear system.
+   * @tparam N size of the system
+   * @param [inout] A the matrix, overwritten during the elimination
+   * @param [inout] b the right-hand side, overwritten by the solution
+   * @return false if the matrix is singular, true otherwise
+   * @note This is the fixed-size kernel blockKernels::solve() applied to a C array.
+   */
+  template< integer N >
+  GEOSX_HOST_DEVICE
+  static bool solve( real64 (& A)[N][N], real64 (& b)[N] )
+  {
+    return blockKernels::solve< N >( N, &A[0][0], b );
+  }
+
+  /**
+   * @brief Invert a matrix in place.
+   * @tparam N size of the matrix
+   * @param [inout] A the matrix, overwritten by its inverse
+   * @return false if the matrix is singular (@p A is then overwritten by partial eliminations), true otherwise
+   * @note This is the fixed-size kernel blockKernels::invert() applied to a C array.
+   */
+  template< integer N >
+  GEOSX_HOST_DEVICE
+  static bool invert( real64 (& A)[N][N] )
+  {
+    real64 Ainv[N][N];
+    if( !blockKernels::invert< N >( N, &A[0][0], &Ainv[0][0] ) )
+    {
+      return false;
+    }
+    for( integer i = 0; i < N; ++i )
+    {
+      for( integer j = 0; j < N; ++j )
+      {
+        A[i][j] = Ainv[i][j];
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Compute eigenvalues and eigenvectors of a symmetric matrix (cyclic Jacobi method).
+   * @tparam N size of the matrix
+   * @param [inout] A the matrix, overwritten during the iteration
+   * @param [out] lambda eigenvalues in ascending order
+   * @param [out] V eigenvectors (stored as columns, in the order of @p lambda)
+   */
+  template< integer N >
+  GEOSX_HOST_DEVICE
+  static void symmetricEigen( real64 (& A)[N][N], real64 (& lambda)[N], real64 (& V)[N][N] )
+  {
+    real64 normSq = 0.0;
+    for( integer i = 0; i < N; ++i )
+    {
+      for( integer j = 0; j < N; ++j )
+      {
+        normSq += A[i][j] * A[i][j];
+        V[i][j] = ( i == j ) ? 1.0 : 0.0;
+      }
+    }
+
+    integer constexpr maxSweeps = 50;
+    real64 constexpr tolSq = 1e-30;
+    for( integer sweep = 0; sweep < maxSweeps; ++sweep )
+    {
+      real64 offSq = 0.0;
+      for( integer p = 0; p < N; ++p )
+      {
+        for( integer q = p + 1; q < N; ++q )
+        {
+          offSq += A[p][q] * A[p][q];
+        }
+      }
+      if( offSq <= tolSq * normSq )
+      {
+        break;
+      }
+
+      for( integer p = 0; p < N; ++p )
+      {
+        for( integer q = p + 1; q < N; ++q )
+        {
+          if( A[p][q] == 0.0 )
+          {
+            continue;
+          }
+          // Rotation J with J_pp = J_qq = c, J_pq = -J_qp = s, chosen such that (J^T A J)_pq = 0
+          real64 const theta = ( A[q][q] - A[p][p] ) / ( 2.0 * A[p][q] );
+          real64 const t = ( theta >= 0.0 ? 1.0 : -1.0 ) / ( LvArray::math::abs( theta ) + LvArray::math::sqrt( theta * theta + 1.0 ) );
+          real64 const c = 1.0 / LvArray::math::sqrt( t * t + 1.0 );
+          real64 const s = t * c;
+          for( integer k = 0; k < N; ++k )
+          {
+            real64 const akp = A[k][p];
+            real64 const akq = A[k][q];
+            A[k][p] = c * akp - s * akq;
+            A[k][q] = s * akp + c * akq;
+          }
+          for( integer k = 0; k < N; ++k )
+          {
+            real64 const apk = A[p][k];
+            real64 const aqk = A[q][k];
+            A[p][k] = c * apk - s * aqk;
+            A[q][k] = s * apk + c * aqk;
+          }
+          for( integer k = 0; k < N; ++k )
+          {
+            real64 const vkp = V[k][p];
+            real64 const vkq = V[k][q];
+            V[k][p] = c * vkp - s * vkq;
+            V[k][q] = s * vkp + c * vkq;
+          }
+        }
+      }
+    }
+
+    // Sort eigenpairs in ascending order (selection sort, N is small)
+    for( integer i = 0; i < N; ++i )
+    {
+      lambda[i] = A[i][i];
+    }
+    for( integer i = 0; i < N; ++i )
+    {
+      integer m = i;
+      for( integer j = i + 1; j < N; ++j )
+      {
+        if( lambda[j] < lambda[m] )
+        {
+          m = j;
+        }
+      }
+      if( m != i )
+      {
+        real64 const tmp = lambda[i];
+        lambda[i] = lambda[m];
+        lambda[m] = tmp;
+        for( integer k = 0; k < N; ++k )
+        {
+          real64 const v = V[k][i];
+          V[k][i] = V[k][m];
+          V[k][m] = v;
+        }
+      }
+    }
+  }
+
+  ///@}
+
+  /**
+   * @name Batched drivers
+   */
+  ///@{
+
+  /**
+   * @brief Invert all matrices of a batch in place.
+   * @tparam N size of the matrices
+   * @tparam POLICY execution policy
+   * @param [inout] A the matrices, of size (batch, N, N), overwritten by their inverses
+   * @return the number of singular matrices encountered
+   */
+  template< integer N, typename POLICY >
+  static localIndex invert( BatchMat< real64 > const & A )
+  {
+    GEOSX_ASSERT_EQ( A.size( 1 ), N );
+    GEOSX_ASSERT_EQ( A.size( 2 ), N );
+
+    RAJA::ReduceSum< ReducePolicy< POLICY >, localIndex > numSingular( 0 );
+    forAll< POLICY >( A.size( 0 ), [=] GEOSX_HOST_DEVICE ( localIndex const k )
+    {
+      real64 a[N][N];
+      load< N >( A, k, a );
+      if( invert< N >( a ) )
+      {
+        store< N >( a, k, A );
+      }
+      else
+      {
+        numSingular += 1;
+      }
+    } );
+    return numSingular.get();
+  }
+
+  /**
+   * @brief Solve all linear systems of a batch.
+   * @tparam N size of the systems
+   * @tparam POLICY execution policy
+   * @param [in] A the matrices, of size (batch, N, N)
+   * @param [inout] b the right-hand sides, of size (batch, N), overwritten by the solutions
+   * @return the number of singular matrices encountered (the corresponding right-hand sides are unchanged)
+   */
+  template< integer N, typename POLICY >
+  static localIndex solve( BatchMat< real64 const > const & A,
+                           BatchVec< real64 > const & b )
+  {
+    GEOSX_ASSERT_EQ( A.size( 0 ), b.size( 0 ) );
+    GEOSX_ASSERT_EQ( A.size( 1 ), N );
+    GEOSX_ASSERT_EQ( b.size( 1 ), N );
+
+    RAJA::ReduceSum< ReducePolicy< POLICY >, localIndex > numSingular( 0 );
+    forAll< POLICY >( A.size( 0 ), [=] GEOSX_HOST_DEVICE ( localIndex const k )
+    {
+      real64 a[N][N];
+      real64 x[N];
+      load< N >( A, k, a );
+      for( integer i = 0; i < N; ++i )
+      {
+        x[i] = b( k, i );
+      }
+      if( solve< N >( a, x ) )
+      {
+        for( integer i = 0; i < N; ++i )
+        {
+          b( k, i ) = x[i];
+        }
+      }
+      else
+      {
+        numSingular += 1;
+      }
+    } );
+    return numSingular.get();
+  }
+
+  /**
+   * @brief Compute eigenvalues and eigenvectors of all symmetric matrices of a batch.
+   * @tparam N size of the matrices
+   * @tparam POLICY execution policy
+   * @param [in] A the matrices, of size (batch, N, N)
+   * @param [out] lambda eigenvalues in ascending order, of size (batch, N)
+   * @param [out] V eigenvectors stored as columns, of size (batch, N, N)
+   */
+  template< integer N, typename POLICY >
+  static void symmetricEigen( BatchMat< real64 const > const & A,
+                              BatchVec< real64 > const & lambda,
+                              BatchMat< real64 > const & V )
+  {
+    GEOSX_ASSERT_EQ( A.size( 0 ), lambda.size( 0 ) );
+    GEOSX_ASSERT_EQ( A.size( 0 ), V.size( 0 ) );
+
+    forAll< POLICY >( A.size( 0 ), [=] GEOSX_HOST_DEVICE ( localIndex const k )
+    {
+      real64 a[N][N];
+      real64 l[N];
+      real64 v[N][N];
+      load< N >( A, k, a );
+      symmetricEigen< N >( a, l, v );
+      for( integer i = 0; i < N; ++i )
+      {
+        lambda( k, i ) = l[i];
+      }
+      store< N >( v, k, V );
+    } );
+  }
+
+  ///@}
+
+private:
+
+  /**
+   * @brief Copy a matrix of a batch into a local array.
+   * @tparam N size of the matrix
+   * @tparam T value type of the batch
+   * @param A the batch
+   * @param k index of the matrix within the batch
+   * @param a the local array
+   */
+  template< integer N, typename T >
+  GEOSX_HOST_DEVICE
+  static void load( BatchMat< T > const & A, localIndex const k, real64 (& a)[N][N] )
+  {
+    for( integer i = 0; i < N; ++i )
+    {
+      for( integer j = 0; j < N; ++j )
+      {
+        a[i][j] = A( k, i, j );
+      }
+    }
+  }
+
+  /**
+   * @brief Copy a local array into a matrix of a batch.
+   * @tparam N size of the matrix
+   * @param a the local array
+   * @param k index of the matrix within the batch
+   * @param A the batch
+   */
+  template< integer N >
+  GEOSX_HOST_DEVICE
+  static void store( real64 const (&a)[N][N], localIndex const k, BatchMat< real64 > const & A )
+  {
+    for( integer i = 0; i < N; ++i )
+    {
+      for( integer j = 0; j < N; ++j )
+      {
+        A( k, i, j ) = a[i][j];
+      }
+    }
+  }
+};
+
+} // namespace geosx
+
+#endif //GEOSX_LINEARALGEBRA_INTERFACES_BATCHEDDENSELA_HPP_
@@ -50,6 +50,8 @@
 
 #include <umfpack.h>
 
+#include <algorithm>
+
 namespace geosx
 {
 
@@ -108,6 +110,14 @@ SuiteSparse< LAI >::~SuiteSparse() = default;
 namespace
 {
 
+bool samePattern( SuiteSparseData const & data, SuiteSparseData const & other )
+{
+  return data.rowPtr.size() == other.rowPtr.size()
+         && data.colIndices.size() == other.colIndices.size()
+         && std::equal( data.rowPtr.data(), data.rowPtr.data() + data.rowPtr.size(), other.rowPtr.data() )
+         && std::equal( data.colIndices.data(), data.colIndices.data() + data.colIndices.size(), other.colIndices.data() );
+}
+
 void factorize( SuiteSparseData & data, LinearSolverParameters const & params )
 {
   // To be able to use UMFPACK direct solver we need to disable floating point exceptions
@@ -116,30 +126,29 @@ void factorize( SuiteSparseData & data, LinearSolverParameters const & params )
   SSlong status;
   SSlong const numRows = data.rowPtr.size() - 1;
 
-  data.rowPtr.move( LvArray::MemorySpace::host, false );
-  data.colIndices.move( LvArray::MemorySpace::host, false );
-  data.values.move( LvArray::MemorySpace::host, false );
-
-  // symbolic factorization
-  status = umfpack_dl_symbolic( numRows,
-                                numRows,
-                                data.rowPtr.data(),
-                                data.colIndices.data(),
-                                data.values.data(),
-                                &data.symbolic,
-                                data.control,
-                                data.info );
-  if( status < 0 )
+  // symbolic factorization (skipped if reused from a previous setup)
+  if( !data.symbolic )
   {
-    umfpack_dl_report_info( data.control, data.info );
-    umfpack_dl_report_status( data.control, status );
-    GEOSX_ERROR( "SuiteSparse: umfpack_dl_symbolic failed." );
-  }
+    status = umfpack_dl_symbolic( numRows,
+                                  numRows,
+                                  data.rowPtr.data(),
+                                  data.colIndices.data(),
+                                  data.values.data(),
+                                  &data.symbolic,
+                                  data.control,
+                                  data.info );
+    if( status < 0 )
+    {
+      umfpack_dl_report_info( data.control, data.info );
+      umfpack_dl_report_status( data.control, status );
+      GEOSX_ERROR( "SuiteSparse: umfpack_dl_symbolic failed." );
+    }
 
-  // print the symbolic factorization
-  if( params.logLevel > 1 )
-  {
-    umfpack_dl_report_symbolic( data.symbolic, data.control );
+    // print the symbolic factorization
+    if( params.logLevel > 1 )
+    {
+      umfpack_dl_report_symbolic( data.symbolic, data.control );
+    }
   }
 
   // numeric factorization
@@ -178,6 +187,9 @@ void setOptions( SuiteSparseData & data, LinearSolverParameters const & params )
 template< typename LAI >
 void SuiteSparse< LAI >::setup( Matrix const & mat )
 {
+  // Hold on to previous factorization data, its symbolic part may be reused
+  std::unique_ptr< SuiteSparseData > prevData = std::move( m_data );
+
   clear();
   PreconditionerBase< LAI >::setup( mat );
 
@@ -205,6 +217,18 @@ void SuiteSparse< LAI >::setup( Matrix const & mat )
   if( rank == m_workingRank )
   {
     Stopwatch timer( m_result.setupTime );
+
+    m_data->rowPtr.move( LvArray::MemorySpace::host, false );
+    m_data->colIndices.move( LvArray::MemorySpace::host, false );
+    m_data->values.move( LvArray::MemorySpace::host, false );
+
+    // Symbolic factorization only depends on the sparsity pattern and can be carried over
+    if( prevData && prevData->symbolic && samePattern( *m_data, *prevData ) )
+    {
+      std::swap( m_data->symbolic, prevData->symbolic );
+    }
+    prevData.reset();
+
     factorize( *m_data, m_params );
   }
 
@@ -234,6 +258,25 @@ void SuiteSparse< LAI >::clear()
   m_condEst = -1.0;
 }
 
+template< typename LAI >
+void SuiteSparse< LAI >::releaseNumericFactorization()
+{
+  // The pattern is kept along with the symbolic factorization, to be compared at the next setup
+  std::unique_ptr< SuiteSparseData > data = std::move( m_data );
+  clear();
+  if( data && data->symbolic )
+  {
+    if( data->numeric )
+    {
+      umfpack_dl_free_numeric( &data->numeric );
+    }
+    data->values = array1d< double >();
+    data->rhs = array1d< double >();
+    data->sol = array1d< double >();
+    m_data = std::move( data );
+  }
+}
+
 template< typename LAI >
 void SuiteSparse< LAI >::solve( Vector const & rhs,
                                 Vector & sol ) const
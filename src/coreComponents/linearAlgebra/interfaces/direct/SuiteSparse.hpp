@@ -94,6 +94,11 @@ public:
    */
   virtual void clear() override;
 
+  /**
+   * @brief Free the numeric factorization and matrix values, keeping the symbolic factorization.
+   */
+  virtual void releaseNumericFactorization() override;
+
   /**
    * @brief Solve the system with a particular rhs
    * @param [in] rhs system right hand side
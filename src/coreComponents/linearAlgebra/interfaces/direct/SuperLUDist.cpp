@@ -29,6 +29,8 @@
 
 #include <superlu_ddefs.h>
 
+#include <algorithm>
+
 namespace geosx
 {
 
@@ -105,6 +107,25 @@ std::pair< T, T > makeNearSquareGrid( T const N )
   return std::minmax( x, y );
 }
 
+/**
+ * @brief Check whether two local CSR sparsity patterns are identical.
+ * @param rowPtr row pointers of the first pattern
+ * @param colIndices column indices of the first pattern
+ * @param otherRowPtr row pointers of the second pattern
+ * @param otherColIndices column indices of the second pattern
+ * @return @p true if patterns match
+ */
+bool samePattern( arrayView1d< int_t const > const & rowPtr,
+                  arrayView1d< int_t const > const & colIndices,
+                  arrayView1d< int_t const > const & otherRowPtr,
+                  arrayView1d< int_t const > const & otherColIndices )
+{
+  return rowPtr.size() == otherRowPtr.size()
+         && colIndices.size() == otherColIndices.size()
+         && std::equal( rowPtr.data(), rowPtr.data() + rowPtr.size(), otherRowPtr.data() )
+         && std::equal( colIndices.data(), colIndices.data() + colIndices.size(), otherColIndices.data() );
+}
+
 } // namespace
 
 struct SuperLUDistData
@@ -113,6 +134,8 @@ struct SuperLUDistData
   array1d< int_t > colIndices{};      ///< column indices
   array1d< double > values{};         ///< values
   array1d< double > rhs{};            ///< rhs/solution vector values
+  array1d< int_t > patternRowPtr{};     ///< copy of row pointers used in the last factorization
+  array1d< int_t > patternColIndices{}; ///< copy of column indices (SuperLU_Dist may permute them in place)
   SuperMatrix mat{};                  ///< SuperLU_Dist matrix format
   dScalePermstruct_t scalePerm{};     ///< data structure to scale and permute the matrix
   dLUstruct_t lu{};                   ///< data structure to store the LU factorization
@@ -120,15 +143,12 @@ struct SuperLUDistData
   gridinfo_t grid{};                  ///< SuperLU_Dist MPI subdivision of load
   dSOLVEstruct_t solve{};             ///< data structure to solve the matrix
   superlu_dist_options_t options{};   ///< SuperLU_Dist options
+  bool hasFactors = false;            ///< whether the L/U factors are allocated
 
   SuperLUDistData( int_t const numGlobalRows,
                    int_t const numLocalRows,
-                   int_t const numLocalNonzeros,
                    MPI_Comm const & comm )
   {
-    rowPtr.resize( numLocalRows + 1 );
-    colIndices.resize( numLocalNonzeros );
-    values.resize( numLocalNonzeros );
     rhs.resize( numLocalRows );
     dScalePermstructInit( numGlobalRows, numGlobalRows, &scalePerm );
     dLUstructInit( numGlobalRows, &lu );
@@ -146,13 +166,25 @@ struct SuperLUDistData
   {
     // Only cleanup memory taken by the NRformat_loc struct
     // The actual CSR memory is managed by array1d<> objects
-    SUPERLU_FREE( (NRformat_loc *)mat.Store );
+    if( mat.Store )
+    {
+      SUPERLU_FREE( (NRformat_loc *)mat.Store );
+    }
 
     dScalePermstructFree( &scalePerm );
-    dDestroy_LU( mat.nrow, &grid, &lu );
+    releaseFactors();
     dLUstructFree( &lu );
     PStatFree( &stat );
     superlu_gridexit( &grid );
+  }
+
+  void releaseFactors()
+  {
+    if( hasFactors )
+    {
+      dDestroy_LU( mat.nrow, &grid, &lu );
+      hasFactors = false;
+    }
     if( options.SolveInitialized )
     {
       dSolveFinalize( &options, &solve );
@@ -172,6 +204,9 @@ SuperLUDist< LAI >::~SuperLUDist() = default;
 template< typename LAI >
 void SuperLUDist< LAI >::setup( Matrix const & mat )
 {
+  // Hold on to previous factorization data, its permutations and LU structure may be reused
+  std::unique_ptr< SuperLUDistData > prevData = std::move( m_data );
+
   clear();
   Base::setup( mat );
 
@@ -179,14 +214,43 @@ void SuperLUDist< LAI >::setup( Matrix const & mat )
   int_t const numLR = LvArray::integerConversion< int_t >( mat.numLocalRows() );
   int_t const numNZ = LvArray::integerConversion< int_t >( mat.numLocalNonzeros() );
 
-  m_data = std::make_unique< SuperLUDistData >( numGR, numLR, numNZ, mat.comm() );
-  setOptions();
+  array1d< int_t > rowPtr( numLR + 1 );
+  array1d< int_t > colIndices( numNZ );
+  array1d< double > values( numNZ );
 
   typename Matrix::Export matExport;
-  matExport.exportCRS( mat, m_data->rowPtr, m_data->colIndices, m_data->values );
-  m_data->rowPtr.move( LvArray::MemorySpace::host, false );
-  m_data->colIndices.move( LvArray::MemorySpace::host, false );
-  m_data->values.move( LvArray::MemorySpace::host, false );
+  matExport.exportCRS( mat, rowPtr, colIndices, values );
+  rowPtr.move( LvArray::MemorySpace::host, false );
+  colIndices.move( LvArray::MemorySpace::host, false );
+  values.move( LvArray::MemorySpace::host, false );
+
+  // Factorization can only be reused if the sparsity pattern is unchanged on all ranks
+  bool const localSamePattern = prevData
+                                && prevData->mat.nrow == numGR
+                                && samePattern( rowPtr, colIndices, prevData->patternRowPtr, prevData->patternColIndices );
+  bool const reuseFactorization = MpiWrapper::min( static_cast< int >( localSamePattern ), mat.comm() ) > 0;
+
+  if( reuseFactorization )
+  {
+    m_data = std::move( prevData );
+    if( m_data->mat.Store )
+    {
+      SUPERLU_FREE( (NRformat_loc *)m_data->mat.Store );
+      m_data->mat.Store = nullptr;
+    }
+  }
+  else
+  {
+    prevData.reset();
+    m_data = std::make_unique< SuperLUDistData >( numGR, numLR, mat.comm() );
+    setOptions();
+    m_data->patternRowPtr = rowPtr;
+    m_data->patternColIndices = colIndices;
+  }
+
+  m_data->rowPtr = std::move( rowPtr );
+  m_data->colIndices = std::move( colIndices );
+  m_data->values = std::move( values );
 
   dCreate_CompRowLoc_Matrix_dist( &m_data->mat,
                                   numGR,
@@ -203,7 +267,7 @@ void SuperLUDist< LAI >::setup( Matrix const & mat )
 
   {
     Stopwatch timer( m_result.setupTime );
-    factorize();
+    factorize( reuseFactorization );
   }
 }
 
@@ -314,6 +378,27 @@ void SuperLUDist< LAI >::clear()
   m_condEst = -1.0;
 }
 
+template< typename LAI >
+void SuperLUDist< LAI >::releaseNumericFactorization()
+{
+  // The pattern is kept along with the scaling and permutations, to be compared at the next setup
+  std::unique_ptr< SuperLUDistData > data = std::move( m_data );
+  clear();
+  if( data )
+  {
+    data->releaseFactors();
+    if( data->mat.Store )
+    {
+      SUPERLU_FREE( (NRformat_loc *)data->mat.Store );
+      data->mat.Store = nullptr;
+    }
+    data->rowPtr = array1d< int_t >();
+    data->colIndices = array1d< int_t >();
+    data->values = array1d< double >();
+    m_data = std::move( data );
+  }
+}
+
 template< typename LAI >
 void SuperLUDist< LAI >::setOptions()
 {
@@ -335,14 +420,16 @@ void SuperLUDist< LAI >::setOptions()
 }
 
 template< typename LAI >
-void SuperLUDist< LAI >::factorize()
+void SuperLUDist< LAI >::factorize( bool const samePattern )
 {
   // To be able to use SuperLU_Dist solver we need to disable floating point exceptions
   LvArray::system::FloatingPointExceptionGuard guard;
 
   // Call the linear equation solver to factorize the matrix.
+  // With an unchanged pattern, scaling, permutations and symbolic structure of L/U are reused,
+  // or only the column permutation if the factors have been released.
   int info = 0;
-  m_data->options.Fact = DOFACT;
+  m_data->options.Fact = !samePattern ? DOFACT : m_data->hasFactors ? SamePattern_SameRowPerm : SamePattern;
   pdgssvx( &m_data->options,
            &m_data->mat,
            &m_data->scalePerm,
@@ -356,6 +443,7 @@ void SuperLUDist< LAI >::factorize()
            &m_data->stat,
            &info );
   m_data->options.Fact = FACTORED;
+  m_data->hasFactors = true;
 
   if( m_data->options.PrintStat == YES )
   {
@@ -85,6 +85,13 @@ public:
    */
   virtual void clear() override;
 
+  /**
+   * @brief Free the L/U factors and matrix values, keeping the scaling and permutations.
+   *
+   * The next setup with the same sparsity pattern reuses the column permutation (fill-reducing ordering).
+   */
+  virtual void releaseNumericFactorization() override;
+
   /**
    * @brief Solve the system with a particular rhs
    * @param [in] rhs system right hand side
@@ -104,8 +111,11 @@ private:
 
   /**
    * @brief Perform symbolic/numeric factorization of the matrix.
+   * @param samePattern whether the matrix has the same sparsity pattern as the one previously factorized,
+   *                    in which case only the numeric factorization is redone (preceded by the row
+   *                    permutation and L/U structure if the factors have been released)
    */
-  void factorize();
+  void factorize( bool const samePattern );
 
   /**
    * @brief Estimates the condition number of the matrix using LU factors.
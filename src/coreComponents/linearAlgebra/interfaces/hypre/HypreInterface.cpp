@@ -24,6 +24,7 @@
 #include "linearAlgebra/interfaces/hypre/HyprePreconditioner.hpp"
 #include "linearAlgebra/interfaces/hypre/HypreSolver.hpp"
 #include "linearAlgebra/interfaces/hypre/HypreUtils.hpp"
+#include "linearAlgebra/solvers/BlockCRSPreconditioner.hpp"
 
 #include "HYPRE_utilities.h"
 #if defined(GEOSX_USE_HYPRE_CUDA)
@@ -72,6 +73,10 @@ HypreInterface::createSolver( LinearSolverParameters params )
 std::unique_ptr< PreconditionerBase< HypreInterface > >
 geosx::HypreInterface::createPreconditioner( LinearSolverParameters params )
 {
+  if( isNativePreconditioner( params.preconditionerType ) )
+  {
+    return createNativePreconditioner< HypreInterface >( params );
+  }
   return std::make_unique< HyprePreconditioner >( std::move( params ) );
 }
 
@@ -79,6 +84,10 @@ std::unique_ptr< PreconditionerBase< HypreInterface > >
 geosx::HypreInterface::createPreconditioner( LinearSolverParameters params,
                                              array1d< HypreVector > const & nearNullKernel )
 {
+  if( isNativePreconditioner( params.preconditionerType ) )
+  {
+    return createNativePreconditioner< HypreInterface >( params );
+  }
   return std::make_unique< HyprePreconditioner >( std::move( params ), nearNullKernel );
 }
 
@@ -156,6 +156,26 @@ void HypreMatrix::create( CRSMatrixView< real64 const, globalIndex const > const
   } );
 
   createWithLocalSize( localMatrix.numRows(), numLocalColumns, maxRowEntries.get(), comm );
+
+  open();
+  setValuesFromLocalMatrix( localMatrix, false );
+  close();
+}
+
+void HypreMatrix::updateValues( CRSMatrixView< real64 const, globalIndex const > const & localMatrix )
+{
+  GEOSX_LAI_ASSERT( ready() );
+  GEOSX_LAI_ASSERT_EQ( localMatrix.numRows(), numLocalRows() );
+
+  open();
+  setValuesFromLocalMatrix( localMatrix, true );
+  close();
+}
+
+void HypreMatrix::setValuesFromLocalMatrix( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+                                            bool const replace )
+{
+  GEOSX_LAI_ASSERT( !closed() );
   globalIndex const rankOffset = ilower();
 
   array1d< HYPRE_BigInt > rows;
@@ -181,16 +201,29 @@ void HypreMatrix::create( CRSMatrixView< real64 const, globalIndex const > const
   // This is necessary so that localMatrix.getColumns() and localMatrix.getEntries() return device pointers
   localMatrix.move( hypre::memorySpace, false );
 
-  open();
-  GEOSX_HYPRE_CHECK_DEVICE_ERRORS( "before HYPRE_IJMatrixAddToValues2" );
-  GEOSX_LAI_CHECK_ERROR( HYPRE_IJMatrixAddToValues2( m_ij_mat,
+  if( replace )
+  {
+    // Values are overwritten in place within the existing ParCSR structure (no new nonzeros)
+    GEOSX_HYPRE_CHECK_DEVICE_ERRORS( "before HYPRE_IJMatrixSetValues2" );
+    GEOSX_LAI_CHECK_ERROR( HYPRE_IJMatrixSetValues2( m_ij_mat,
                                                      localMatrix.numRows(),
                                                      sizes.data(),
                                                      rows.data(),
                                                      offsets.data(),
                                                      localMatrix.getColumns(),
                                                      localMatrix.getEntries() ) );
-  close();
+  }
+  else
+  {
+    GEOSX_HYPRE_CHECK_DEVICE_ERRORS( "before HYPRE_IJMatrixAddToValues2" );
+    GEOSX_LAI_CHECK_ERROR( HYPRE_IJMatrixAddToValues2( m_ij_mat,
+                                                       localMatrix.numRows(),
+                                                       sizes.data(),
+                                                       rows.data(),
+                                                       offsets.data(),
+                                                       localMatrix.getColumns(),
+                                                       localMatrix.getEntries() ) );
+  }
 }
 
 void HypreMatrix::createWithLocalSize( localIndex const localRows,
@@ -133,6 +133,8 @@ public:
                        localIndex const numLocalColumns,
                        MPI_Comm const & comm ) override;
 
+  virtual void updateValues( CRSMatrixView< real64 const, globalIndex const > const & localMatrix ) override;
+
   virtual void createWithLocalSize( localIndex const localRows,
                                     localIndex const localCols,
                                     localIndex const maxEntriesPerRow,
@@ -416,6 +418,14 @@ private:
    */
   void parCSRtoIJ( HYPRE_ParCSRMatrix const & parCSRMatrix );
 
+  /**
+   * @brief Transfer all rows of a local CRS matrix into the (open) IJ matrix in a single batched call
+   * @param localMatrix the input local matrix
+   * @param replace if @p true, overwrite existing values; otherwise add to them
+   */
+  void setValuesFromLocalMatrix( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+                                 bool const replace );
+
   /**
    * Pointer to underlying HYPRE_IJMatrix type.
    */
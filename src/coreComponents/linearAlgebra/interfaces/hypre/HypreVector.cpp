@@ -178,6 +178,34 @@ real64 HypreVector::dot( HypreVector const & vec ) const
   return result;
 }
 
+void HypreVector::multiDot( arraySlice1d< HypreVector const * const > const & vecs,
+                            arraySlice1d< real64 > const & result ) const
+{
+  GEOSX_LAI_ASSERT( ready() );
+  GEOSX_LAI_ASSERT_EQ( vecs.size(), result.size() );
+
+  array1d< real64 > localResult( vecs.size() );
+  arrayView1d< real64 const > const values = m_values.toViewConst();
+  for( localIndex k = 0; k < vecs.size(); ++k )
+  {
+    GEOSX_LAI_ASSERT( vecs[k]->ready() );
+    GEOSX_LAI_ASSERT_EQ( globalSize(), vecs[k]->globalSize() );
+
+    arrayView1d< real64 const > const otherValues = vecs[k]->values();
+    RAJA::ReduceSum< ReducePolicy< hypre::execPolicy >, real64 > localDot( 0.0 );
+    forAll< hypre::execPolicy >( localSize(), [localDot, values, otherValues] GEOSX_HYPRE_DEVICE ( localIndex const i )
+    {
+      localDot += values[i] * otherValues[i];
+    } );
+    localResult[k] = localDot.get();
+  }
+  MpiWrapper::allReduce( localResult.data(),
+                         result.dataIfContiguous(),
+                         LvArray::integerConversion< int >( localResult.size() ),
+                         MPI_SUM,
+                         comm() );
+}
+
 void HypreVector::copy( HypreVector const & x )
 {
   GEOSX_LAI_ASSERT( ready() );
@@ -130,6 +130,12 @@ public:
 
   virtual real64 dot( HypreVector const & vec ) const override;
 
+  /**
+   * @copydoc VectorBase<HypreVector>::multiDot
+   */
+  virtual void multiDot( arraySlice1d< HypreVector const * const > const & vecs,
+                         arraySlice1d< real64 > const & result ) const override;
+
   virtual void copy( HypreVector const & x ) override;
 
   virtual void axpy( real64 const alpha,
@@ -0,0 +1,687 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file BlockCRSMatrix.cpp
+ */
+
+#include "BlockCRSMatrix.hpp"
+
+#include "linearAlgebra/common/common.hpp"
+#include "linearAlgebra/interfaces/native/BlockKernels.hpp"
+#include "mesh/mpiCommunications/CommunicationTools.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace geosx
+{
+
+namespace
+{
+
+/**
+ * @brief Block sparse matrix-vector product kernel.
+ * @tparam ROW_MAP type of the row map
+ * @param numRows number of block rows to multiply
+ * @param rowMap callable that maps a loop index into a local block row index
+ * @param numBlockRows number of local block rows
+ * @param blockSize the block size
+ * @param rowOffsets block row offsets
+ * @param colIndices local block column indices
+ * @param values block values
+ * @param src local input vector values
+ * @param ghostValues input vector values at ghost block columns
+ * @param includeGhosts whether to multiply ghost block columns
+ * @param dst local output vector values
+ */
+template< typename ROW_MAP >
+void blockSpMV( localIndex const numRows,
+                ROW_MAP const rowMap,
+                localIndex const numBlockRows,
+                integer const blockSize,
+                arrayView1d< localIndex const > const & rowOffsets,
+                arrayView1d< localIndex const > const & colIndices,
+                arrayView1d< real64 const > const & values,
+                arrayView1d< real64 const > const & src,
+                arrayView1d< real64 const > const & ghostValues,
+                bool const includeGhosts,
+                arrayView1d< real64 > const & dst )
+{
+  blockKernels::dispatch( blockSize, [&]( auto NB )
+  {
+    integer constexpr N = decltype( NB )::value;
+    forAll< parallelHostPolicy >( numRows, [=]( localIndex const r )
+    {
+      localIndex const i = rowMap( r );
+      integer const bs = N > 0 ? N : blockSize;
+      real64 sum[ N > 0 ? N : blockKernels::maxBlockSize ]{};
+      for( localIndex k = rowOffsets[i]; k < rowOffsets[i + 1]; ++k )
+      {
+        localIndex const j = colIndices[k];
+        if( j < numBlockRows )
+        {
+          blockKernels::gemv< N >( bs, 1.0, &values[k * bs * bs], &src[j * bs], sum );
+        }
+        else if( includeGhosts )
+        {
+          blockKernels::gemv< N >( bs, 1.0, &values[k * bs * bs], &ghostValues[( j - numBlockRows ) * bs], sum );
+        }
+      }
+      for( integer c = 0; c < bs; ++c )
+      {
+        dst[i * bs + c] = sum[c];
+      }
+    } );
+  } );
+}
+
+} // namespace
+
+template< typename ROW_VISITOR >
+void BlockCRSMatrix::createImpl( localIndex const numLocalRows,
+                                 globalIndex const rankOffset,
+                                 integer const blockSize,
+                                 MPI_Comm const & comm,
+                                 ROW_VISITOR const & visitRow )
+{
+  GEOSX_ERROR_IF_LE_MSG( blockSize, 0, "BlockCRSMatrix: block size must be positive" );
+  GEOSX_ERROR_IF_GT_MSG( blockSize, blockKernels::maxBlockSize, "BlockCRSMatrix: block size not supported" );
+  GEOSX_ERROR_IF_NE_MSG( numLocalRows % blockSize, 0, "BlockCRSMatrix: number of local rows must be a multiple of block size" );
+  GEOSX_ERROR_IF_NE_MSG( rankOffset % blockSize, 0, "BlockCRSMatrix: rank offset must be a multiple of block size" );
+
+  reset();
+  m_blockSize = blockSize;
+  m_rankOffset = rankOffset;
+  m_comm = comm;
+  m_numGlobalRows = MpiWrapper::sum( LvArray::integerConversion< globalIndex >( numLocalRows ), comm );
+
+  localIndex const numBlockRows = numLocalRows / blockSize;
+  globalIndex const blockOffset = rankOffset / blockSize;
+
+  // Collect sorted global block columns of each block row
+  std::vector< globalIndex > blockCols;
+  std::vector< globalIndex > rowBlockCols;
+  m_rowOffsets.resize( numBlockRows + 1 );
+  for( localIndex i = 0; i < numBlockRows; ++i )
+  {
+    rowBlockCols.clear();
+    for( integer r = 0; r < blockSize; ++r )
+    {
+      visitRow( i * blockSize + r, [&]( globalIndex const col, real64 const )
+      {
+        rowBlockCols.push_back( col / blockSize );
+      } );
+    }
+    std::sort( rowBlockCols.begin(), rowBlockCols.end() );
+    rowBlockCols.erase( std::unique( rowBlockCols.begin(), rowBlockCols.end() ), rowBlockCols.end() );
+    blockCols.insert( blockCols.end(), rowBlockCols.begin(), rowBlockCols.end() );
+    m_rowOffsets[i + 1] = LvArray::integerConversion< localIndex >( blockCols.size() );
+  }
+
+  // Collect ghost block columns
+  std::vector< globalIndex > ghostBlocks;
+  for( globalIndex const gb : blockCols )
+  {
+    if( gb < blockOffset || gb >= blockOffset + numBlockRows )
+    {
+      ghostBlocks.push_back( gb );
+    }
+  }
+  std::sort( ghostBlocks.begin(), ghostBlocks.end() );
+  ghostBlocks.erase( std::unique( ghostBlocks.begin(), ghostBlocks.end() ), ghostBlocks.end() );
+  m_ghostBlocks.resize( LvArray::integerConversion< localIndex >( ghostBlocks.size() ) );
+  std::copy( ghostBlocks.begin(), ghostBlocks.end(), m_ghostBlocks.data() );
+
+  // Convert to local block column indices, sorted within each row
+  m_colIndices.resize( LvArray::integerConversion< localIndex >( blockCols.size() ) );
+  m_diagIndices.resize( numBlockRows );
+  for( localIndex i = 0; i < numBlockRows; ++i )
+  {
+    for( localIndex k = m_rowOffsets[i]; k < m_rowOffsets[i + 1]; ++k )
+    {
+      globalIndex const gb = blockCols[k];
+      if( gb >= blockOffset && gb < blockOffset + numBlockRows )
+      {
+        m_colIndices[k] = LvArray::integerConversion< localIndex >( gb - blockOffset );
+      }
+      else
+      {
+        m_colIndices[k] = numBlockRows + std::distance( ghostBlocks.begin(),
+                                                        std::lower_bound( ghostBlocks.begin(), ghostBlocks.end(), gb ) );
+      }
+    }
+    localIndex const rowLength = m_rowOffsets[i + 1] - m_rowOffsets[i];
+    localIndex * const rowCols = m_colIndices.data() + m_rowOffsets[i];
+    std::sort( rowCols, rowCols + rowLength );
+    localIndex const pos = std::distance( rowCols, std::lower_bound( rowCols, rowCols + rowLength, i ) );
+    m_diagIndices[i] = ( pos < rowLength && rowCols[pos] == i ) ? m_rowOffsets[i] + pos : -1;
+  }
+
+  m_values.resize( m_colIndices.size() * blockSize * blockSize );
+  fillValues( visitRow );
+
+  setupCommunication();
+  classifyRows();
+}
+
+void BlockCRSMatrix::classifyRows()
+{
+  // Ghost block columns are numbered last, so it is enough to check the last column of each row
+  localIndex const numBlockRows = numLocalBlockRows();
+  m_interiorRows.clear();
+  m_boundaryRows.clear();
+  for( localIndex i = 0; i < numBlockRows; ++i )
+  {
+    bool const boundary = m_rowOffsets[i + 1] > m_rowOffsets[i] && m_colIndices[m_rowOffsets[i + 1] - 1] >= numBlockRows;
+    if( boundary )
+    {
+      m_boundaryRows.emplace_back( i );
+    }
+    else
+    {
+      m_interiorRows.emplace_back( i );
+    }
+  }
+}
+
+template< typename ROW_VISITOR >
+void BlockCRSMatrix::fillValues( ROW_VISITOR const & visitRow )
+{
+  m_values.zero();
+
+  integer const bs = m_blockSize;
+  localIndex const numBlockRows = numLocalBlockRows();
+  globalIndex const blockOffset = m_rankOffset / bs;
+  globalIndex const * const ghostBegin = m_ghostBlocks.data();
+  globalIndex const * const ghostEnd = ghostBegin + m_ghostBlocks.size();
+
+  arrayView1d< localIndex const > const rowOffsets = m_rowOffsets.toViewConst();
+  arrayView1d< localIndex const > const colIndices = m_colIndices.toViewConst();
+  arrayView1d< real64 > const values = m_values.toView();
+
+  // Each block row only writes into its own blocks, so rows can be processed concurrently
+  forAll< parallelHostPolicy >( numBlockRows, [&]( localIndex const i )
+  {
+    localIndex const * const rowBegin = colIndices.data() + rowOffsets[i];
+    localIndex const * const rowEnd = colIndices.data() + rowOffsets[i + 1];
+    for( integer r = 0; r < bs; ++r )
+    {
+      visitRow( i * bs + r, [&]( globalIndex const col, real64 const value )
+      {
+        globalIndex const gb = col / bs;
+        localIndex const lb = ( gb >= blockOffset && gb < blockOffset + numBlockRows )
+                              ? LvArray::integerConversion< localIndex >( gb - blockOffset )
+                              : numBlockRows + std::distance( ghostBegin, std::lower_bound( ghostBegin, ghostEnd, gb ) );
+        localIndex const * const pos = std::lower_bound( rowBegin, rowEnd, lb );
+        GEOSX_ERROR_IF( pos == rowEnd || *pos != lb, "BlockCRSMatrix: entry outside of the block sparsity pattern" );
+        localIndex const k = rowOffsets[i] + std::distance( rowBegin, pos );
+        values[( k * bs + r ) * bs + LvArray::integerConversion< integer >( col % bs )] += value;
+      } );
+    }
+  } );
+}
+
+void BlockCRSMatrix::create( arrayView1d< globalIndex const > const & rowOffsets,
+                             arrayView1d< globalIndex const > const & colIndices,
+                             arrayView1d< real64 const > const & values,
+                             globalIndex const rankOffset,
+                             integer const blockSize,
+                             MPI_Comm const & comm )
+{
+  rowOffsets.move( LvArray::MemorySpace::host, false );
+  colIndices.move( LvArray::MemorySpace::host, false );
+  values.move( LvArray::MemorySpace::host, false );
+
+  createImpl( rowOffsets.size() - 1, rankOffset, blockSize, comm,
+              [&]( localIndex const row, auto && func )
+  {
+    for( globalIndex k = rowOffsets[row]; k < rowOffsets[row + 1]; ++k )
+    {
+      func( colIndices[k], values[k] );
+    }
+  } );
+}
+
+void BlockCRSMatrix::create( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+                             globalIndex const rankOffset,
+                             integer const blockSize,
+                             MPI_Comm const & comm )
+{
+  localMatrix.move( LvArray::MemorySpace::host, false );
+
+  createImpl( localMatrix.numRows(), rankOffset, blockSize, comm,
+              [&]( localIndex const row, auto && func )
+  {
+    arraySlice1d< globalIndex const > const cols = localMatrix.getColumns( row );
+    arraySlice1d< real64 const > const vals = localMatrix.getEntries( row );
+    for( localIndex k = 0; k < cols.size(); ++k )
+    {
+      func( cols[k], vals[k] );
+    }
+  } );
+}
+
+void BlockCRSMatrix::updateValues( CRSMatrixView< real64 const, globalIndex const > const & localMatrix )
+{
+  GEOSX_LAI_ASSERT( ready() );
+  GEOSX_LAI_ASSERT_EQ( localMatrix.numRows(), numLocalRows() );
+
+  localMatrix.move( LvArray::MemorySpace::host, false );
+
+  fillValues( [&]( localIndex const row, auto && func )
+  {
+    arraySlice1d< globalIndex const > const cols = localMatrix.getColumns( row );
+    arraySlice1d< real64 const > const vals = localMatrix.getEntries( row );
+    for( localIndex k = 0; k < cols.size(); ++k )
+    {
+      func( cols[k], vals[k] );
+    }
+  } );
+}
+
+void BlockCRSMatrix::updateValues( arrayView1d< globalIndex const > const & rowOffsets,
+                                   arrayView1d< globalIndex const > const & colIndices,
+                                   arrayView1d< real64 const > const & values )
+{
+  GEOSX_LAI_ASSERT( ready() );
+  GEOSX_LAI_ASSERT_EQ( rowOffsets.size() - 1, numLocalRows() );
+
+  rowOffsets.move( LvArray::MemorySpace::host, false );
+  colIndices.move( LvArray::MemorySpace::host, false );
+  values.move( LvArray::MemorySpace::host, false );
+
+  fillValues( [&]( localIndex const row, auto && func )
+  {
+    for( globalIndex k = rowOffsets[row]; k < rowOffsets[row + 1]; ++k )
+    {
+      func( colIndices[k], values[k] );
+    }
+  } );
+}
+
+void BlockCRSMatrix::reset()
+{
+  m_blockSize = 0;
+  m_numGlobalRows = 0;
+  m_rankOffset = 0;
+  m_comm = MPI_COMM_NULL;
+  m_rowOffsets.clear();
+  m_colIndices.clear();
+  m_values.clear();
+  m_diagIndices.clear();
+  m_ghostBlocks.clear();
+  m_recvRanks.clear();
+  m_recvOffsets.clear();
+  m_sendRanks.clear();
+  m_sendOffsets.clear();
+  m_sendBlocks.clear();
+  m_sendBuffer.clear();
+  m_ghostValues.clear();
+  m_interiorRows.clear();
+  m_boundaryRows.clear();
+}
+
+void BlockCRSMatrix::createOverlap( BlockCRSMatrix & overlap ) const
+{
+  GEOSX_LAI_ASSERT( ready() );
+
+  integer const bs = m_blockSize;
+  integer const bs2 = bs * bs;
+  localIndex const numBlockRows = numLocalBlockRows();
+  localIndex const numGhosts = m_ghostBlocks.size();
+  globalIndex const blockOffset = m_rankOffset / bs;
+  localIndex const numRecvRanks = m_recvRanks.size();
+  localIndex const numSendRanks = m_sendRanks.size();
+
+  // Pack rows of locally owned blocks that are ghosts on neighbors, with global block columns
+  localIndex const numSendRows = m_sendBlocks.size();
+  array1d< int > sendRowLengths( numSendRows );
+  array1d< localIndex > sendRowOffsets( numSendRows + 1 );
+  for( localIndex k = 0; k < numSendRows; ++k )
+  {
+    localIndex const i = m_sendBlocks[k];
+    sendRowLengths[k] = LvArray::integerConversion< int >( m_rowOffsets[i + 1] - m_rowOffsets[i] );
+    sendRowOffsets[k + 1] = sendRowOffsets[k] + sendRowLengths[k];
+  }
+
+  array1d< globalIndex > sendCols( sendRowOffsets[numSendRows] );
+  array1d< real64 > sendValues( sendRowOffsets[numSendRows] * bs2 );
+  for( localIndex k = 0; k < numSendRows; ++k )
+  {
+    localIndex const i = m_sendBlocks[k];
+    for( localIndex ij = m_rowOffsets[i]; ij < m_rowOffsets[i + 1]; ++ij )
+    {
+      localIndex const pos = sendRowOffsets[k] + ij - m_rowOffsets[i];
+      localIndex const j = m_colIndices[ij];
+      sendCols[pos] = j < numBlockRows ? blockOffset + j : m_ghostBlocks[j - numBlockRows];
+      std::copy( &m_values[ij * bs2], &m_values[ij * bs2] + bs2, &sendValues[pos * bs2] );
+    }
+  }
+
+  // Exchange row lengths
+  CommID commID = CommunicationTools::getInstance().getCommID();
+  int const tag = commID;
+  std::vector< MPI_Request > requests( 2 * ( numRecvRanks + numSendRanks ), MPI_REQUEST_NULL );
+  array1d< int > recvRowLengths( numGhosts );
+  for( localIndex n = 0; n < numRecvRanks; ++n )
+  {
+    MpiWrapper::iRecv( recvRowLengths.data() + m_recvOffsets[n],
+                       LvArray::integerConversion< int >( m_recvOffsets[n + 1] - m_recvOffsets[n] ),
+                       m_recvRanks[n], tag, m_comm, &requests[n] );
+  }
+  for( localIndex n = 0; n < numSendRanks; ++n )
+  {
+    MpiWrapper::iSend( sendRowLengths.data() + m_sendOffsets[n],
+                       LvArray::integerConversion< int >( m_sendOffsets[n + 1] - m_sendOffsets[n] ),
+                       m_sendRanks[n], tag, m_comm, &requests[numRecvRanks + n] );
+  }
+  MpiWrapper::waitAll( LvArray::integerConversion< int >( requests.size() ), requests.data(), MPI_STATUSES_IGNORE );
+
+  array1d< localIndex > recvRowOffsets( numGhosts + 1 );
+  for( localIndex g = 0; g < numGhosts; ++g )
+  {
+    recvRowOffsets[g + 1] = recvRowOffsets[g] + recvRowLengths[g];
+  }
+
+  // Exchange columns and values of ghost rows (messages between a pair of ranks are matched in order)
+  array1d< globalIndex > recvCols( recvRowOffsets[numGhosts] );
+  array1d< real64 > recvValues( recvRowOffsets[numGhosts] * bs2 );
+  localIndex const numRequests = numRecvRanks + numSendRanks;
+  for( localIndex n = 0; n < numRecvRanks; ++n )
+  {
+    localIndex const offset = recvRowOffsets[m_recvOffsets[n]];
+    int const count = LvArray::integerConversion< int >( recvRowOffsets[m_recvOffsets[n + 1]] - offset );
+    MpiWrapper::iRecv( recvCols.data() + offset, count, m_recvRanks[n], tag, m_comm, &requests[n] );
+    MpiWrapper::iRecv( recvValues.data() + offset * bs2, count * bs2, m_recvRanks[n], tag, m_comm, &requests[numRequests + n] );
+  }
+  for( localIndex n = 0; n < numSendRanks; ++n )
+  {
+    localIndex const offset = sendRowOffsets[m_sendOffsets[n]];
+    int const count = LvArray::integerConversion< int >( sendRowOffsets[m_sendOffsets[n + 1]] - offset );
+    MpiWrapper::iSend( sendCols.data() + offset, count, m_sendRanks[n], tag, m_comm, &requests[numRecvRanks + n] );
+    MpiWrapper::iSend( sendValues.data() + offset * bs2, count * bs2, m_sendRanks[n], tag, m_comm,
+                       &requests[numRequests + numRecvRanks + n] );
+  }
+  MpiWrapper::waitAll( LvArray::integerConversion< int >( requests.size() ), requests.data(), MPI_STATUSES_IGNORE );
+
+  // Owned rows are copied as is, since ghost block columns are already numbered after owned ones
+  localIndex const numOverlapRows = numBlockRows + numGhosts;
+  std::vector< localIndex > cols( m_colIndices.data(), m_colIndices.data() + m_colIndices.size() );
+  std::vector< real64 > vals( m_values.data(), m_values.data() + m_values.size() );
+
+  overlap.reset();
+  overlap.m_blockSize = bs;
+  overlap.m_numGlobalRows = numOverlapRows * bs;
+  overlap.m_comm = MPI_COMM_SELF;
+  overlap.m_rowOffsets.resize( numOverlapRows + 1 );
+  std::copy( m_rowOffsets.data(), m_rowOffsets.data() + numBlockRows + 1, overlap.m_rowOffsets.data() );
+
+  // Ghost rows are restricted to the overlap column set and sorted by overlap column index
+  globalIndex const * const ghostBegin = m_ghostBlocks.data();
+  globalIndex const * const ghostEnd = ghostBegin + numGhosts;
+  std::vector< std::pair< localIndex, localIndex > > rowEntries;
+  for( localIndex g = 0; g < numGhosts; ++g )
+  {
+    rowEntries.clear();
+    for( localIndex k = recvRowOffsets[g]; k < recvRowOffsets[g + 1]; ++k )
+    {
+      globalIndex const gb = recvCols[k];
+      if( gb >= blockOffset && gb < blockOffset + numBlockRows )
+      {
+        rowEntries.emplace_back( LvArray::integerConversion< localIndex >( gb - blockOffset ), k );
+      }
+      else
+      {
+        globalIndex const * const pos = std::lower_bound( ghostBegin, ghostEnd, gb );
+        if( pos != ghostEnd && *pos == gb )
+        {
+          rowEntries.emplace_back( numBlockRows + std::distance( ghostBegin, pos ), k );
+        }
+      }
+    }
+    std::sort( rowEntries.begin(), rowEntries.end() );
+    for( std::pair< localIndex, localIndex > const & entry : rowEntries )
+    {
+      cols.push_back( entry.first );
+      vals.insert( vals.end(), &recvValues[entry.second * bs2], &recvValues[entry.second * bs2] + bs2 );
+    }
+    overlap.m_rowOffsets[numBlockRows + g + 1] = LvArray::integerConversion< localIndex >( cols.size() );
+  }
+
+  overlap.m_colIndices.resize( LvArray::integerConversion< localIndex >( cols.size() ) );
+  std::copy( cols.begin(), cols.end(), overlap.m_colIndices.data() );
+  overlap.m_values.resize( LvArray::integerConversion< localIndex >( vals.size() ) );
+  std::copy( vals.begin(), vals.end(), overlap.m_values.data() );
+
+  overlap.m_diagIndices.resize( numOverlapRows );
+  for( localIndex i = 0; i < numOverlapRows; ++i )
+  {
+    localIndex const * const rowBegin = overlap.m_colIndices.data() + overlap.m_rowOffsets[i];
+    localIndex const * const rowEnd = overlap.m_colIndices.data() + overlap.m_rowOffsets[i + 1];
+    localIndex const * const pos = std::lower_bound( rowBegin, rowEnd, i );
+    overlap.m_diagIndices[i] = ( pos != rowEnd && *pos == i ) ? overlap.m_rowOffsets[i] + std::distance( rowBegin, pos ) : -1;
+  }
+  overlap.classifyRows();
+}
+
+void BlockCRSMatrix::setupCommunication()
+{
+  int const myRank = MpiWrapper::commRank( m_comm );
+  int const numRanks = MpiWrapper::commSize( m_comm );
+  globalIndex const blockOffset = m_rankOffset / m_blockSize;
+
+  // Ghost blocks are sorted, hence grouped by owning rank
+  array1d< globalIndex > rankBlockOffsets;
+  MpiWrapper::allGather( blockOffset, rankBlockOffsets, m_comm );
+
+  m_recvOffsets.emplace_back( 0 );
+  for( localIndex k = 0; k < m_ghostBlocks.size(); ++k )
+  {
+    // The last rank whose offset does not exceed the block index is the owner (skips ranks without rows)
+    globalIndex const * const offsetsBegin = rankBlockOffsets.data();
+    globalIndex const * const offsetsEnd = offsetsBegin + rankBlockOffsets.size();
+    int const owner = LvArray::integerConversion< int >( std::distance( offsetsBegin,
+                                                                        std::upper_bound( offsetsBegin, offsetsEnd, m_ghostBlocks[k] ) ) ) - 1;
+    if( m_recvRanks.empty() || m_recvRanks.back() != owner )
+    {
+      if( !m_recvRanks.empty() )
+      {
+        m_recvOffsets.emplace_back( k );
+      }
+      m_recvRanks.emplace_back( owner );
+    }
+  }
+  if( !m_recvRanks.empty() )
+  {
+    m_recvOffsets.emplace_back( m_ghostBlocks.size() );
+  }
+
+  // Discover ranks that need locally owned blocks by gathering all neighbor lists (padded to equal size)
+  int const maxNumRecvRanks = MpiWrapper::max( LvArray::integerConversion< int >( m_recvRanks.size() ), m_comm );
+  array1d< int > paddedRecvRanks( maxNumRecvRanks );
+  paddedRecvRanks.setValues< serialPolicy >( -1 );
+  std::copy( m_recvRanks.data(), m_recvRanks.data() + m_recvRanks.size(), paddedRecvRanks.data() );
+
+  array1d< int > allRecvRanks;
+  MpiWrapper::allGather( paddedRecvRanks.toViewConst(), allRecvRanks, m_comm );
+  for( int rank = 0; rank < numRanks; ++rank )
+  {
+    for( int n = 0; n < maxNumRecvRanks; ++n )
+    {
+      if( allRecvRanks[rank * maxNumRecvRanks + n] == myRank )
+      {
+        m_sendRanks.emplace_back( rank );
+      }
+    }
+  }
+
+  localIndex const numRecvRanks = m_recvRanks.size();
+  localIndex const numSendRanks = m_sendRanks.size();
+  CommID commID = CommunicationTools::getInstance().getCommID();
+  int const tag = commID;
+  std::vector< MPI_Request > requests( numRecvRanks + numSendRanks, MPI_REQUEST_NULL );
+
+  // Exchange the number of requested blocks
+  array1d< int > recvCounts( numRecvRanks );
+  array1d< int > sendCounts( numSendRanks );
+  for( localIndex n = 0; n < numSendRanks; ++n )
+  {
+    MpiWrapper::iRecv( &sendCounts[n], 1, m_sendRanks[n], tag, m_comm, &requests[n] );
+  }
+  for( localIndex n = 0; n < numRecvRanks; ++n )
+  {
+    recvCounts[n] = LvArray::integerConversion< int >( m_recvOffsets[n + 1] - m_recvOffsets[n] );
+    MpiWrapper::iSend( &recvCounts[n], 1, m_recvRanks[n], tag, m_comm, &requests[numSendRanks + n] );
+  }
+  MpiWrapper::waitAll( LvArray::integerConversion< int >( requests.size() ), requests.data(), MPI_STATUSES_IGNORE );
+
+  m_sendOffsets.resize( numSendRanks + 1 );
+  for( localIndex n = 0; n < numSendRanks; ++n )
+  {
+    m_sendOffsets[n + 1] = m_sendOffsets[n] + sendCounts[n];
+  }
+
+  // Exchange global indices of requested blocks
+  array1d< globalIndex > sendGlobalBlocks( m_sendOffsets[numSendRanks] );
+  for( localIndex n = 0; n < numSendRanks; ++n )
+  {
+    MpiWrapper::iRecv( sendGlobalBlocks.data() + m_sendOffsets[n], sendCounts[n],
+                       m_sendRanks[n], tag, m_comm, &requests[n] );
+  }
+  for( localIndex n = 0; n < numRecvRanks; ++n )
+  {
+    MpiWrapper::iSend( m_ghostBlocks.data() + m_recvOffsets[n], recvCounts[n],
+                       m_recvRanks[n], tag, m_comm, &requests[numSendRanks + n] );
+  }
+  MpiWrapper::waitAll( LvArray::integerConversion< int >( requests.size() ), requests.data(), MPI_STATUSES_IGNORE );
+
+  m_sendBlocks.resize( sendGlobalBlocks.size() );
+  for( localIndex k = 0; k < sendGlobalBlocks.size(); ++k )
+  {
+    GEOSX_LAI_ASSERT_GE( sendGlobalBlocks[k], blockOffset );
+    GEOSX_LAI_ASSERT_GT( blockOffset + numLocalBlockRows(), sendGlobalBlocks[k] );
+    m_sendBlocks[k] = LvArray::integerConversion< localIndex >( sendGlobalBlocks[k] - blockOffset );
+  }
+
+  m_sendBuffer.resize( m_sendBlocks.size() * m_blockSize );
+  m_ghostValues.resize( m_ghostBlocks.size() * m_blockSize );
+}
+
+void BlockCRSMatrix::startGhostExchange( arrayView1d< real64 const > const & src ) const
+{
+  GEOSX_LAI_ASSERT( !m_exchangeCommID );
+
+  // The ID is taken on every rank, including ranks without neighbors, so that all ranks
+  // draw the same sequence of IDs from the shared pool
+  m_exchangeCommID = std::make_unique< CommID >( CommunicationTools::getInstance().getCommID() );
+
+  localIndex const numRecvRanks = m_recvRanks.size();
+  localIndex const numSendRanks = m_sendRanks.size();
+  if( numRecvRanks + numSendRanks == 0 )
+  {
+    return;
+  }
+
+  integer const bs = m_blockSize;
+  int const tag = *m_exchangeCommID;
+  m_requests.assign( numRecvRanks + numSendRanks, MPI_REQUEST_NULL );
+
+  m_ghostValues.move( LvArray::MemorySpace::host, false );
+  for( localIndex n = 0; n < numRecvRanks; ++n )
+  {
+    MpiWrapper::iRecv( m_ghostValues.data() + m_recvOffsets[n] * bs,
+                       LvArray::integerConversion< int >( ( m_recvOffsets[n + 1] - m_recvOffsets[n] ) * bs ),
+                       m_recvRanks[n], tag, m_comm, &m_requests[n] );
+  }
+
+  arrayView1d< localIndex const > const sendBlocks = m_sendBlocks.toViewConst();
+  arrayView1d< real64 > const sendBuffer = m_sendBuffer.toView();
+  forAll< parallelHostPolicy >( sendBlocks.size(), [=]( localIndex const k )
+  {
+    for( integer r = 0; r < bs; ++r )
+    {
+      sendBuffer[k * bs + r] = src[sendBlocks[k] * bs + r];
+    }
+  } );
+
+  for( localIndex n = 0; n < numSendRanks; ++n )
+  {
+    MpiWrapper::iSend( m_sendBuffer.data() + m_sendOffsets[n] * bs,
+                       LvArray::integerConversion< int >( ( m_sendOffsets[n + 1] - m_sendOffsets[n] ) * bs ),
+                       m_sendRanks[n], tag, m_comm, &m_requests[numRecvRanks + n] );
+  }
+}
+
+void BlockCRSMatrix::finishGhostExchange() const
+{
+  if( !m_requests.empty() )
+  {
+    MpiWrapper::waitAll( LvArray::integerConversion< int >( m_requests.size() ), m_requests.data(), MPI_STATUSES_IGNORE );
+    m_requests.clear();
+  }
+  m_exchangeCommID.reset();
+}
+
+void BlockCRSMatrix::exchangeGhosts( arrayView1d< real64 const > const & src ) const
+{
+  startGhostExchange( src );
+  finishGhostExchange();
+}
+
+void BlockCRSMatrix::apply( arrayView1d< real64 const > const & src,
+                            arrayView1d< real64 > const & dst ) const
+{
+  GEOSX_LAI_ASSERT( ready() );
+  GEOSX_LAI_ASSERT_EQ( src.size(), numLocalRows() );
+  GEOSX_LAI_ASSERT_EQ( dst.size(), numLocalRows() );
+
+  src.move( LvArray::MemorySpace::host, false );
+  dst.move( LvArray::MemorySpace::host, true );
+
+  // Interior rows do not reference ghost columns and are multiplied while ghost values are in flight
+  startGhostExchange( src );
+
+  arrayView1d< localIndex const > const interiorRows = m_interiorRows.toViewConst();
+  blockSpMV( interiorRows.size(), [=]( localIndex const r ) { return interiorRows[r]; },
+             numLocalBlockRows(), m_blockSize,
+             m_rowOffsets.toViewConst(), m_colIndices.toViewConst(), m_values.toViewConst(),
+             src, m_ghostValues.toViewConst(), false, dst );
+
+  finishGhostExchange();
+
+  arrayView1d< localIndex const > const boundaryRows = m_boundaryRows.toViewConst();
+  blockSpMV( boundaryRows.size(), [=]( localIndex const r ) { return boundaryRows[r]; },
+             numLocalBlockRows(), m_blockSize,
+             m_rowOffsets.toViewConst(), m_colIndices.toViewConst(), m_values.toViewConst(),
+             src, m_ghostValues.toViewConst(), true, dst );
+}
+
+void BlockCRSMatrix::applyLocal( arrayView1d< real64 const > const & src,
+                                 arrayView1d< real64 > const & dst ) const
+{
+  GEOSX_LAI_ASSERT( ready() );
+  GEOSX_LAI_ASSERT_EQ( src.size(), numLocalRows() );
+  GEOSX_LAI_ASSERT_EQ( dst.size(), numLocalRows() );
+
+  src.move( LvArray::MemorySpace::host, false );
+  dst.move( LvArray::MemorySpace::host, true );
+
+  blockSpMV( numLocalBlockRows(), []( localIndex const r ) { return r; },
+             numLocalBlockRows(), m_blockSize,
+             m_rowOffsets.toViewConst(), m_colIndices.toViewConst(), m_values.toViewConst(),
+             src, m_ghostValues.toViewConst(), false, dst );
+}
+
+} // namespace geosx
@@ -0,0 +1,338 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file BlockCRSMatrix.hpp
+ */
+
+#ifndef GEOSX_LINEARALGEBRA_INTERFACES_NATIVE_BLOCKCRSMATRIX_HPP_
+#define GEOSX_LINEARALGEBRA_INTERFACES_NATIVE_BLOCKCRSMATRIX_HPP_
+
+#include "common/DataTypes.hpp"
+#include "common/MpiWrapper.hpp"
+#include "mesh/mpiCommunications/CommID.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace geosx
+{
+
+/**
+ * @brief Distributed block-sparse (BSR) matrix with dense square blocks of uniform size.
+ *
+ * Rows are distributed across ranks in contiguous ranges aligned with block boundaries.
+ * Each rank stores its block rows with block columns numbered locally: owned block columns
+ * come first (in global order), followed by ghost block columns, which are received from
+ * the owning ranks on every application of the operator. Within each block row, block columns
+ * are sorted by local index. Blocks are stored contiguously in row-major order.
+ *
+ * Compared to a scalar CSR format, index storage is reduced by a factor of blockSize^2 and
+ * the multiplication kernel operates on dense blocks with compile-time sizes.
+ */
+class BlockCRSMatrix
+{
+public:
+
+  /**
+   * @brief Create the matrix from local rows in scalar CSR format.
+   * @param rowOffsets row offsets of the local rows
+   * @param colIndices global column indices
+   * @param values entry values
+   * @param rankOffset global index of the first local row
+   * @param blockSize size of dense blocks
+   * @param comm the MPI communicator
+   *
+   * The number of local rows and @p rankOffset must be multiples of @p blockSize.
+   * Missing entries within a nonzero block are stored as explicit zeros.
+   */
+  void create( arrayView1d< globalIndex const > const & rowOffsets,
+               arrayView1d< globalIndex const > const & colIndices,
+               arrayView1d< real64 const > const & values,
+               globalIndex const rankOffset,
+               integer const blockSize,
+               MPI_Comm const & comm );
+
+  /**
+   * @brief Create the matrix from a local CRS matrix.
+   * @param localMatrix local rows with global column indices
+   * @param rankOffset global index of the first local row
+   * @param blockSize size of dense blocks
+   * @param comm the MPI communicator
+   */
+  void create( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+               globalIndex const rankOffset,
+               integer const blockSize,
+               MPI_Comm const & comm );
+
+  /**
+   * @brief Update matrix values, keeping the block sparsity pattern.
+   * @param localMatrix local rows with global column indices
+   *
+   * The pattern of @p localMatrix must be contained in the block pattern of the matrix.
+   */
+  void updateValues( CRSMatrixView< real64 const, globalIndex const > const & localMatrix );
+
+  /**
+   * @brief Update matrix values from local rows in scalar CSR format, keeping the block sparsity pattern.
+   * @param rowOffsets row offsets of the local rows
+   * @param colIndices global column indices
+   * @param values entry values
+   *
+   * The pattern of the input must be contained in the block pattern of the matrix.
+   */
+  void updateValues( arrayView1d< globalIndex const > const & rowOffsets,
+                     arrayView1d< globalIndex const > const & colIndices,
+                     arrayView1d< real64 const > const & values );
+
+  /**
+   * @brief Reset the matrix to default state.
+   */
+  void reset();
+
+  /**
+   * @brief Apply operator to a vector, <tt>dst = this(src)</tt>.
+   * @param src local values of the input vector
+   * @param dst local values of the output vector
+   *
+   * Rows without ghost columns (interior) are multiplied while the ghost exchange is in progress,
+   * the remaining (boundary) rows once ghost values have been received.
+   */
+  void apply( arrayView1d< real64 const > const & src,
+              arrayView1d< real64 > const & dst ) const;
+
+  /**
+   * @brief Apply the rank-local part of the operator (without ghost columns) to a vector.
+   * @param src local values of the input vector
+   * @param dst local values of the output vector
+   */
+  void applyLocal( arrayView1d< real64 const > const & src,
+                   arrayView1d< real64 > const & dst ) const;
+
+  /**
+   * @brief Create the rank-local overlapping matrix extended by one layer of ghost block rows.
+   * @param overlap the output matrix
+   *
+   * The rows of @p overlap are the locally owned block rows followed by the rows of ghost blocks
+   * (in the order of local ghost indices), restricted to columns within that set. The result has
+   * no ghost columns and lives on MPI_COMM_SELF. Used by overlapping domain decomposition methods.
+   */
+  void createOverlap( BlockCRSMatrix & overlap ) const;
+
+  /**
+   * @brief Receive values of ghost block columns from neighbors.
+   * @param src local values of the input vector
+   *
+   * Received values can be accessed through getGhostValues().
+   */
+  void exchangeGhosts( arrayView1d< real64 const > const & src ) const;
+
+  /**
+   * @brief Post receives of ghost values and sends of locally owned values requested by neighbors.
+   * @param src local values of the input vector
+   *
+   * Must be followed by finishGhostExchange() before ghost values are accessed.
+   */
+  void startGhostExchange( arrayView1d< real64 const > const & src ) const;
+
+  /**
+   * @brief Wait for completion of the ghost exchange started by startGhostExchange().
+   */
+  void finishGhostExchange() const;
+
+  /**
+   * @brief @return whether the matrix has been created
+   */
+  bool ready() const { return m_blockSize > 0; }
+
+  /**
+   * @brief @return the size of dense blocks
+   */
+  integer blockSize() const { return m_blockSize; }
+
+  /**
+   * @brief @return number of locally owned block rows
+   */
+  localIndex numLocalBlockRows() const { return m_rowOffsets.empty() ? 0 : m_rowOffsets.size() - 1; }
+
+  /**
+   * @brief @return number of local block rows that do not reference ghost block columns
+   */
+  localIndex numInteriorBlockRows() const { return m_interiorRows.size(); }
+
+  /**
+   * @brief @return number of local block rows that reference ghost block columns
+   */
+  localIndex numBoundaryBlockRows() const { return m_boundaryRows.size(); }
+
+  /**
+   * @brief @return number of ghost block columns
+   */
+  localIndex numGhostBlocks() const { return m_ghostBlocks.size(); }
+
+  /**
+   * @brief @return number of locally owned (scalar) rows
+   */
+  localIndex numLocalRows() const { return numLocalBlockRows() * m_blockSize; }
+
+  /**
+   * @brief @return global number of (scalar) rows
+   */
+  globalIndex numGlobalRows() const { return m_numGlobalRows; }
+
+  /**
+   * @brief @return number of locally stored nonzero blocks
+   */
+  localIndex numLocalNonzeroBlocks() const { return m_colIndices.size(); }
+
+  /**
+   * @brief @return global index of the first local (scalar) row
+   */
+  globalIndex ilower() const { return m_rankOffset; }
+
+  /**
+   * @brief @return the MPI communicator
+   */
+  MPI_Comm comm() const { return m_comm; }
+
+  /**
+   * @brief @return block row offsets
+   */
+  arrayView1d< localIndex const > getRowOffsets() const { return m_rowOffsets.toViewConst(); }
+
+  /**
+   * @brief @return local block column indices
+   */
+  arrayView1d< localIndex const > getColumns() const { return m_colIndices.toViewConst(); }
+
+  /**
+   * @brief @return block values (blockSize^2 entries per block)
+   */
+  arrayView1d< real64 const > getValues() const { return m_values.toViewConst(); }
+
+  /**
+   * @brief @return position of the diagonal block in each block row (-1 if absent)
+   */
+  arrayView1d< localIndex const > getDiagIndices() const { return m_diagIndices.toViewConst(); }
+
+  /**
+   * @brief @return global indices of ghost block columns
+   */
+  arrayView1d< globalIndex const > getGhostBlocks() const { return m_ghostBlocks.toViewConst(); }
+
+  /**
+   * @brief @return values at ghost block columns received in the last exchange
+   */
+  arrayView1d< real64 const > getGhostValues() const { return m_ghostValues.toViewConst(); }
+
+private:
+
+  /**
+   * @brief Set up the communication pattern for ghost block columns.
+   */
+  void setupCommunication();
+
+  /**
+   * @brief Split local block rows into interior and boundary rows.
+   */
+  void classifyRows();
+
+  /**
+   * @brief Create the block sparsity pattern and fill values.
+   * @tparam ROW_VISITOR type of row visitor
+   * @param numLocalRows number of local (scalar) rows
+   * @param rankOffset global index of the first local row
+   * @param blockSize size of dense blocks
+   * @param comm the MPI communicator
+   * @param visitRow callable that, given a local row index and a functor, calls the functor on each (column, value) pair
+   */
+  template< typename ROW_VISITOR >
+  void createImpl( localIndex const numLocalRows,
+                   globalIndex const rankOffset,
+                   integer const blockSize,
+                   MPI_Comm const & comm,
+                   ROW_VISITOR const & visitRow );
+
+  /**
+   * @brief Fill block values from scalar rows.
+   * @tparam ROW_VISITOR type of row visitor
+   * @param visitRow callable that, given a local row index and a functor, calls the functor on each (column, value) pair
+   */
+  template< typename ROW_VISITOR >
+  void fillValues( ROW_VISITOR const & visitRow );
+
+  /// Size of dense blocks
+  integer m_blockSize = 0;
+
+  /// Global number of rows
+  globalIndex m_numGlobalRows = 0;
+
+  /// Global index of the first local row
+  globalIndex m_rankOffset = 0;
+
+  /// MPI communicator
+  MPI_Comm m_comm = MPI_COMM_NULL;
+
+  /// Block row offsets
+  array1d< localIndex > m_rowOffsets;
+
+  /// Local block column indices
+  array1d< localIndex > m_colIndices;
+
+  /// Block values
+  array1d< real64 > m_values;
+
+  /// Position of the diagonal block in each block row
+  array1d< localIndex > m_diagIndices;
+
+  /// Global indices of ghost block columns, sorted (and therefore grouped by owning rank)
+  array1d< globalIndex > m_ghostBlocks;
+
+  /// Ranks owning ghost block columns
+  array1d< int > m_recvRanks;
+
+  /// Offsets of each receiving rank's ghost blocks in m_ghostBlocks
+  array1d< localIndex > m_recvOffsets;
+
+  /// Ranks requesting locally owned blocks
+  array1d< int > m_sendRanks;
+
+  /// Offsets of each sending rank's blocks in m_sendBlocks
+  array1d< localIndex > m_sendOffsets;
+
+  /// Local indices of blocks to send
+  array1d< localIndex > m_sendBlocks;
+
+  /// Buffer for sending block values
+  array1d< real64 > mutable m_sendBuffer;
+
+  /// Buffer for received ghost values
+  array1d< real64 > mutable m_ghostValues;
+
+  /// Local block rows that do not reference ghost block columns
+  array1d< localIndex > m_interiorRows;
+
+  /// Local block rows that reference ghost block columns
+  array1d< localIndex > m_boundaryRows;
+
+  /// Requests of the ghost exchange in progress
+  std::vector< MPI_Request > mutable m_requests;
+
+  /// Communication ID (message tag) held by the ghost exchange in progress
+  std::unique_ptr< CommID > mutable m_exchangeCommID;
+};
+
+} // namespace geosx
+
+#endif //GEOSX_LINEARALGEBRA_INTERFACES_NATIVE_BLOCKCRSMATRIX_HPP_
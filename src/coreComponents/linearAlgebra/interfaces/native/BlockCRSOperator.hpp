@@ -0,0 +1,190 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file BlockCRSOperator.hpp
+ */
+
+#ifndef GEOSX_LINEARALGEBRA_INTERFACES_NATIVE_BLOCKCRSOPERATOR_HPP_
+#define GEOSX_LINEARALGEBRA_INTERFACES_NATIVE_BLOCKCRSOPERATOR_HPP_
+
+#include "linearAlgebra/common/LinearOperator.hpp"
+#include "linearAlgebra/common/common.hpp"
+#include "linearAlgebra/interfaces/native/BlockCRSMatrix.hpp"
+
+namespace geosx
+{
+
+/**
+ * @brief Linear operator that applies a native block-CRS copy of a parallel matrix.
+ * @tparam LAI linear algebra interface providing vectors and matrices
+ *
+ * Used as the Krylov operator when the native block-CRS preconditioner is selected
+ * (see SolverBase::solveSystem), so that matrix-vector products of multi-component systems
+ * use the blocked kernels, with the ghost exchange overlapped with the interior rows.
+ * Other preconditioners keep the SpMV of the linear algebra package.
+ */
+template< typename LAI >
+class BlockCRSOperator : public LinearOperator< typename LAI::ParallelVector >
+{
+public:
+
+  /// Alias for base type
+  using Base = LinearOperator< typename LAI::ParallelVector >;
+
+  /// Alias for vector type
+  using Vector = typename Base::Vector;
+
+  /// Alias for matrix type
+  using Matrix = typename LAI::ParallelMatrix;
+
+  /**
+   * @brief Create the block operator from a parallel matrix.
+   * @param mat the source matrix
+   * @param blockSize size of dense blocks
+   *
+   * The whole matrix is exported from the linear algebra package. Use the overload taking the local
+   * rows when they are available.
+   */
+  void setup( Matrix const & mat, integer const blockSize )
+  {
+    GEOSX_LAI_ASSERT( mat.ready() );
+    GEOSX_LAI_ASSERT_MSG( mat.numLocalRows() == mat.numLocalCols(), "Matrix must be square" );
+
+    array1d< globalIndex > rowOffsets( mat.numLocalRows() + 1 );
+    array1d< globalIndex > colIndices( mat.numLocalNonzeros() );
+    array1d< real64 > values( mat.numLocalNonzeros() );
+
+    typename Matrix::Export exporter;
+    exporter.exportCRS( mat, rowOffsets.toView(), colIndices.toView(), values.toView() );
+
+    m_matrix.create( rowOffsets.toViewConst(),
+                     colIndices.toViewConst(),
+                     values.toViewConst(),
+                     mat.ilower(),
+                     blockSize,
+                     mat.comm() );
+  }
+
+  /**
+   * @brief Create the block operator from the local rows a parallel matrix was assembled from.
+   * @param localMatrix local rows with global column indices
+   * @param rankOffset global index of the first local row
+   * @param blockSize size of dense blocks
+   * @param comm the MPI communicator
+   */
+  void setup( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+              globalIndex const rankOffset,
+              integer const blockSize,
+              MPI_Comm const & comm )
+  {
+    m_matrix.create( localMatrix, rankOffset, blockSize, comm );
+  }
+
+  /**
+   * @brief Update the operator values from a parallel matrix with the same sparsity pattern.
+   * @param mat the source matrix
+   *
+   * The whole matrix is exported from the linear algebra package. Use the overload taking the local
+   * rows when they are available.
+   */
+  void updateValues( Matrix const & mat )
+  {
+    GEOSX_LAI_ASSERT( mat.ready() );
+    GEOSX_LAI_ASSERT_EQ( mat.numLocalRows(), numLocalRows() );
+
+    array1d< globalIndex > rowOffsets( mat.numLocalRows() + 1 );
+    array1d< globalIndex > colIndices( mat.numLocalNonzeros() );
+    array1d< real64 > values( mat.numLocalNonzeros() );
+
+    typename Matrix::Export exporter;
+    exporter.exportCRS( mat, rowOffsets.toView(), colIndices.toView(), values.toView() );
+
+    m_matrix.updateValues( rowOffsets.toViewConst(), colIndices.toViewConst(), values.toViewConst() );
+  }
+
+  /**
+   * @brief Update the operator values in place from local rows with the same sparsity pattern.
+   * @param localMatrix local rows with global column indices
+   */
+  void updateValues( CRSMatrixView< real64 const, globalIndex const > const & localMatrix )
+  {
+    GEOSX_LAI_ASSERT_EQ( localMatrix.numRows(), numLocalRows() );
+    m_matrix.updateValues( localMatrix );
+  }
+
+  /**
+   * @brief @return whether the operator has been set up
+   */
+  bool ready() const
+  {
+    return m_matrix.ready();
+  }
+
+  /**
+   * @brief Apply operator to a vector, <tt>dst = this(src)</tt>.
+   * @param src input vector
+   * @param dst output vector
+   */
+  virtual void apply( Vector const & src, Vector & dst ) const override
+  {
+    GEOSX_LAI_ASSERT_EQ( src.localSize(), numLocalCols() );
+    GEOSX_LAI_ASSERT_EQ( dst.localSize(), numLocalRows() );
+
+    m_matrix.apply( src.values(), dst.open() );
+    dst.close();
+  }
+
+  virtual globalIndex numGlobalRows() const override
+  {
+    return m_matrix.numGlobalRows();
+  }
+
+  virtual globalIndex numGlobalCols() const override
+  {
+    return m_matrix.numGlobalRows();
+  }
+
+  virtual localIndex numLocalRows() const override
+  {
+    return m_matrix.numLocalRows();
+  }
+
+  virtual localIndex numLocalCols() const override
+  {
+    return m_matrix.numLocalRows();
+  }
+
+  virtual MPI_Comm comm() const override
+  {
+    return m_matrix.comm();
+  }
+
+  /**
+   * @brief @return the underlying block matrix
+   */
+  BlockCRSMatrix const & matrix() const
+  {
+    return m_matrix;
+  }
+
+private:
+
+  /// Block-CRS copy of the matrix
+  BlockCRSMatrix m_matrix;
+};
+
+} // namespace geosx
+
+#endif //GEOSX_LINEARALGEBRA_INTERFACES_NATIVE_BLOCKCRSOPERATOR_HPP_
@@ -0,0 +1,264 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file BlockKernels.hpp
+ */
+
+#ifndef GEOSX_LINEARALGEBRA_INTERFACES_NATIVE_BLOCKKERNELS_HPP_
+#define GEOSX_LINEARALGEBRA_INTERFACES_NATIVE_BLOCKKERNELS_HPP_
+
+#include "common/DataTypes.hpp"
+#include "linearAlgebra/common/common.hpp"
+
+#include <type_traits>
+
+namespace geosx
+{
+
+/**
+ * @brief Kernels operating on small dense square blocks stored in row-major order.
+ *
+ * All kernels are templated on the block size @p N, so that loops are fully unrolled
+ * and vectorized by the compiler for the common small sizes. A value of @p N = 0
+ * selects the generic version operating on a runtime block size.
+ */
+namespace blockKernels
+{
+
+/// Max block size supported by native block kernels
+static constexpr integer maxBlockSize = 16;
+
+/**
+ * @brief Call a generic lambda with a compile-time block size.
+ * @tparam LAMBDA type of the lambda
+ * @param blockSize the runtime block size
+ * @param lambda the lambda, called with a std::integral_constant argument (0 for sizes not explicitly instantiated)
+ */
+template< typename LAMBDA >
+void dispatch( integer const blockSize, LAMBDA && lambda )
+{
+  switch( blockSize )
+  {
+    case 1: lambda( std::integral_constant< integer, 1 >{} ); break;
+    case 2: lambda( std::integral_constant< integer, 2 >{} ); break;
+    case 3: lambda( std::integral_constant< integer, 3 >{} ); break;
+    case 4: lambda( std::integral_constant< integer, 4 >{} ); break;
+    case 5: lambda( std::integral_constant< integer, 5 >{} ); break;
+    case 6: lambda( std::integral_constant< integer, 6 >{} ); break;
+    default: lambda( std::integral_constant< integer, 0 >{} ); break;
+  }
+}
+
+/**
+ * @brief Compute <tt>y += alpha * A * x</tt> for a block @p A.
+ * @tparam N compile-time block size (0 for runtime)
+ * @tparam T type of block values (products are accumulated in double precision)
+ * @param n runtime block size
+ * @param alpha scaling factor
+ * @param A the block
+ * @param x input vector
+ * @param y output vector
+ */
+template< integer N, typename T >
+GEOSX_HOST_DEVICE inline
+void gemv( integer const n,
+           real64 const alpha,
+           T const * const GEOSX_RESTRICT A,
+           real64 const * const GEOSX_RESTRICT x,
+           real64 * const GEOSX_RESTRICT y )
+{
+  integer const bs = N > 0 ? N : n;
+  for( integer i = 0; i < bs; ++i )
+  {
+    real64 sum = 0.0;
+    for( integer j = 0; j < bs; ++j )
+    {
+      sum += A[i * bs + j] * x[j];
+    }
+    y[i] += alpha * sum;
+  }
+}
+
+/**
+ * @brief Compute <tt>C += alpha * A * B</tt> for blocks @p A, @p B and @p C.
+ * @tparam N compile-time block size (0 for runtime)
+ * @param n runtime block size
+ * @param alpha scaling factor
+ * @param A first input block
+ * @param B second input block
+ * @param C output block
+ */
+template< integer N >
+GEOSX_HOST_DEVICE inline
+void gemm( integer const n,
+           real64 const alpha,
+           real64 const * const GEOSX_RESTRICT A,
+           real64 const * const GEOSX_RESTRICT B,
+           real64 * const GEOSX_RESTRICT C )
+{
+  integer const bs = N > 0 ? N : n;
+  for( integer i = 0; i < bs; ++i )
+  {
+    for( integer k = 0; k < bs; ++k )
+    {
+      real64 const a = alpha * A[i * bs + k];
+      for( integer j = 0; j < bs; ++j )
+      {
+        C[i * bs + j] += a * B[k * bs + j];
+      }
+    }
+  }
+}
+
+/**
+ * @brief Invert a block using Gauss-Jordan elimination with partial pivoting.
+ * @tparam N compile-time block size (0 for runtime)
+ * @param n runtime block size
+ * @param A the block to invert, overwritten on output
+ * @param Ainv the inverse
+ * @return @p false if the block is numerically singular, @p true otherwise
+ */
+template< integer N >
+GEOSX_HOST_DEVICE inline
+bool invert( integer const n,
+             real64 * const GEOSX_RESTRICT A,
+             real64 * const GEOSX_RESTRICT Ainv )
+{
+  integer const bs = N > 0 ? N : n;
+  for( integer i = 0; i < bs; ++i )
+  {
+    for( integer j = 0; j < bs; ++j )
+    {
+      Ainv[i * bs + j] = ( i == j ) ? 1.0 : 0.0;
+    }
+  }
+
+  for( integer k = 0; k < bs; ++k )
+  {
+    // Find pivot row
+    integer p = k;
+    for( integer i = k + 1; i < bs; ++i )
+    {
+      if( LvArray::math::abs( A[i * bs + k] ) > LvArray::math::abs( A[p * bs + k] ) )
+      {
+        p = i;
+      }
+    }
+    if( A[p * bs + k] == 0.0 )
+    {
+      return false;
+    }
+    if( p != k )
+    {
+      for( integer j = 0; j < bs; ++j )
+      {
+        real64 tmp = A[k * bs + j]; A[k * bs + j] = A[p * bs + j]; A[p * bs + j] = tmp;
+        tmp = Ainv[k * bs + j]; Ainv[k * bs + j] = Ainv[p * bs + j]; Ainv[p * bs + j] = tmp;
+      }
+    }
+
+    // Normalize pivot row
+    real64 const pivInv = 1.0 / A[k * bs + k];
+    for( integer j = 0; j < bs; ++j )
+    {
+      A[k * bs + j] *= pivInv;
+      Ainv[k * bs + j] *= pivInv;
+    }
+
+    // Eliminate the column from all other rows
+    for( integer i = 0; i < bs; ++i )
+    {
+      if( i != k )
+      {
+        real64 const f = A[i * bs + k];
+        for( integer j = 0; j < bs; ++j )
+        {
+          A[i * bs + j] -= f * A[k * bs + j];
+          Ainv[i * bs + j] -= f * Ainv[k * bs + j];
+        }
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Solve a linear system with a block using Gaussian elimination with partial pivoting.
+ * @tparam N compile-time block size (0 for runtime)
+ * @param n runtime block size
+ * @param A the block, overwritten on output
+ * @param b the right-hand side, overwritten by the solution
+ * @return @p false if the block is numerically singular (@p b is then partially overwritten), @p true otherwise
+ */
+template< integer N >
+GEOSX_HOST_DEVICE inline
+bool solve( integer const n,
+            real64 * const GEOSX_RESTRICT A,
+            real64 * const GEOSX_RESTRICT b )
+{
+  integer const bs = N > 0 ? N : n;
+  for( integer k = 0; k < bs; ++k )
+  {
+    // Find pivot row
+    integer p = k;
+    for( integer i = k + 1; i < bs; ++i )
+    {
+      if( LvArray::math::abs( A[i * bs + k] ) > LvArray::math::abs( A[p * bs + k] ) )
+      {
+        p = i;
+      }
+    }
+    if( A[p * bs + k] == 0.0 )
+    {
+      return false;
+    }
+    if( p != k )
+    {
+      for( integer j = k; j < bs; ++j )
+      {
+        real64 const tmp = A[k * bs + j]; A[k * bs + j] = A[p * bs + j]; A[p * bs + j] = tmp;
+      }
+      real64 const tmp = b[k]; b[k] = b[p]; b[p] = tmp;
+    }
+
+    // Eliminate the column below the pivot
+    for( integer i = k + 1; i < bs; ++i )
+    {
+      real64 const f = A[i * bs + k] / A[k * bs + k];
+      for( integer j = k + 1; j < bs; ++j )
+      {
+        A[i * bs + j] -= f * A[k * bs + j];
+      }
+      b[i] -= f * b[k];
+    }
+  }
+
+  // Back substitution
+  for( integer i = bs - 1; i >= 0; --i )
+  {
+    for( integer j = i + 1; j < bs; ++j )
+    {
+      b[i] -= A[i * bs + j] * b[j];
+    }
+    b[i] /= A[i * bs + i];
+  }
+  return true;
+}
+
+} // namespace blockKernels
+
+} // namespace geosx
+
+#endif //GEOSX_LINEARALGEBRA_INTERFACES_NATIVE_BLOCKKERNELS_HPP_
@@ -22,6 +22,7 @@
 #include "linearAlgebra/interfaces/direct/SuperLUDist.hpp"
 #include "linearAlgebra/interfaces/petsc/PetscPreconditioner.hpp"
 #include "linearAlgebra/interfaces/petsc/PetscSolver.hpp"
+#include "linearAlgebra/solvers/BlockCRSPreconditioner.hpp"
 
 #include <petscsys.h>
 
@@ -64,6 +65,10 @@ PetscInterface::createSolver( LinearSolverParameters params )
 std::unique_ptr< PreconditionerBase< PetscInterface > >
 PetscInterface::createPreconditioner( LinearSolverParameters params )
 {
+  if( isNativePreconditioner( params.preconditionerType ) )
+  {
+    return createNativePreconditioner< PetscInterface >( params );
+  }
   return std::make_unique< PetscPreconditioner >( params );
 }
 
@@ -71,6 +76,10 @@ std::unique_ptr< PreconditionerBase< PetscInterface > >
 PetscInterface::createPreconditioner( LinearSolverParameters params,
                                       array1d< PetscVector > const & nearNullKernel )
 {
+  if( isNativePreconditioner( params.preconditionerType ) )
+  {
+    return createNativePreconditioner< PetscInterface >( params );
+  }
   return std::make_unique< PetscPreconditioner >( params, nearNullKernel );
 }
 
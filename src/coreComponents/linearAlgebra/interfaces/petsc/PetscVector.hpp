@@ -99,6 +99,7 @@ public:
   using VectorBase::open;
   using VectorBase::zero;
   using VectorBase::values;
+  using VectorBase::multiDot;
 
   /**
    * @copydoc VectorBase<PetscVector>::created
@@ -158,6 +158,35 @@ void EpetraMatrix::zero()
   set( 0 );
 }
 
+void EpetraMatrix::updateValues( CRSMatrixView< real64 const, globalIndex const > const & localMatrix )
+{
+  GEOSX_LAI_ASSERT( ready() );
+  GEOSX_LAI_ASSERT_EQ( localMatrix.numRows(), numLocalRows() );
+
+  localMatrix.move( LvArray::MemorySpace::host, false );
+
+  // All rows are locally owned and the matrix remains fill-complete, so values can be
+  // replaced directly using local indices, without a global assembly or communication.
+  Epetra_Map const & colMap = m_matrix->ColMap();
+  globalIndex const rankOffset = ilower();
+
+  array1d< int > localCols;
+  for( localIndex localRow = 0; localRow < localMatrix.numRows(); ++localRow )
+  {
+    arraySlice1d< globalIndex const > const cols = localMatrix.getColumns( localRow );
+    localCols.resize( cols.size() );
+    for( localIndex k = 0; k < cols.size(); ++k )
+    {
+      localCols[k] = colMap.LID( cols[k] );
+    }
+    int const myRow = m_matrix->LRID( localRow + rankOffset );
+    GEOSX_LAI_CHECK_ERROR( m_matrix->ReplaceMyValues( myRow,
+                                                      LvArray::integerConversion< int >( cols.size() ),
+                                                      localMatrix.getEntries( localRow ).dataIfContiguous(),
+                                                      localCols.data() ) );
+  }
+}
+
 void EpetraMatrix::open()
 {
   GEOSX_LAI_ASSERT( created() && closed() );
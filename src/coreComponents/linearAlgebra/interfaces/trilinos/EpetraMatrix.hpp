@@ -118,6 +118,8 @@ public:
                                      localIndex const maxEntriesPerRow,
                                      MPI_Comm const & comm ) override;
 
+  virtual void updateValues( CRSMatrixView< real64 const, globalIndex const > const & localMatrix ) override;
+
   virtual void open() override;
 
   virtual void close() override;
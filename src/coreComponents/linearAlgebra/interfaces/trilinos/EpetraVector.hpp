@@ -88,6 +88,7 @@ public:
   using VectorBase::open;
   using VectorBase::zero;
   using VectorBase::values;
+  using VectorBase::multiDot;
 
   /**
    * @copydoc VectorBase<EpetraVector>::created
@@ -22,6 +22,7 @@
 #include "linearAlgebra/interfaces/direct/SuperLUDist.hpp"
 #include "linearAlgebra/interfaces/trilinos/TrilinosPreconditioner.hpp"
 #include "linearAlgebra/interfaces/trilinos/TrilinosSolver.hpp"
+#include "linearAlgebra/solvers/BlockCRSPreconditioner.hpp"
 
 namespace geosx
 {
@@ -55,6 +56,10 @@ TrilinosInterface::createSolver( LinearSolverParameters params )
 std::unique_ptr< PreconditionerBase< TrilinosInterface > >
 TrilinosInterface::createPreconditioner( LinearSolverParameters params )
 {
+  if( isNativePreconditioner( params.preconditionerType ) )
+  {
+    return createNativePreconditioner< TrilinosInterface >( params );
+  }
   return std::make_unique< TrilinosPreconditioner >( params );
 }
 
@@ -62,6 +67,10 @@ std::unique_ptr< PreconditionerBase< TrilinosInterface > >
 TrilinosInterface::createPreconditioner( LinearSolverParameters params,
                                          array1d< EpetraVector > const & nearNullKernel )
 {
+  if( isNativePreconditioner( params.preconditionerType ) )
+  {
+    return createNativePreconditioner< TrilinosInterface >( params );
+  }
   return std::make_unique< TrilinosPreconditioner >( params, nearNullKernel );
 }
 
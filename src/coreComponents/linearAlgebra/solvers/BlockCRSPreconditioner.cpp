@@ -0,0 +1,534 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file BlockCRSPreconditioner.cpp
+ */
+
+#include "BlockCRSPreconditioner.hpp"
+
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "linearAlgebra/interfaces/native/BlockKernels.hpp"
+
+#include <algorithm>
+
+namespace geosx
+{
+
+namespace
+{
+
+/**
+ * @brief Group block rows into levels for threaded triangular solves.
+ * @param blockMatrix the block matrix
+ * @param lower whether to schedule the lower (forward) or upper (backward) triangular part
+ * @param levelOffsets offsets of each level in @p levelRows
+ * @param levelRows block rows sorted by level
+ *
+ * The level of a row is one more than the maximum level of the rows it depends on,
+ * so that all rows within a level can be processed concurrently.
+ */
+void computeLevelSchedule( BlockCRSMatrix const & blockMatrix,
+                           bool const lower,
+                           array1d< localIndex > & levelOffsets,
+                           array1d< localIndex > & levelRows )
+{
+  localIndex const numBlockRows = blockMatrix.numLocalBlockRows();
+  arrayView1d< localIndex const > const rowOffsets = blockMatrix.getRowOffsets();
+  arrayView1d< localIndex const > const colIndices = blockMatrix.getColumns();
+  arrayView1d< localIndex const > const diagIndices = blockMatrix.getDiagIndices();
+
+  array1d< localIndex > level( numBlockRows );
+  localIndex numLevels = 0;
+  for( localIndex r = 0; r < numBlockRows; ++r )
+  {
+    localIndex const i = lower ? r : numBlockRows - 1 - r;
+    localIndex const begin = lower ? rowOffsets[i] : diagIndices[i] + 1;
+    localIndex const end = lower ? diagIndices[i] : rowOffsets[i + 1];
+    localIndex rowLevel = 0;
+    for( localIndex ij = begin; ij < end && colIndices[ij] < numBlockRows; ++ij )
+    {
+      rowLevel = std::max( rowLevel, level[colIndices[ij]] + 1 );
+    }
+    level[i] = rowLevel;
+    numLevels = std::max( numLevels, rowLevel + 1 );
+  }
+
+  // Counting sort of rows by level (rows within a level remain in ascending order)
+  levelOffsets.resize( numLevels + 1 );
+  levelOffsets.zero();
+  for( localIndex i = 0; i < numBlockRows; ++i )
+  {
+    ++levelOffsets[level[i] + 1];
+  }
+  for( localIndex l = 0; l < numLevels; ++l )
+  {
+    levelOffsets[l + 1] += levelOffsets[l];
+  }
+
+  array1d< localIndex > pos( numLevels );
+  std::copy( levelOffsets.data(), levelOffsets.data() + numLevels, pos.data() );
+  levelRows.resize( numBlockRows );
+  for( localIndex i = 0; i < numBlockRows; ++i )
+  {
+    levelRows[pos[level[i]]++] = i;
+  }
+}
+
+/**
+ * @brief Apply one sweep of a local block factorization, <tt>dst = M^{-1} src</tt>.
+ * @tparam T type of factor values
+ * @param type type of local factorization
+ * @param blockMatrix the block matrix the factorization was computed from
+ * @param lowerLevelOffsets offsets of levels of the lower triangular factor (unused for block Jacobi)
+ * @param lowerLevelRows block rows grouped by level of the lower triangular factor (unused for block Jacobi)
+ * @param upperLevelOffsets offsets of levels of the upper triangular factor (unused for block Jacobi)
+ * @param upperLevelRows block rows grouped by level of the upper triangular factor (unused for block Jacobi)
+ * @param factors factor values (unused for block Jacobi)
+ * @param diagInv inverses of (factored) diagonal blocks
+ * @param src local values of the input vector
+ * @param dst local values of the output vector
+ */
+template< typename T >
+void blockSolveLocal( BlockCRSSmootherType const type,
+                      BlockCRSMatrix const & blockMatrix,
+                      arrayView1d< localIndex const > const & lowerLevelOffsets,
+                      arrayView1d< localIndex const > const & lowerLevelRows,
+                      arrayView1d< localIndex const > const & upperLevelOffsets,
+                      arrayView1d< localIndex const > const & upperLevelRows,
+                      arrayView1d< T const > const & factors,
+                      arrayView1d< T const > const & diagInv,
+                      arrayView1d< real64 const > const & src,
+                      arrayView1d< real64 > const & dst )
+{
+  integer const bs = blockMatrix.blockSize();
+  integer const bs2 = bs * bs;
+  localIndex const numBlockRows = blockMatrix.numLocalBlockRows();
+
+  if( type == BlockCRSSmootherType::Jacobi )
+  {
+    blockKernels::dispatch( bs, [&]( auto NB )
+    {
+      integer constexpr N = decltype( NB )::value;
+      forAll< parallelHostPolicy >( numBlockRows, [=]( localIndex const i )
+      {
+        for( integer r = 0; r < bs; ++r )
+        {
+          dst[i * bs + r] = 0.0;
+        }
+        blockKernels::gemv< N >( bs, 1.0, &diagInv[i * bs2], &src[i * bs], &dst[i * bs] );
+      } );
+    } );
+    return;
+  }
+
+  arrayView1d< localIndex const > const rowOffsets = blockMatrix.getRowOffsets();
+  arrayView1d< localIndex const > const colIndices = blockMatrix.getColumns();
+  arrayView1d< localIndex const > const diagIndices = blockMatrix.getDiagIndices();
+
+  blockKernels::dispatch( bs, [&]( auto NB )
+  {
+    integer constexpr N = decltype( NB )::value;
+
+    // Forward substitution with unit block-lower factor
+    for( localIndex level = 0; level < lowerLevelOffsets.size() - 1; ++level )
+    {
+      localIndex const levelBegin = lowerLevelOffsets[level];
+      forAll< parallelHostPolicy >( lowerLevelOffsets[level + 1] - levelBegin, [=]( localIndex const k )
+      {
+        localIndex const i = lowerLevelRows[levelBegin + k];
+        real64 work[ N > 0 ? N : blockKernels::maxBlockSize ];
+        std::copy( &src[i * bs], &src[i * bs] + bs, work );
+        for( localIndex ik = rowOffsets[i]; ik < diagIndices[i]; ++ik )
+        {
+          blockKernels::gemv< N >( bs, -1.0, &factors[ik * bs2], &dst[colIndices[ik] * bs], work );
+        }
+        std::copy( work, work + bs, &dst[i * bs] );
+      } );
+    }
+
+    // Backward substitution with block-upper factor
+    for( localIndex level = 0; level < upperLevelOffsets.size() - 1; ++level )
+    {
+      localIndex const levelBegin = upperLevelOffsets[level];
+      forAll< parallelHostPolicy >( upperLevelOffsets[level + 1] - levelBegin, [=]( localIndex const k )
+      {
+        localIndex const i = upperLevelRows[levelBegin + k];
+        real64 work[ N > 0 ? N : blockKernels::maxBlockSize ];
+        std::copy( &dst[i * bs], &dst[i * bs] + bs, work );
+        for( localIndex ij = diagIndices[i] + 1; ij < rowOffsets[i + 1] && colIndices[ij] < numBlockRows; ++ij )
+        {
+          blockKernels::gemv< N >( bs, -1.0, &factors[ij * bs2], &dst[colIndices[ij] * bs], work );
+        }
+        for( integer r = 0; r < bs; ++r )
+        {
+          dst[i * bs + r] = 0.0;
+        }
+        blockKernels::gemv< N >( bs, 1.0, &diagInv[i * bs2], work, &dst[i * bs] );
+      } );
+    }
+  } );
+}
+
+/**
+ * @brief Convert values to single precision and release the double precision storage.
+ * @param values the values to convert
+ * @param valuesSingle the converted values
+ */
+void convertToSingle( array1d< real64 > & values,
+                      array1d< float > & valuesSingle )
+{
+  valuesSingle.resize( values.size() );
+  arrayView1d< real64 const > const src = values.toViewConst();
+  arrayView1d< float > const dst = valuesSingle.toView();
+  forAll< parallelHostPolicy >( src.size(), [=]( localIndex const k )
+  {
+    dst[k] = static_cast< float >( src[k] );
+  } );
+  values.clear();
+}
+
+} // namespace
+
+template< typename LAI >
+BlockCRSPreconditioner< LAI >::BlockCRSPreconditioner( BlockCRSSmootherType const type,
+                                                       integer const blockSize,
+                                                       integer const numSweeps,
+                                                       bool const singlePrecision )
+  : Base(),
+  m_type( type ),
+  m_blockSize( blockSize ),
+  m_numSweeps( numSweeps ),
+  m_singlePrecision( singlePrecision )
+{
+  GEOSX_LAI_ASSERT_GT( blockSize, 0 );
+  GEOSX_LAI_ASSERT_GT( numSweeps, 0 );
+}
+
+template< typename LAI >
+void BlockCRSPreconditioner< LAI >::setup( Matrix const & mat )
+{
+  Base::setup( mat );
+  m_operator.setup( mat, m_blockSize );
+  computeFactors( mat );
+}
+
+template< typename LAI >
+void BlockCRSPreconditioner< LAI >::setup( Matrix const & mat,
+                                          CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+                                          bool const patternChanged )
+{
+  GEOSX_LAI_ASSERT_EQ( localMatrix.numRows(), mat.numLocalRows() );
+
+  Base::setup( mat );
+  if( patternChanged || !m_operator.ready() )
+  {
+    m_operator.setup( localMatrix, mat.ilower(), m_blockSize, mat.comm() );
+  }
+  else
+  {
+    m_operator.updateValues( localMatrix );
+  }
+  computeFactors( mat );
+}
+
+template< typename LAI >
+void BlockCRSPreconditioner< LAI >::computeFactors( Matrix const & mat )
+{
+  switch( m_type )
+  {
+    case BlockCRSSmootherType::Jacobi:
+    {
+      computeJacobi();
+      break;
+    }
+    case BlockCRSSmootherType::ILU0:
+    {
+      computeILU0();
+      break;
+    }
+    case BlockCRSSmootherType::SchwarzILU0:
+    {
+      m_operator.matrix().createOverlap( m_overlapMatrix );
+      m_overlapSrc.resize( m_overlapMatrix.numLocalRows() );
+      m_overlapDst.resize( m_overlapMatrix.numLocalRows() );
+      computeILU0();
+      break;
+    }
+  }
+
+  // Factors are computed in double precision and only stored (and applied) in single precision
+  if( m_singlePrecision )
+  {
+    convertToSingle( m_factors, m_factorsSingle );
+    convertToSingle( m_diagInv, m_diagInvSingle );
+  }
+
+  if( m_numSweeps > 1 )
+  {
+    m_residual.createWithLocalSize( mat.numLocalRows(), mat.comm() );
+    m_correction.createWithLocalSize( mat.numLocalRows(), mat.comm() );
+  }
+}
+
+template< typename LAI >
+void BlockCRSPreconditioner< LAI >::updateOperator( Matrix const & mat )
+{
+  GEOSX_LAI_ASSERT( this->ready() );
+  m_operator.updateValues( mat );
+}
+
+template< typename LAI >
+void BlockCRSPreconditioner< LAI >::updateOperator( CRSMatrixView< real64 const, globalIndex const > const & localMatrix )
+{
+  GEOSX_LAI_ASSERT( this->ready() );
+  m_operator.updateValues( localMatrix );
+}
+
+template< typename LAI >
+void BlockCRSPreconditioner< LAI >::clear()
+{
+  Base::clear();
+  m_overlapMatrix.reset();
+  m_lowerLevelOffsets.clear();
+  m_lowerLevelRows.clear();
+  m_upperLevelOffsets.clear();
+  m_upperLevelRows.clear();
+  m_factors.clear();
+  m_diagInv.clear();
+  m_overlapSrc.clear();
+  m_overlapDst.clear();
+  m_factorsSingle.clear();
+  m_diagInvSingle.clear();
+  m_residual.reset();
+  m_correction.reset();
+}
+
+template< typename LAI >
+void BlockCRSPreconditioner< LAI >::computeJacobi()
+{
+  BlockCRSMatrix const & blockMatrix = m_operator.matrix();
+  integer const bs = m_blockSize;
+  localIndex const numBlockRows = blockMatrix.numLocalBlockRows();
+
+  m_diagInv.resize( numBlockRows * bs * bs );
+
+  arrayView1d< localIndex const > const diagIndices = blockMatrix.getDiagIndices();
+  arrayView1d< real64 const > const values = blockMatrix.getValues();
+  arrayView1d< real64 > const diagInv = m_diagInv.toView();
+
+  blockKernels::dispatch( bs, [&]( auto NB )
+  {
+    integer constexpr N = decltype( NB )::value;
+    forAll< parallelHostPolicy >( numBlockRows, [=]( localIndex const i )
+    {
+      GEOSX_ERROR_IF( diagIndices[i] < 0, "BlockCRSPreconditioner: missing diagonal block in block row " << i );
+      real64 work[ N > 0 ? N * N : blockKernels::maxBlockSize * blockKernels::maxBlockSize ];
+      std::copy( &values[diagIndices[i] * bs * bs], &values[diagIndices[i] * bs * bs] + bs * bs, work );
+      GEOSX_ERROR_IF( !blockKernels::invert< N >( bs, work, &diagInv[i * bs * bs] ),
+                      "BlockCRSPreconditioner: singular diagonal block in block row " << i );
+    } );
+  } );
+}
+
+template< typename LAI >
+void BlockCRSPreconditioner< LAI >::computeILU0()
+{
+  BlockCRSMatrix const & blockMatrix = factorMatrix();
+  integer const bs = m_blockSize;
+  integer const bs2 = bs * bs;
+  localIndex const numBlockRows = blockMatrix.numLocalBlockRows();
+
+  arrayView1d< localIndex const > const rowOffsets = blockMatrix.getRowOffsets();
+  arrayView1d< localIndex const > const colIndices = blockMatrix.getColumns();
+  arrayView1d< localIndex const > const diagIndices = blockMatrix.getDiagIndices();
+
+  for( localIndex i = 0; i < numBlockRows; ++i )
+  {
+    GEOSX_ERROR_IF( diagIndices[i] < 0, "BlockCRSPreconditioner: missing diagonal block in block row " << i );
+  }
+
+  // Rows of a lower level only depend on rows of previous levels, both in the factorization and the forward solve
+  computeLevelSchedule( blockMatrix, true, m_lowerLevelOffsets, m_lowerLevelRows );
+  computeLevelSchedule( blockMatrix, false, m_upperLevelOffsets, m_upperLevelRows );
+
+  m_factors.resize( blockMatrix.getValues().size() );
+  m_factors.setValues< serialPolicy >( blockMatrix.getValues() );
+  m_diagInv.resize( numBlockRows * bs2 );
+
+  arrayView1d< real64 > const factors = m_factors.toView();
+  arrayView1d< real64 > const diagInv = m_diagInv.toView();
+  arrayView1d< localIndex const > const levelRows = m_lowerLevelRows.toViewConst();
+
+  // IKJ variant: row i is eliminated using previously factored rows k < i.
+  // Ghost block columns (local index >= numBlockRows) are sorted last and ignored.
+  blockKernels::dispatch( bs, [&]( auto NB )
+  {
+    integer constexpr N = decltype( NB )::value;
+    for( localIndex level = 0; level < m_lowerLevelOffsets.size() - 1; ++level )
+    {
+      localIndex const levelBegin = m_lowerLevelOffsets[level];
+      forAll< parallelHostPolicy >( m_lowerLevelOffsets[level + 1] - levelBegin, [=]( localIndex const r )
+      {
+        localIndex const i = levelRows[levelBegin + r];
+        real64 work[ N > 0 ? N * N : blockKernels::maxBlockSize * blockKernels::maxBlockSize ];
+
+        localIndex const * const rowBegin = colIndices.data() + rowOffsets[i];
+        localIndex const * const rowEnd = colIndices.data() + rowOffsets[i + 1];
+
+        for( localIndex ik = rowOffsets[i]; ik < diagIndices[i]; ++ik )
+        {
+          localIndex const k = colIndices[ik];
+
+          // L_ik = A_ik * inv(U_kk)
+          std::fill( work, work + bs2, 0.0 );
+          blockKernels::gemm< N >( bs, 1.0, &factors[ik * bs2], &diagInv[k * bs2], work );
+          std::copy( work, work + bs2, &factors[ik * bs2] );
+
+          // A_ij -= L_ik * U_kj for all j > k in the pattern of row i
+          for( localIndex kj = diagIndices[k] + 1; kj < rowOffsets[k + 1] && colIndices[kj] < numBlockRows; ++kj )
+          {
+            localIndex const * const pos = std::lower_bound( rowBegin, rowEnd, colIndices[kj] );
+            if( pos != rowEnd && *pos == colIndices[kj] )
+            {
+              blockKernels::gemm< N >( bs, -1.0, work, &factors[kj * bs2], &factors[( pos - colIndices.data() ) * bs2] );
+            }
+          }
+        }
+
+        std::copy( &factors[diagIndices[i] * bs2], &factors[diagIndices[i] * bs2] + bs2, work );
+        GEOSX_ERROR_IF( !blockKernels::invert< N >( bs, work, &diagInv[i * bs2] ),
+                        "BlockCRSPreconditioner: zero pivot block in block row " << i );
+      } );
+    }
+  } );
+}
+
+template< typename LAI >
+void BlockCRSPreconditioner< LAI >::solveLocal( arrayView1d< real64 const > const & src,
+                                                arrayView1d< real64 > const & dst ) const
+{
+  src.move( LvArray::MemorySpace::host, false );
+  dst.move( LvArray::MemorySpace::host, true );
+
+  // Subdomain solves of the Schwarz method operate on owned values extended with ghost values
+  bool const overlap = m_type == BlockCRSSmootherType::SchwarzILU0;
+  if( overlap )
+  {
+    BlockCRSMatrix const & blockMatrix = m_operator.matrix();
+    blockMatrix.exchangeGhosts( src );
+    arrayView1d< real64 const > const ghostValues = blockMatrix.getGhostValues();
+    std::copy( src.data(), src.data() + src.size(), m_overlapSrc.data() );
+    std::copy( ghostValues.data(), ghostValues.data() + ghostValues.size(), m_overlapSrc.data() + src.size() );
+  }
+
+  arrayView1d< real64 const > const localSrc = overlap ? m_overlapSrc.toViewConst() : src;
+  arrayView1d< real64 > const localDst = overlap ? m_overlapDst.toView() : dst;
+  if( m_singlePrecision )
+  {
+    blockSolveLocal( m_type, factorMatrix(),
+                     m_lowerLevelOffsets.toViewConst(), m_lowerLevelRows.toViewConst(),
+                     m_upperLevelOffsets.toViewConst(), m_upperLevelRows.toViewConst(),
+                     m_factorsSingle.toViewConst(), m_diagInvSingle.toViewConst(), localSrc, localDst );
+  }
+  else
+  {
+    blockSolveLocal( m_type, factorMatrix(),
+                     m_lowerLevelOffsets.toViewConst(), m_lowerLevelRows.toViewConst(),
+                     m_upperLevelOffsets.toViewConst(), m_upperLevelRows.toViewConst(),
+                     m_factors.toViewConst(), m_diagInv.toViewConst(), localSrc, localDst );
+  }
+
+  // Restricted variant: only the owned part of the subdomain solution is kept
+  if( overlap )
+  {
+    std::copy( m_overlapDst.data(), m_overlapDst.data() + dst.size(), dst.data() );
+  }
+}
+
+template< typename LAI >
+void BlockCRSPreconditioner< LAI >::apply( Vector const & src,
+                                           Vector & dst ) const
+{
+  GEOSX_LAI_ASSERT( this->ready() );
+  GEOSX_LAI_ASSERT_EQ( this->numGlobalRows(), dst.globalSize() );
+  GEOSX_LAI_ASSERT_EQ( this->numGlobalCols(), src.globalSize() );
+
+  solveLocal( src.values(), dst.open() );
+  dst.close();
+
+  for( integer sweep = 1; sweep < m_numSweeps; ++sweep )
+  {
+    m_operator.residual( dst, src, m_residual );
+    solveLocal( m_residual.values(), m_correction.open() );
+    m_correction.close();
+    dst.axpy( 1.0, m_correction );
+  }
+}
+
+template< typename LAI >
+std::unique_ptr< PreconditionerBase< LAI > >
+createNativePreconditioner( LinearSolverParameters const & params )
+{
+  BlockCRSSmootherType type;
+  switch( params.preconditionerType )
+  {
+    case LinearSolverParameters::PreconditionerType::blockJacobi:
+    {
+      type = BlockCRSSmootherType::Jacobi;
+      break;
+    }
+    case LinearSolverParameters::PreconditionerType::blockILU0:
+    {
+      type = BlockCRSSmootherType::ILU0;
+      break;
+    }
+    case LinearSolverParameters::PreconditionerType::schwarz:
+    {
+      type = BlockCRSSmootherType::SchwarzILU0;
+      break;
+    }
+    default:
+    {
+      return nullptr;
+    }
+  }
+  return std::make_unique< BlockCRSPreconditioner< LAI > >( type,
+                                                            params.native.blockSize,
+                                                            params.native.numSweeps,
+                                                            params.native.singlePrecision );
+}
+
+// -----------------------
+// Explicit Instantiations
+// -----------------------
+#ifdef GEOSX_USE_TRILINOS
+template class BlockCRSPreconditioner< TrilinosInterface >;
+template std::unique_ptr< PreconditionerBase< TrilinosInterface > >
+createNativePreconditioner< TrilinosInterface >( LinearSolverParameters const & );
+#endif
+
+#ifdef GEOSX_USE_HYPRE
+template class BlockCRSPreconditioner< HypreInterface >;
+template std::unique_ptr< PreconditionerBase< HypreInterface > >
+createNativePreconditioner< HypreInterface >( LinearSolverParameters const & );
+#endif
+
+#ifdef GEOSX_USE_PETSC
+template class BlockCRSPreconditioner< PetscInterface >;
+template std::unique_ptr< PreconditionerBase< PetscInterface > >
+createNativePreconditioner< PetscInterface >( LinearSolverParameters const & );
+#endif
+
+} // namespace geosx
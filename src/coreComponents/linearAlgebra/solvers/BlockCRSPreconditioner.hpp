@@ -0,0 +1,253 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file BlockCRSPreconditioner.hpp
+ */
+
+#ifndef GEOSX_LINEARALGEBRA_SOLVERS_BLOCKCRSPRECONDITIONER_HPP_
+#define GEOSX_LINEARALGEBRA_SOLVERS_BLOCKCRSPRECONDITIONER_HPP_
+
+#include "linearAlgebra/common/PreconditionerBase.hpp"
+#include "linearAlgebra/interfaces/native/BlockCRSOperator.hpp"
+#include "linearAlgebra/utilities/LinearSolverParameters.hpp"
+
+namespace geosx
+{
+
+/**
+ * @brief Type of local factorization used by BlockCRSPreconditioner
+ */
+enum class BlockCRSSmootherType
+{
+  Jacobi,     //!< Inverse of diagonal blocks
+  ILU0,       //!< Block incomplete LU factorization with zero fill-in of the rank-local part
+  SchwarzILU0 //!< Restricted additive Schwarz with one layer of overlap and block ILU(0) subdomain solves
+};
+
+/**
+ * @brief Point-block preconditioner operating on a native block-CRS copy of the matrix.
+ * @tparam LAI linear algebra interface providing vectors, matrices and solvers
+ *
+ * Dense blocks couple all unknowns at a node (or cell), so that strongly coupled
+ * components are treated together. The ILU(0) factorization is either rank-local (coupling
+ * to ghost block columns is dropped) or computed on the rank-local matrix extended by one layer
+ * of ghost block rows (Schwarz), in which case only the owned part of the subdomain solution is kept.
+ * Factorization and triangular solves are threaded using level scheduling: block rows are grouped
+ * into levels such that rows within a level only depend on rows of previous levels.
+ * When more than one sweep is requested, additional sweeps are applied as a Richardson
+ * iteration on the full distributed operator.
+ *
+ * In single precision mode, the factorization is computed in double precision and then
+ * stored in single precision, which halves the memory traffic of the triangular solves.
+ * Vectors and the operator used in the Richardson sweeps remain in double precision.
+ */
+template< typename LAI >
+class BlockCRSPreconditioner : public PreconditionerBase< LAI >
+{
+public:
+
+  /// Alias for base type
+  using Base = PreconditionerBase< LAI >;
+
+  /// Alias for vector type
+  using Vector = typename Base::Vector;
+
+  /// Alias for matrix type
+  using Matrix = typename Base::Matrix;
+
+  /**
+   * @brief Constructor.
+   * @param type type of local factorization
+   * @param blockSize size of dense blocks (number of unknowns per node or cell)
+   * @param numSweeps number of preconditioner sweeps per application
+   * @param singlePrecision whether to store and apply the factorization in single precision
+   */
+  BlockCRSPreconditioner( BlockCRSSmootherType const type,
+                          integer const blockSize,
+                          integer const numSweeps = 1,
+                          bool const singlePrecision = false );
+
+  /**
+   * @brief Compute the preconditioner from a matrix.
+   * @param mat the matrix to precondition.
+   */
+  virtual void setup( Matrix const & mat ) override;
+
+  /**
+   * @brief Compute the preconditioner from a matrix and the local rows it was assembled from.
+   * @param mat the matrix to precondition.
+   * @param localMatrix local rows of @p mat with global column indices
+   * @param patternChanged whether the sparsity pattern differs from the one of the previous setup
+   *
+   * The block operator is built from @p localMatrix rather than exported from @p mat, and only
+   * its values are updated in place if the sparsity pattern is unchanged.
+   */
+  void setup( Matrix const & mat,
+              CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+              bool const patternChanged );
+
+  /**
+   * @brief Clean up the preconditioner setup.
+   */
+  virtual void clear() override;
+
+  /**
+   * @brief Apply operator to a vector.
+   * @param src Input vector (src).
+   * @param dst Output vector (dst).
+   */
+  virtual void apply( Vector const & src,
+                      Vector & dst ) const override;
+
+  /**
+   * @brief Refresh the values of the block-CRS operator without recomputing the factorization.
+   * @param mat the matrix, with the sparsity pattern of the one the preconditioner was set up with
+   *
+   * Used when the preconditioner is reused for a new matrix, so that the block operator
+   * (and the Richardson sweeps) keep applying the current matrix.
+   */
+  void updateOperator( Matrix const & mat );
+
+  /**
+   * @brief Refresh the values of the block-CRS operator in place from local rows.
+   * @param localMatrix local rows of the matrix, with the sparsity pattern of the one the preconditioner was set up with
+   */
+  void updateOperator( CRSMatrixView< real64 const, globalIndex const > const & localMatrix );
+
+  /**
+   * @brief @return the block-CRS operator used by the preconditioner
+   *
+   * The operator holds the only block-CRS copy of the matrix and is meant to be used as the
+   * operator of the Krylov solver as well, so that matrix-vector products use the blocked kernels.
+   */
+  BlockCRSOperator< LAI > const & blockOperator() const
+  {
+    return m_operator;
+  }
+
+private:
+
+  /**
+   * @brief Compute the local factorization and work vectors once the block operator is set up.
+   * @param mat the matrix to precondition
+   */
+  void computeFactors( Matrix const & mat );
+
+  /**
+   * @brief Compute inverses of diagonal blocks.
+   */
+  void computeJacobi();
+
+  /**
+   * @brief Compute the block ILU(0) factorization of the rank-local (or overlapping) matrix.
+   */
+  void computeILU0();
+
+  /**
+   * @brief @return the matrix the local factorization is computed from
+   */
+  BlockCRSMatrix const & factorMatrix() const
+  {
+    return m_type == BlockCRSSmootherType::SchwarzILU0 ? m_overlapMatrix : m_operator.matrix();
+  }
+
+  /**
+   * @brief Apply one sweep of the local factorization, <tt>dst = M^{-1} src</tt>.
+   * @param src local values of the input vector
+   * @param dst local values of the output vector
+   */
+  void solveLocal( arrayView1d< real64 const > const & src,
+                   arrayView1d< real64 > const & dst ) const;
+
+  /// Type of local factorization
+  BlockCRSSmootherType m_type;
+
+  /// Size of dense blocks
+  integer m_blockSize;
+
+  /// Number of sweeps per application
+  integer m_numSweeps;
+
+  /// Whether the factorization is stored in single precision
+  bool m_singlePrecision;
+
+  /// Block-CRS copy of the matrix, also used as the Krylov operator
+  BlockCRSOperator< LAI > m_operator;
+
+  /// Rank-local matrix extended by one layer of ghost block rows (Schwarz only)
+  BlockCRSMatrix m_overlapMatrix;
+
+  /// Offsets of levels in m_lowerLevelRows
+  array1d< localIndex > m_lowerLevelOffsets;
+
+  /// Block rows grouped by level of the lower triangular factor
+  array1d< localIndex > m_lowerLevelRows;
+
+  /// Offsets of levels in m_upperLevelRows
+  array1d< localIndex > m_upperLevelOffsets;
+
+  /// Block rows grouped by level of the upper triangular factor
+  array1d< localIndex > m_upperLevelRows;
+
+  /// Factor values (strictly lower part scaled by inverse pivots, strictly upper part as is)
+  array1d< real64 > m_factors;
+
+  /// Inverses of (factored) diagonal blocks
+  array1d< real64 > m_diagInv;
+
+  /// Single precision copy of factor values
+  array1d< float > m_factorsSingle;
+
+  /// Single precision copy of inverses of diagonal blocks
+  array1d< float > m_diagInvSingle;
+
+  /// Input values extended to the overlapping subdomain (Schwarz only)
+  array1d< real64 > mutable m_overlapSrc;
+
+  /// Output values on the overlapping subdomain (Schwarz only)
+  array1d< real64 > mutable m_overlapDst;
+
+  /// Work vector for residual computation
+  Vector mutable m_residual;
+
+  /// Work vector for correction
+  Vector mutable m_correction;
+};
+
+/**
+ * @brief Check whether a preconditioner type is implemented natively (without a TPL).
+ * @param type the preconditioner type
+ * @return true if @p type is handled by createNativePreconditioner()
+ */
+inline bool isNativePreconditioner( LinearSolverParameters::PreconditionerType const type )
+{
+  return type == LinearSolverParameters::PreconditionerType::blockJacobi
+         || type == LinearSolverParameters::PreconditionerType::blockILU0
+         || type == LinearSolverParameters::PreconditionerType::schwarz;
+}
+
+/**
+ * @brief Create a native preconditioner.
+ * @tparam LAI linear algebra interface providing vectors and matrices
+ * @param params the linear solver parameters
+ * @return an owning pointer to the new preconditioner, or nullptr if the type is not native
+ */
+template< typename LAI >
+std::unique_ptr< PreconditionerBase< LAI > >
+createNativePreconditioner( LinearSolverParameters const & params );
+
+} // namespace geosx
+
+#endif //GEOSX_LINEARALGEBRA_SOLVERS_BLOCKCRSPRECONDITIONER_HPP_
@@ -163,7 +163,7 @@ void BlockPreconditioner< LAI >::setup( Matrix const & mat )
   // This is done before Base::compute() since it overwrites old sizes.
   bool const newSize = !this->ready() ||
                        mat.numGlobalRows() != this->numGlobalRows() ||
-                       mat.numGlobalCols() != this->numGlobalRows();
+                       mat.numGlobalCols() != this->numGlobalCols();
 
   Base::setup( mat );
 
@@ -178,7 +178,7 @@ void BlockPreconditioner< LAI >::setup( Matrix const & mat )
   mat.multiplyPtAP( m_prolongators[1], m_matBlocks( 1, 1 ) );
 
   // Extract off-diagonal blocks only if used
-  if( m_schurOption != SchurComplementOption::None && m_shapeOption != BlockShapeOption::Diagonal )
+  if( m_schurOption != SchurComplementOption::None || m_shapeOption != BlockShapeOption::Diagonal )
   {
     mat.multiplyRAP( m_restrictors[0], m_prolongators[1], m_matBlocks( 0, 1 ) );
     mat.multiplyRAP( m_restrictors[1], m_prolongators[0], m_matBlocks( 1, 0 ) );
@@ -203,7 +203,7 @@ void BlockPreconditioner< LAI >::apply( Vector const & src,
   }
 
   // Perform a predictor step by solving (0,0) block and subtracting from 1-block rhs
-  if( m_shapeOption == BlockShapeOption::LowerUpperTriangular )
+  if( m_shapeOption == BlockShapeOption::LowerUpperTriangular || m_shapeOption == BlockShapeOption::LowerTriangular )
   {
     m_solvers[0]->apply( m_rhs( 0 ), m_sol( 0 ) );
     m_matBlocks( 1, 0 ).residual( m_sol( 0 ), m_rhs( 1 ), m_rhs( 1 ) );
@@ -212,14 +212,18 @@ void BlockPreconditioner< LAI >::apply( Vector const & src,
   // Solve the (1,1) block modified via Schur complement
   m_solvers[1]->apply( m_rhs( 1 ), m_sol( 1 ) );
 
-  // Update the 0-block rhs
-  if( m_shapeOption != BlockShapeOption::Diagonal )
+  // Lower triangular shape is complete after the predictor step
+  if( m_shapeOption != BlockShapeOption::LowerTriangular )
   {
-    m_matBlocks( 0, 1 ).residual( m_sol( 1 ), m_rhs( 0 ), m_rhs( 0 ) );
-  }
+    // Update the 0-block rhs
+    if( m_shapeOption != BlockShapeOption::Diagonal )
+    {
+      m_matBlocks( 0, 1 ).residual( m_sol( 1 ), m_rhs( 0 ), m_rhs( 0 ) );
+    }
 
-  // Solve the (0,0) block with the current rhs
-  m_solvers[0]->apply( m_rhs( 0 ), m_sol( 0 ) );
+    // Solve the (0,0) block with the current rhs
+    m_solvers[0]->apply( m_rhs( 0 ), m_sol( 0 ) );
+  }
 
   // Combine block solutions into global solution vector
   m_prolongators[0].apply( m_sol( 0 ), dst );
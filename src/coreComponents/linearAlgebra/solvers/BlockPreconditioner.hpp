@@ -56,6 +56,7 @@ enum class BlockScalingOption
 enum class BlockShapeOption
 {
   Diagonal,            //!< (D)^{-1}
+  LowerTriangular,     //!< (LD)^{-1}
   UpperTriangular,     //!< (DU)^{-1}
   LowerUpperTriangular //!< (LDU)^{-1}
 };
@@ -20,6 +20,7 @@
 
 #include "common/Stopwatch.hpp"
 #include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "linearAlgebra/interfaces/dense/BlasLapackLA.hpp"
 #include "linearAlgebra/solvers/KrylovUtils.hpp"
 
 namespace geosx
@@ -31,7 +32,8 @@ GmresSolver< VECTOR >::GmresSolver( LinearSolverParameters params,
                                     LinearOperator< Vector > const & M )
   : KrylovSolver< VECTOR >( std::move( params ), A, M ),
   m_kspace( m_params.krylov.maxRestart + 1 ),
-  m_kspaceInitialized( false )
+  m_kspaceInitialized( false ),
+  m_recycleSpace( nullptr )
 {
   GEOSX_ERROR_IF_LE_MSG( m_params.krylov.maxRestart, 0, "GMRES: max number of iterations until restart must be positive." );
 }
@@ -113,6 +115,23 @@ void GmresSolver< VECTOR >::solve( Vector const & b,
   real64 const rnorm0 = r.norm2();
   real64 const absTol = rnorm0 * m_params.krylov.relTolerance;
 
+  // Deflate the recycled subspace, if any, from the initial residual
+  bool const recycling = m_recycleSpace != nullptr && m_params.krylov.recycleSize > 0;
+  integer const numRecycled = recycling ? setupRecycleSpace( b, x, r ) : 0;
+  if( recycling && m_zspace.empty() )
+  {
+    m_zspace.resize( m_params.krylov.maxRestart );
+    for( VectorTemp & zv : m_zspace )
+    {
+      zv = createTempVector( b );
+    }
+  }
+
+  // Projections onto recycled images and unrotated copy of H (only needed when recycling)
+  array2d< real64 > B( recycling ? numRecycled : 0, recycling ? m_params.krylov.maxRestart : 0 );
+  array2d< real64 > Hbar( recycling ? m_params.krylov.maxRestart + 1 : 0, recycling ? m_params.krylov.maxRestart : 0 );
+  integer lastCycleSize = 0;
+
   // Create upper Hessenberg matrix
   array2d< real64, MatrixLayout::COL_MAJOR_PERM > H( m_params.krylov.maxRestart + 1, m_params.krylov.maxRestart );
 
@@ -121,6 +140,9 @@ void GmresSolver< VECTOR >::solve( Vector const & b,
   array1d< real64 > s( m_params.krylov.maxRestart + 1 );
   array1d< real64 > g( m_params.krylov.maxRestart + 1 );
 
+  // Storage for a single column of H (used by classical Gram-Schmidt)
+  array1d< real64 > h( m_params.krylov.maxRestart + 1 );
+
   // Initialize iteration state
   m_result.status = LinearSolverResult::Status::NotConverged;
   m_residualNorms.clear();
@@ -130,7 +152,7 @@ void GmresSolver< VECTOR >::solve( Vector const & b,
   {
     // Re-initialize Krylov subspace
     g.zero();
-    g[0] = k > 0 ? r.norm2() : rnorm0;
+    g[0] = ( k > 0 || numRecycled > 0 ) ? r.norm2() : rnorm0;
     m_kspace[0].copy( r );
     if( g[0] > 0 )
     {
@@ -156,14 +178,44 @@ void GmresSolver< VECTOR >::solve( Vector const & b,
       m_precond.apply( m_kspace[j], z );
       m_operator.apply( z, w );
 
+      // Keep the basis orthogonal to the images of recycled vectors
+      if( recycling )
+      {
+        m_zspace[j].copy( z );
+        for( integer l = 0; l < numRecycled; ++l )
+        {
+          B( l, j ) = w.dot( m_cspace[l] );
+          w.axpy( -B( l, j ), m_cspace[l] );
+        }
+      }
+
       // Orthogonalization
-      for( integer i = 0; i <= j; ++i )
+      if( m_params.krylov.orthogonalization == LinearSolverParameters::Krylov::Orthogonalization::mgs )
+      {
+        for( integer i = 0; i <= j; ++i )
+        {
+          H( i, j ) = w.dot( m_kspace[i] );
+          w.axpby( -H( i, j ), m_kspace[i], 1.0 );
+        }
+        H( j+1, j ) = w.norm2();
+      }
+      else
+      {
+        H( j+1, j ) = orthogonalizeClassical( j, w, h.toSlice() );
+        for( integer i = 0; i <= j; ++i )
+        {
+          H( i, j ) = h[i];
+        }
+      }
+
+      if( recycling )
       {
-        H( i, j ) = w.dot( m_kspace[i] );
-        w.axpby( -H( i, j ), m_kspace[i], 1.0 );
+        for( integer i = 0; i <= j + 1; ++i )
+        {
+          Hbar( i, j ) = H( i, j );
+        }
       }
 
-      H( j+1, j ) = w.norm2();
       GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( H( j+1, j ) )
       m_kspace[j+1].axpby( 1.0 / H( j+1, j ), w, 0.0 );
 
@@ -181,23 +233,200 @@ void GmresSolver< VECTOR >::solve( Vector const & b,
 
     // Regardless of how we quit out of inner loop, j is the actual size of H
     Backsolve( j, H, g );
-    w.zero();
-    for( integer i = 0; i < j; ++i )
+    if( recycling )
     {
-      w.axpy( g[i], m_kspace[i] );
+      // Preconditioned vectors are stored, and the correction must stay orthogonal to recycled images
+      z.zero();
+      for( integer i = 0; i < j; ++i )
+      {
+        z.axpy( g[i], m_zspace[i] );
+      }
+      for( integer l = 0; l < numRecycled; ++l )
+      {
+        real64 coef = 0.0;
+        for( integer i = 0; i < j; ++i )
+        {
+          coef += B( l, i ) * g[i];
+        }
+        z.axpy( -coef, m_recycleSpace->vectors()[l] );
+      }
+      if( j > 0 )
+      {
+        lastCycleSize = j;
+      }
+    }
+    else
+    {
+      w.zero();
+      for( integer i = 0; i < j; ++i )
+      {
+        w.axpy( g[i], m_kspace[i] );
+      }
+      m_precond.apply( w, z );
     }
-    m_precond.apply( w, z );
 
     // Update the solution vector and recompute residual
     x.axpy( 1.0, z );
     m_operator.residual( x, b, r );
   }
 
+  if( recycling && lastCycleSize > 0 )
+  {
+    updateRecycleSpace( numRecycled, lastCycleSize, B.toSliceConst(), Hbar.toSliceConst() );
+  }
+
   m_result.residualReduction = rnorm0 > 0.0 ? m_residualNorms.back() / rnorm0 : 0.0;
   m_result.solveTime = watch.elapsedTime();
   logResult();
 }
 
+template< typename VECTOR >
+real64 GmresSolver< VECTOR >::orthogonalizeClassical( integer const j,
+                                                      Vector & w,
+                                                      arraySlice1d< real64 > const & h ) const
+{
+  // Dot products against the basis and w itself are fused into a single global reduction
+  array1d< Vector const * > vecs( j + 2 );
+  array1d< real64 > dots( j + 2 );
+  for( integer i = 0; i <= j; ++i )
+  {
+    vecs[i] = &m_kspace[i];
+    h[i] = 0.0;
+  }
+  vecs[j+1] = &w;
+
+  integer const numPasses = m_params.krylov.orthogonalization == LinearSolverParameters::Krylov::Orthogonalization::cgs2 ? 2 : 1;
+  real64 normSq = 0.0;
+  real64 origNormSq = 0.0;
+  for( integer pass = 0; pass < numPasses; ++pass )
+  {
+    w.multiDot( vecs.toSliceConst(), dots.toSlice() );
+    origNormSq = dots[j+1];
+    normSq = origNormSq;
+    for( integer i = 0; i <= j; ++i )
+    {
+      h[i] += dots[i];
+      w.axpy( -dots[i], m_kspace[i] );
+      normSq -= dots[i] * dots[i];
+    }
+  }
+
+  // The norm of the orthogonalized vector follows from the Pythagorean identity (basis is orthonormal).
+  // In case of severe cancellation it is not accurate, and must be recomputed explicitly.
+  real64 constexpr cancellationTol = 1e-4;
+  if( normSq <= cancellationTol * origNormSq )
+  {
+    return w.norm2();
+  }
+  return std::sqrt( normSq );
+}
+
+template< typename VECTOR >
+integer GmresSolver< VECTOR >::setupRecycleSpace( Vector const & b,
+                                                  Vector & x,
+                                                  Vector & r ) const
+{
+  array1d< VectorTemp > & U = m_recycleSpace->vectors();
+  if( U.size() > 0 && U[0].globalSize() != b.globalSize() )
+  {
+    m_recycleSpace->clear();
+  }
+
+  // Orthonormalize the images C = A*U (MGS), applying the same transformation to U.
+  // Vectors whose images are (numerically) linearly dependent are dropped.
+  m_cspace.resize( U.size() );
+  integer k = 0;
+  for( localIndex i = 0; i < U.size(); ++i )
+  {
+    if( k != i )
+    {
+      U[k].copy( U[i] );
+    }
+    m_cspace[k] = createTempVector( b );
+    m_operator.apply( U[k], m_cspace[k] );
+
+    real64 const origNorm = m_cspace[k].norm2();
+    for( integer l = 0; l < k; ++l )
+    {
+      real64 const d = m_cspace[k].dot( m_cspace[l] );
+      m_cspace[k].axpy( -d, m_cspace[l] );
+      U[k].axpy( -d, U[l] );
+    }
+
+    real64 constexpr dependenceTol = 1e-10;
+    real64 const norm = m_cspace[k].norm2();
+    if( norm > dependenceTol * origNorm )
+    {
+      m_cspace[k].scale( 1.0 / norm );
+      U[k].scale( 1.0 / norm );
+      ++k;
+    }
+  }
+  U.resize( k );
+  m_cspace.resize( k );
+
+  // Minimize the residual over the recycled subspace
+  for( integer l = 0; l < k; ++l )
+  {
+    real64 const d = m_cspace[l].dot( r );
+    x.axpy( d, U[l] );
+    r.axpy( -d, m_cspace[l] );
+  }
+
+  return k;
+}
+
+template< typename VECTOR >
+void GmresSolver< VECTOR >::updateRecycleSpace( integer const numRecycled,
+                                                integer const numKrylov,
+                                                arraySlice2d< real64 const > const & B,
+                                                arraySlice2d< real64 const > const & H ) const
+{
+  // Projected operator on the augmented space [U, Z]: A [U, Z] = [C, V] G, where [C, V] is orthonormal.
+  integer const n = numRecycled + numKrylov;
+  array2d< real64 > G( n + 1, n );
+  for( integer l = 0; l < numRecycled; ++l )
+  {
+    G( l, l ) = 1.0;
+    for( integer j = 0; j < numKrylov; ++j )
+    {
+      G( l, numRecycled + j ) = B( l, j );
+    }
+  }
+  for( integer i = 0; i <= numKrylov; ++i )
+  {
+    for( integer j = 0; j < numKrylov; ++j )
+    {
+      G( numRecycled + i, numRecycled + j ) = H( i, j );
+    }
+  }
+
+  // Right singular vectors of the smallest singular values span the approximate low modes
+  array2d< real64 > Usvd( n + 1, n );
+  array1d< real64 > S( n );
+  array2d< real64 > VT( n, n );
+  BlasLapackLA::matrixSVD( G.toSliceConst(), Usvd.toSlice(), S.toSlice(), VT.toSlice() );
+
+  array1d< VectorTemp > & U = m_recycleSpace->vectors();
+  integer const numKeep = std::min( m_params.krylov.recycleSize, n );
+  array1d< VectorTemp > newU( numKeep );
+  for( integer q = 0; q < numKeep; ++q )
+  {
+    integer const row = n - 1 - q;
+    newU[q] = createTempVector( m_zspace[0] );
+    newU[q].zero();
+    for( integer l = 0; l < numRecycled; ++l )
+    {
+      newU[q].axpy( VT( row, l ), U[l] );
+    }
+    for( integer j = 0; j < numKrylov; ++j )
+    {
+      newU[q].axpy( VT( row, numRecycled + j ), m_zspace[j] );
+    }
+  }
+  U = std::move( newU );
+}
+
 // -----------------------
 // Explicit Instantiations
 // -----------------------
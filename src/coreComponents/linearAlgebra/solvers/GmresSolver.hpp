@@ -19,6 +19,7 @@
 #ifndef GEOSX_LINEARALGEBRA_SOLVERS_GMRESSOLVER_HPP_
 #define GEOSX_LINEARALGEBRA_SOLVERS_GMRESSOLVER_HPP_
 
+#include "linearAlgebra/solvers/KrylovRecycleSpace.hpp"
 #include "linearAlgebra/solvers/KrylovSolver.hpp"
 
 namespace geosx
@@ -44,6 +45,9 @@ public:
   /// Alias for the vector type
   using Vector = typename Base::Vector;
 
+  /// Alias for the recycle space type
+  using RecycleSpace = KrylovRecycleSpace< typename Base::VectorTemp >;
+
   /**
    * @name Constructor/Destructor Methods
    */
@@ -80,6 +84,19 @@ public:
 
   ///@}
 
+  /**
+   * @brief Set the subspace recycled across consecutive solves.
+   * @param recycleSpace the recycle space (must outlive the solver), or nullptr to disable recycling
+   *
+   * When set and krylov.recycleSize is positive, the recycled vectors are deflated from the
+   * initial residual, kept orthogonal to the Krylov basis, and replaced at the end of the solve
+   * by approximate low modes of the current operator.
+   */
+  void setRecycleSpace( RecycleSpace * const recycleSpace )
+  {
+    m_recycleSpace = recycleSpace;
+  }
+
 protected:
 
   /// Alias for vector type that can be used for temporaries
@@ -94,11 +111,58 @@ protected:
   using Base::logProgress;
   using Base::logResult;
 
+  /**
+   * @brief Orthogonalize a new vector against the current Krylov basis using classical Gram-Schmidt.
+   * @param j index of the last vector in the current basis
+   * @param w the vector to orthogonalize, overwritten by the result
+   * @param h output projection coefficients (entries 0 to @p j)
+   * @return the norm of the orthogonalized vector
+   *
+   * Performs a single fused global reduction per pass (two passes with reorthogonalization).
+   */
+  real64 orthogonalizeClassical( integer const j,
+                                 Vector & w,
+                                 arraySlice1d< real64 > const & h ) const;
+
+  /**
+   * @brief Compute the images of recycled vectors and deflate them from the initial residual.
+   * @param b the right-hand side vector (used as a template for new vectors)
+   * @param x the solution vector, updated with the recycled space correction
+   * @param r the residual vector, updated accordingly
+   * @return the number of recycled vectors retained
+   *
+   * On return the recycled vectors are scaled so that their images are orthonormal.
+   */
+  integer setupRecycleSpace( Vector const & b,
+                             Vector & x,
+                             Vector & r ) const;
+
+  /**
+   * @brief Replace the recycled vectors with approximate low modes from the last cycle.
+   * @param numRecycled number of recycled vectors used in the solve
+   * @param numKrylov size of the last Krylov cycle
+   * @param B projection coefficients of the Krylov basis images onto the recycled images
+   * @param H unrotated upper Hessenberg matrix of the last cycle
+   */
+  void updateRecycleSpace( integer const numRecycled,
+                           integer const numKrylov,
+                           arraySlice2d< real64 const > const & B,
+                           arraySlice2d< real64 const > const & H ) const;
+
   /// Storage for Krylov subspace vectors
   array1d< VectorTemp > m_kspace;
 
   /// Flag indicating whether kspace vectors have been created
   bool mutable m_kspaceInitialized;
+
+  /// Preconditioned Krylov vectors of the current cycle (only stored when recycling)
+  array1d< VectorTemp > mutable m_zspace;
+
+  /// Images of the recycled vectors under the operator
+  array1d< VectorTemp > mutable m_cspace;
+
+  /// Recycle space (not owned)
+  RecycleSpace * m_recycleSpace;
 };
 
 } // namespace geosx
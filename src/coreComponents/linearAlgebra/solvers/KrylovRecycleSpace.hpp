@@ -0,0 +1,82 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file KrylovRecycleSpace.hpp
+ */
+
+#ifndef GEOSX_LINEARALGEBRA_SOLVERS_KRYLOVRECYCLESPACE_HPP_
+#define GEOSX_LINEARALGEBRA_SOLVERS_KRYLOVRECYCLESPACE_HPP_
+
+#include "common/DataTypes.hpp"
+
+namespace geosx
+{
+
+/**
+ * @brief Subspace of approximate low modes carried over between consecutive Krylov solves.
+ * @tparam VECTOR type of vectors stored
+ *
+ * Holds solution-space vectors @p U that are deflated from the next solve (GCRO-DR style).
+ * The recycle space is owned by the caller, so that it outlives the solver objects, and is
+ * updated by the solver at the end of each solve. It is valid across changes in the operator
+ * (images of @p U under the current operator are recomputed on every solve), but must be
+ * cleared when the size or partitioning of the system changes.
+ */
+template< typename VECTOR >
+class KrylovRecycleSpace
+{
+public:
+
+  /**
+   * @brief @return number of recycled vectors
+   */
+  localIndex size() const
+  {
+    return m_vectors.size();
+  }
+
+  /**
+   * @brief Remove all recycled vectors.
+   */
+  void clear()
+  {
+    m_vectors.clear();
+  }
+
+  /**
+   * @brief @return recycled solution-space vectors
+   */
+  array1d< VECTOR > & vectors()
+  {
+    return m_vectors;
+  }
+
+  /**
+   * @copydoc vectors()
+   */
+  array1d< VECTOR > const & vectors() const
+  {
+    return m_vectors;
+  }
+
+private:
+
+  /// Recycled solution-space vectors
+  array1d< VECTOR > m_vectors;
+};
+
+} // namespace geosx
+
+#endif //GEOSX_LINEARALGEBRA_SOLVERS_KRYLOVRECYCLESPACE_HPP_
@@ -0,0 +1,343 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file MultiBlockPreconditioner.cpp
+ */
+
+#include "MultiBlockPreconditioner.hpp"
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+
+#include <algorithm>
+
+namespace geosx
+{
+
+template< typename LAI >
+MultiBlockPreconditioner< LAI >::MultiBlockPreconditioner( localIndex const numBlocks,
+                                                           BlockShapeOption const shapeOption,
+                                                           SchurComplementOption const schurOption,
+                                                           BlockScalingOption const scalingOption )
+  : Base(),
+  m_shapeOption( shapeOption ),
+  m_schurOption( schurOption ),
+  m_scalingOption( scalingOption ),
+  m_blockDofs( numBlocks ),
+  m_restrictors( numBlocks ),
+  m_prolongators( numBlocks ),
+  m_matBlocks( numBlocks, numBlocks ),
+  m_solvers( numBlocks ),
+  m_scaling( numBlocks, 1.0 ),
+  m_rhs( numBlocks ),
+  m_sol( numBlocks )
+{
+  GEOSX_LAI_ASSERT_GT( numBlocks, 0 );
+}
+
+template< typename LAI >
+MultiBlockPreconditioner< LAI >::~MultiBlockPreconditioner() = default;
+
+template< typename LAI >
+void MultiBlockPreconditioner< LAI >::reinitialize( Matrix const & mat, DofManager const & dofManager )
+{
+  MPI_Comm const & comm = mat.comm();
+  localIndex const nBlocks = numBlocks();
+
+  if( m_blockDofs[nBlocks - 1].empty() )
+  {
+    std::vector< DofManager::SubComponent > excluded;
+    for( localIndex i = 0; i < nBlocks - 1; ++i )
+    {
+      excluded.insert( excluded.end(), m_blockDofs[i].begin(), m_blockDofs[i].end() );
+    }
+    m_blockDofs[nBlocks - 1] = dofManager.filterDofs( excluded );
+  }
+
+  for( localIndex i = 0; i < nBlocks; ++i )
+  {
+    GEOSX_LAI_ASSERT_MSG( !m_blockDofs[i].empty(), "MultiBlockPreconditioner: block " << i << " has no DoF components" );
+    dofManager.makeRestrictor( m_blockDofs[i], comm, false, m_restrictors[i] );
+    dofManager.makeRestrictor( m_blockDofs[i], comm, true, m_prolongators[i] );
+    m_rhs( i ).create( m_restrictors[i].numLocalRows(), comm );
+    m_sol( i ).create( m_restrictors[i].numLocalRows(), comm );
+  }
+}
+
+template< typename LAI >
+void MultiBlockPreconditioner< LAI >::setupBlock( localIndex const blockIndex,
+                                                  std::vector< DofManager::SubComponent > blockDofs,
+                                                  std::unique_ptr< PreconditionerBase< LAI > > solver,
+                                                  real64 const scaling )
+{
+  GEOSX_LAI_ASSERT_GT( numBlocks(), blockIndex );
+  GEOSX_LAI_ASSERT( solver );
+  GEOSX_LAI_ASSERT( !blockDofs.empty() || blockIndex == numBlocks() - 1 );
+  GEOSX_LAI_ASSERT_GT( scaling, 0.0 );
+
+  m_blockDofs[blockIndex] = std::move( blockDofs );
+  m_solvers[blockIndex] = std::move( solver );
+  m_scaling[blockIndex] = scaling;
+}
+
+template< typename LAI >
+void MultiBlockPreconditioner< LAI >::applyBlockScaling()
+{
+  if( m_scalingOption != BlockScalingOption::None )
+  {
+    localIndex const nBlocks = numBlocks();
+
+    if( m_scalingOption == BlockScalingOption::FrobeniusNorm )
+    {
+      // Scale each block down to the smallest diagonal block norm
+      std::vector< real64 > norms( nBlocks );
+      for( localIndex i = 0; i < nBlocks; ++i )
+      {
+        norms[i] = m_matBlocks( i, i ).normFrobenius();
+      }
+      real64 const minNorm = *std::min_element( norms.begin(), norms.end() );
+      for( localIndex i = 0; i < nBlocks; ++i )
+      {
+        m_scaling[i] = minNorm / norms[i];
+      }
+    }
+
+    for( localIndex i = 0; i < nBlocks; ++i )
+    {
+      for( localIndex j = 0; j < nBlocks; ++j )
+      {
+        m_matBlocks( i, j ).scale( m_scaling[i] );
+      }
+    }
+  }
+}
+
+template< typename LAI >
+void MultiBlockPreconditioner< LAI >::computeSchurComplement( localIndex const blockIndex )
+{
+  localIndex const i = blockIndex;
+  for( localIndex j = 0; j < i; ++j )
+  {
+    switch( m_schurOption )
+    {
+      case SchurComplementOption::None:
+      {
+        // nothing to do
+        break;
+      }
+      case SchurComplementOption::FirstBlockDiagonal:
+      {
+        m_matBlocks( j, j ).extractDiagonal( m_rhs( j ) );
+        m_rhs( j ).reciprocal();
+        m_matBlocks( j, i ).leftScale( m_rhs( j ) );
+        Matrix matii;
+        m_matBlocks( i, j ).multiply( m_matBlocks( j, i ), matii );
+        m_matBlocks( i, i ).addEntries( matii, MatrixPatternOp::Restrict, -1.0 );
+        // Restore original scaling
+        m_rhs( j ).reciprocal();
+        m_matBlocks( j, i ).leftScale( m_rhs( j ) );
+        break;
+      }
+      case SchurComplementOption::RowsumDiagonalProbing:
+      {
+        m_sol( i ).set( -1.0 );
+        m_matBlocks( j, i ).apply( m_sol( i ), m_rhs( j ) );
+        m_solvers[j]->apply( m_rhs( j ), m_sol( j ) );
+        m_matBlocks( i, j ).apply( m_sol( j ), m_rhs( i ) );
+        m_matBlocks( i, i ).addDiagonal( m_rhs( i ), 1.0 );
+        break;
+      }
+      case SchurComplementOption::FirstBlockUserDefined:
+      {
+        Matrix const & precjj = m_solvers[j]->preconditionerMatrix();
+        Matrix matii;
+        precjj.multiplyRAP( m_matBlocks( i, j ), m_matBlocks( j, i ), matii );
+        m_matBlocks( i, i ).addEntries( matii, MatrixPatternOp::Extend, -1.0 );
+        break;
+      }
+      default:
+      {
+        GEOSX_ERROR( "MultiBlockPreconditioner: unsupported Schur complement option" );
+      }
+    }
+  }
+}
+
+template< typename LAI >
+void MultiBlockPreconditioner< LAI >::setup( Matrix const & mat )
+{
+  // Check that DofManager is available
+  GEOSX_LAI_ASSERT_MSG( mat.dofManager() != nullptr, "MultiBlockPreconditioner requires a DofManager" );
+
+  localIndex const nBlocks = numBlocks();
+
+  // Check that user has set block solvers
+  for( localIndex i = 0; i < nBlocks; ++i )
+  {
+    GEOSX_LAI_ASSERT_MSG( m_solvers[i] != nullptr, "MultiBlockPreconditioner: solver for block " << i << " not set" );
+  }
+
+  // Compare old sizes vs new matrix sizes.
+  // A change in size indicates a new matrix structure.
+  // This is done before Base::compute() since it overwrites old sizes.
+  bool const newSize = !this->ready() ||
+                       mat.numGlobalRows() != this->numGlobalRows() ||
+                       mat.numGlobalCols() != this->numGlobalCols();
+
+  Base::setup( mat );
+
+  // If the matrix size/structure has changed, need to resize internal LA objects and recompute restrictors.
+  if( newSize )
+  {
+    reinitialize( mat, *mat.dofManager() );
+  }
+
+  // Extract diagonal blocks
+  for( localIndex i = 0; i < nBlocks; ++i )
+  {
+    mat.multiplyPtAP( m_prolongators[i], m_matBlocks( i, i ) );
+  }
+
+  // Extract off-diagonal blocks only if used
+  if( m_schurOption != SchurComplementOption::None || m_shapeOption != BlockShapeOption::Diagonal )
+  {
+    for( localIndex i = 0; i < nBlocks; ++i )
+    {
+      for( localIndex j = 0; j < nBlocks; ++j )
+      {
+        if( i != j )
+        {
+          mat.multiplyRAP( m_restrictors[i], m_prolongators[j], m_matBlocks( i, j ) );
+        }
+      }
+    }
+  }
+
+  applyBlockScaling();
+
+  // Blocks are eliminated in order: each Schur complement uses already set up preceding block solvers
+  for( localIndex i = 0; i < nBlocks; ++i )
+  {
+    computeSchurComplement( i );
+    m_solvers[i]->setup( m_matBlocks( i, i ) );
+  }
+}
+
+template< typename LAI >
+void MultiBlockPreconditioner< LAI >::sweep( bool const forward, localIndex const first ) const
+{
+  localIndex const nBlocks = numBlocks();
+  localIndex const step = forward ? 1 : -1;
+  for( localIndex i = first; i >= 0 && i < nBlocks; i += step )
+  {
+    // Update block rhs with already computed block solutions
+    for( localIndex j = i - step; j >= 0 && j < nBlocks; j -= step )
+    {
+      m_matBlocks( i, j ).residual( m_sol( j ), m_rhs( i ), m_rhs( i ) );
+    }
+    m_solvers[i]->apply( m_rhs( i ), m_sol( i ) );
+  }
+}
+
+template< typename LAI >
+void MultiBlockPreconditioner< LAI >::apply( Vector const & src,
+                                             Vector & dst ) const
+{
+  localIndex const nBlocks = numBlocks();
+
+  for( localIndex i = 0; i < nBlocks; ++i )
+  {
+    m_restrictors[i].apply( src, m_rhs( i ) );
+    m_rhs( i ).scale( m_scaling[i] );
+  }
+
+  switch( m_shapeOption )
+  {
+    case BlockShapeOption::Diagonal:
+    {
+      for( localIndex i = 0; i < nBlocks; ++i )
+      {
+        m_solvers[i]->apply( m_rhs( i ), m_sol( i ) );
+      }
+      break;
+    }
+    case BlockShapeOption::LowerTriangular:
+    {
+      sweep( true, 0 );
+      break;
+    }
+    case BlockShapeOption::UpperTriangular:
+    {
+      sweep( false, nBlocks - 1 );
+      break;
+    }
+    case BlockShapeOption::LowerUpperTriangular:
+    {
+      // Forward sweep leaves rhs updated with lower blocks, backward sweep reuses the last block solution
+      sweep( true, 0 );
+      sweep( false, nBlocks - 2 );
+      break;
+    }
+    default:
+    {
+      GEOSX_ERROR( "MultiBlockPreconditioner: unsupported block shape option" );
+    }
+  }
+
+  // Combine block solutions into global solution vector
+  m_prolongators[0].apply( m_sol( 0 ), dst );
+  for( localIndex i = 1; i < nBlocks; ++i )
+  {
+    m_prolongators[i].gemv( 1.0, m_sol( i ), 1.0, dst );
+  }
+}
+
+template< typename LAI >
+void MultiBlockPreconditioner< LAI >::clear()
+{
+  Base::clear();
+  localIndex const nBlocks = numBlocks();
+  for( localIndex i = 0; i < nBlocks; ++i )
+  {
+    m_restrictors[i].reset();
+    m_prolongators[i].reset();
+    if( m_solvers[i] )
+    {
+      m_solvers[i]->clear();
+    }
+    m_rhs( i ).reset();
+    m_sol( i ).reset();
+    for( localIndex j = 0; j < nBlocks; ++j )
+    {
+      m_matBlocks( i, j ).reset();
+    }
+  }
+}
+
+// -----------------------
+// Explicit Instantiations
+// -----------------------
+#ifdef GEOSX_USE_TRILINOS
+template class MultiBlockPreconditioner< TrilinosInterface >;
+#endif
+
+#ifdef GEOSX_USE_HYPRE
+template class MultiBlockPreconditioner< HypreInterface >;
+#endif
+
+#ifdef GEOSX_USE_PETSC
+template class MultiBlockPreconditioner< PetscInterface >;
+#endif
+
+}
@@ -0,0 +1,193 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file MultiBlockPreconditioner.hpp
+ */
+
+#ifndef GEOSX_LINEARALGEBRA_SOLVERS_MULTIBLOCKPRECONDITIONER_HPP_
+#define GEOSX_LINEARALGEBRA_SOLVERS_MULTIBLOCKPRECONDITIONER_HPP_
+
+#include "linearAlgebra/solvers/BlockPreconditioner.hpp"
+
+namespace geosx
+{
+
+/*
+ * This class extends the 2x2 block preconditioner to an arbitrary number of blocks N.
+ * Blocks are eliminated in the order in which they are numbered, i.e. block @f$ i @f$ is
+ * preconditioned with @f$ M_{i}^{-1} ~= S_{ii}^{-1} @f$ and (optional) nested approximate Schur complement
+ * @f$ S_{ii} ~= A_{ii} - \sum_{j<i} A_{ij} M_{j}^{-1} A_{ji} @f$,
+ * where the inverse of preceding Schur complements is approximated according to SchurComplementOption
+ * (e.g. FirstBlockDiagonal uses @f$ diag(S_{jj})^{-1} @f$ for every preceding block @f$ j @f$).
+ * Couplings between preceding blocks are neglected in the Schur complement approximation.
+ *
+ * Depending on BlockShapeOption, the preconditioner applies:
+ *  - Diagonal: @f$ D^{-1} @f$ (block-Jacobi);
+ *  - LowerTriangular: @f$ (LD)^{-1} @f$ (forward block Gauss-Seidel sweep, blocks in increasing order);
+ *  - UpperTriangular: @f$ (DU)^{-1} @f$ (backward block Gauss-Seidel sweep, blocks in decreasing order);
+ *  - LowerUpperTriangular: @f$ (LDU)^{-1} @f$ (forward sweep followed by backward sweep).
+ *
+ * With N = 2 this reproduces BlockPreconditioner.
+ */
+
+/**
+ * @brief General NxN block preconditioner with nested approximate Schur complements.
+ * @tparam LAI type of linear algebra interface providing matrix/vector types
+ */
+template< typename LAI >
+class MultiBlockPreconditioner : public PreconditionerBase< LAI >
+{
+public:
+
+  /// Alias for the base type
+  using Base = PreconditionerBase< LAI >;
+
+  /// Alias for the vector type
+  using Vector = typename Base::Vector;
+
+  /// Alias for the matrix type
+  using Matrix = typename Base::Matrix;
+
+  /**
+   * @brief Constructor.
+   * @param numBlocks number of blocks
+   * @param shapeOption preconditioner block shape
+   * @param schurOption type of Schur complement approximation to use
+   * @param scalingOption type of scaling to apply to blocks
+   */
+  MultiBlockPreconditioner( localIndex const numBlocks,
+                            BlockShapeOption const shapeOption,
+                            SchurComplementOption const schurOption,
+                            BlockScalingOption const scalingOption );
+
+  /**
+   * @brief Destructor.
+   */
+  virtual ~MultiBlockPreconditioner() override;
+
+  /**
+   * @brief Setup data for one of the blocks.
+   * @param blockIndex index of the block to set up
+   * @param blockDofs choice of DoF components (from a monolithic system)
+   * @param solver instance of the inner preconditioner for the block
+   * @param scaling user-provided row scaling coefficient for this block
+   *
+   * @note Blocks of the monolithic system must not overlap. DoF components of the last block
+   *       may be left empty, in which case all components not selected by other blocks are used.
+   */
+  void setupBlock( localIndex const blockIndex,
+                   std::vector< DofManager::SubComponent > blockDofs,
+                   std::unique_ptr< PreconditionerBase< LAI > > solver,
+                   real64 const scaling = 1.0 );
+
+  /**
+   * @brief @return the number of blocks
+   */
+  localIndex numBlocks() const
+  {
+    return LvArray::integerConversion< localIndex >( m_solvers.size() );
+  }
+
+  /**
+   * @name PreconditionerBase interface methods
+   */
+  ///@{
+
+  using PreconditionerBase< LAI >::setup;
+
+  /**
+   * @brief Compute the preconditioner from a matrix
+   * @param mat the matrix to precondition
+   */
+  virtual void setup( Matrix const & mat ) override;
+
+  /**
+   * @brief Apply operator to a vector
+   * @param src Input vector (x).
+   * @param dst Output vector (b).
+   *
+   * @warning @p src and @p dst cannot alias the same vector (some implementations may allow this).
+   */
+  virtual void apply( Vector const & src, Vector & dst ) const override;
+
+  virtual void clear() override;
+
+  ///@}
+
+private:
+
+  /**
+   * @brief Initialize/resize internal data structures for a new linear system.
+   * @param mat the new system matrix
+   * @param dofManager the new dof manager
+   */
+  void reinitialize( Matrix const & mat, DofManager const & dofManager );
+
+  /**
+   * @brief Apply block scaling to system blocks (which must be already extracted).
+   */
+  void applyBlockScaling();
+
+  /**
+   * @brief Compute and apply the Schur complement contributions of preceding blocks to a diagonal block.
+   * @param blockIndex index of the block to modify (all preceding block solvers must be set up)
+   */
+  void computeSchurComplement( localIndex const blockIndex );
+
+  /**
+   * @brief Perform a forward or backward block sweep.
+   * @param forward if @p true, blocks are visited in increasing order and lower blocks are used to update rhs
+   * @param first index of the first block to solve in the sweep
+   */
+  void sweep( bool const forward, localIndex const first ) const;
+
+  /// Shape of the block preconditioner
+  BlockShapeOption m_shapeOption;
+
+  /// Type of Schur complement to construct
+  SchurComplementOption m_schurOption;
+
+  /// Whether to scale blocks to equilibrate norms
+  BlockScalingOption m_scalingOption;
+
+  /// Description of dof components making up each block
+  std::vector< std::vector< DofManager::SubComponent > > m_blockDofs;
+
+  /// Restriction operators for each sub-block
+  std::vector< Matrix > m_restrictors;
+
+  /// Prolongation operators for each sub-block
+  std::vector< Matrix > m_prolongators;
+
+  /// Matrix blocks
+  BlockOperator< Vector, Matrix > m_matBlocks;
+
+  /// Individual block preconditioners
+  std::vector< std::unique_ptr< PreconditionerBase< LAI > > > m_solvers;
+
+  /// Scaling of each block
+  std::vector< real64 > m_scaling;
+
+  /// Internal vector of block residuals
+  mutable BlockVector< Vector > m_rhs;
+
+  /// Internal vector of block solutions
+  mutable BlockVector< Vector > m_sol;
+};
+
+} //namespace geosx
+
+#endif //GEOSX_LINEARALGEBRA_SOLVERS_MULTIBLOCKPRECONDITIONER_HPP_
@@ -0,0 +1,159 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file testBatchedDenseLA.cpp
+ */
+
+#include "common/DataTypes.hpp"
+#include "linearAlgebra/interfaces/dense/BatchedDenseLA.hpp"
+#include "linearAlgebra/unitTests/testLinearAlgebraUtils.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace geosx;
+
+namespace
+{
+
+integer constexpr N = 4;
+localIndex constexpr batchSize = 1000;
+real64 constexpr tol = 1e-12;
+
+/**
+ * @brief Fill a batch with symmetric, diagonally dominant matrices that differ across the batch.
+ */
+array3d< real64, BatchedDenseLA::MatrixPermutation > createBatch()
+{
+  array3d< real64, BatchedDenseLA::MatrixPermutation > A( batchSize, N, N );
+  for( localIndex k = 0; k < batchSize; ++k )
+  {
+    for( integer i = 0; i < N; ++i )
+    {
+      for( integer j = 0; j <= i; ++j )
+      {
+        real64 const value = std::sin( 1.0 + k + 3.0 * i + 7.0 * j );
+        A( k, i, j ) = value;
+        A( k, j, i ) = value;
+      }
+      A( k, i, i ) += 2.0 * N;
+    }
+  }
+  return A;
+}
+
+} // namespace
+
+TEST( BatchedDenseLA, invert )
+{
+  array3d< real64, BatchedDenseLA::MatrixPermutation > const A = createBatch();
+  array3d< real64, BatchedDenseLA::MatrixPermutation > Ainv = createBatch();
+  EXPECT_EQ( ( BatchedDenseLA::invert< N, parallelHostPolicy >( Ainv.toView() ) ), 0 );
+
+  for( localIndex k = 0; k < batchSize; ++k )
+  {
+    for( integer i = 0; i < N; ++i )
+    {
+      for( integer j = 0; j < N; ++j )
+      {
+        real64 sum = 0.0;
+        for( integer l = 0; l < N; ++l )
+        {
+          sum += A( k, i, l ) * Ainv( k, l, j );
+        }
+        EXPECT_NEAR( sum, i == j ? 1.0 : 0.0, tol );
+      }
+    }
+  }
+}
+
+TEST( BatchedDenseLA, solve )
+{
+  array3d< real64, BatchedDenseLA::MatrixPermutation > const A = createBatch();
+  array2d< real64, BatchedDenseLA::VectorPermutation > x( batchSize, N );
+  array2d< real64, BatchedDenseLA::VectorPermutation > b( batchSize, N );
+  for( localIndex k = 0; k < batchSize; ++k )
+  {
+    for( integer i = 0; i < N; ++i )
+    {
+      x( k, i ) = std::cos( 2.0 * k + i );
+    }
+    for( integer i = 0; i < N; ++i )
+    {
+      b( k, i ) = 0.0;
+      for( integer j = 0; j < N; ++j )
+      {
+        b( k, i ) += A( k, i, j ) * x( k, j );
+      }
+    }
+  }
+
+  EXPECT_EQ( ( BatchedDenseLA::solve< N, parallelHostPolicy >( A.toViewConst(), b.toView() ) ), 0 );
+
+  for( localIndex k = 0; k < batchSize; ++k )
+  {
+    for( integer i = 0; i < N; ++i )
+    {
+      EXPECT_NEAR( b( k, i ), x( k, i ), tol );
+    }
+  }
+}
+
+TEST( BatchedDenseLA, singular )
+{
+  array3d< real64, BatchedDenseLA::MatrixPermutation > A( 2, N, N );
+  A( 0, 0, 0 ) = 1.0;
+  for( integer i = 0; i < N; ++i )
+  {
+    A( 1, i, i ) = 1.0;
+  }
+  EXPECT_EQ( ( BatchedDenseLA::invert< N, serialPolicy >( A.toView() ) ), 1 );
+}
+
+TEST( BatchedDenseLA, symmetricEigen )
+{
+  array3d< real64, BatchedDenseLA::MatrixPermutation > const A = createBatch();
+  array2d< real64, BatchedDenseLA::VectorPermutation > lambda( batchSize, N );
+  array3d< real64, BatchedDenseLA::MatrixPermutation > V( batchSize, N, N );
+
+  BatchedDenseLA::symmetricEigen< N, parallelHostPolicy >( A.toViewConst(), lambda.toView(), V.toView() );
+
+  for( localIndex k = 0; k < batchSize; ++k )
+  {
+    for( integer m = 0; m < N; ++m )
+    {
+      if( m > 0 )
+      {
+        EXPECT_LE( lambda( k, m - 1 ), lambda( k, m ) );
+      }
+      // A * v_m = lambda_m * v_m
+      for( integer i = 0; i < N; ++i )
+      {
+        real64 sum = 0.0;
+        for( integer j = 0; j < N; ++j )
+        {
+          sum += A( k, i, j ) * V( k, j, m );
+        }
+        EXPECT_NEAR( sum, lambda( k, m ) * V( k, i, m ), 10 * N * tol );
+      }
+    }
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  geosx::testing::LinearAlgebraTestScope scope( argc, argv );
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,307 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file testBlockCRSMatrix.cpp
+ */
+
+#include "common/DataTypes.hpp"
+#include "linearAlgebra/interfaces/native/BlockCRSOperator.hpp"
+#include "linearAlgebra/solvers/BlockCRSPreconditioner.hpp"
+#include "linearAlgebra/solvers/KrylovSolver.hpp"
+#include "linearAlgebra/unitTests/testLinearAlgebraUtils.hpp"
+#include "mesh/mpiCommunications/CommunicationTools.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace geosx;
+
+template< typename LAI >
+class BlockCRSMatrixTest : public ::testing::Test
+{
+public:
+
+  using Matrix = typename LAI::ParallelMatrix;
+  using Vector = typename LAI::ParallelVector;
+
+protected:
+
+  void compareApply( Matrix const & matrix, integer const blockSize )
+  {
+    BlockCRSOperator< LAI > blockOp;
+    blockOp.setup( matrix, blockSize );
+
+    EXPECT_EQ( blockOp.numGlobalRows(), matrix.numGlobalRows() );
+    EXPECT_EQ( blockOp.numLocalRows(), matrix.numLocalRows() );
+    EXPECT_EQ( blockOp.matrix().blockSize(), blockSize );
+
+    Vector x, y, z;
+    x.create( matrix.numLocalCols(), matrix.comm() );
+    y.create( matrix.numLocalRows(), matrix.comm() );
+    z.create( matrix.numLocalRows(), matrix.comm() );
+
+    x.rand( 1984 );
+    matrix.apply( x, y );
+    blockOp.apply( x, z );
+
+    z.axpy( -1.0, y );
+    EXPECT_LT( z.norm2(), 1e-12 * y.norm2() );
+  }
+
+  void testSolve( Matrix const & matrix,
+                  BlockCRSSmootherType const type,
+                  integer const blockSize,
+                  integer const numSweeps,
+                  bool const singlePrecision = false )
+  {
+    BlockCRSPreconditioner< LAI > precond( type, blockSize, numSweeps, singlePrecision );
+    precond.setup( matrix );
+
+    Vector sol_true, sol_comp, rhs;
+    sol_true.create( matrix.numLocalCols(), matrix.comm() );
+    sol_comp.create( matrix.numLocalCols(), matrix.comm() );
+    rhs.create( matrix.numLocalRows(), matrix.comm() );
+
+    sol_true.rand( 1984 );
+    sol_comp.zero();
+    matrix.apply( sol_true, rhs );
+
+    LinearSolverParameters params;
+    params.krylov.relTolerance = 1e-8;
+    params.krylov.maxIterations = 500;
+    params.solverType = LinearSolverParameters::SolverType::gmres;
+
+    // Use the block operator for matrix-vector products as well
+    std::unique_ptr< KrylovSolver< Vector > > const solver =
+      KrylovSolver< Vector >::create( params, precond.blockOperator(), precond );
+    solver->solve( rhs, sol_comp );
+    EXPECT_TRUE( solver->result().success() );
+
+    sol_comp.axpy( -1.0, sol_true );
+    EXPECT_LT( sol_comp.norm2() / sol_true.norm2(), 1e-4 );
+  }
+};
+
+TYPED_TEST_SUITE_P( BlockCRSMatrixTest );
+
+TYPED_TEST_P( BlockCRSMatrixTest, ApplyScalar )
+{
+  typename TypeParam::ParallelMatrix matrix;
+  geosx::testing::compute2DLaplaceOperator( MPI_COMM_GEOSX, 20, matrix );
+  this->compareApply( matrix, 1 );
+}
+
+TYPED_TEST_P( BlockCRSMatrixTest, ApplyBlock )
+{
+  typename TypeParam::ParallelMatrix matrix;
+  geosx::testing::compute2DElasticityOperator( MPI_COMM_GEOSX, 1.0, 1.0, 20, 20, 10000., 0.2, matrix );
+  this->compareApply( matrix, 2 );
+}
+
+TYPED_TEST_P( BlockCRSMatrixTest, InteriorBoundarySplit )
+{
+  using Matrix = typename TypeParam::ParallelMatrix;
+
+  Matrix matrix;
+  geosx::testing::compute2DLaplaceOperator( MPI_COMM_GEOSX, 20, matrix );
+
+  BlockCRSOperator< TypeParam > blockOp;
+  blockOp.setup( matrix, 1 );
+  BlockCRSMatrix const & blockMatrix = blockOp.matrix();
+
+  // Count the rows that reference columns owned by other ranks
+  array1d< globalIndex > rowOffsets( matrix.numLocalRows() + 1 );
+  array1d< globalIndex > colIndices( matrix.numLocalNonzeros() );
+  array1d< real64 > values( matrix.numLocalNonzeros() );
+  typename Matrix::Export exporter;
+  exporter.exportCRS( matrix, rowOffsets.toView(), colIndices.toView(), values.toView() );
+
+  localIndex numBoundaryRows = 0;
+  for( localIndex i = 0; i < matrix.numLocalRows(); ++i )
+  {
+    bool boundary = false;
+    for( globalIndex k = rowOffsets[i]; k < rowOffsets[i + 1]; ++k )
+    {
+      boundary = boundary || colIndices[k] < matrix.ilower() || colIndices[k] >= matrix.iupper();
+    }
+    numBoundaryRows += boundary ? 1 : 0;
+  }
+
+  EXPECT_EQ( blockMatrix.numBoundaryBlockRows(), numBoundaryRows );
+  EXPECT_EQ( blockMatrix.numInteriorBlockRows() + blockMatrix.numBoundaryBlockRows(), blockMatrix.numLocalBlockRows() );
+  if( MpiWrapper::commSize( MPI_COMM_GEOSX ) > 1 )
+  {
+    // with a row partition of the grid, every rank has both kinds of rows
+    EXPECT_GT( blockMatrix.numBoundaryBlockRows(), 0 );
+    EXPECT_GT( blockMatrix.numInteriorBlockRows(), 0 );
+  }
+  else
+  {
+    EXPECT_EQ( blockMatrix.numBoundaryBlockRows(), 0 );
+  }
+
+  // the split product matches the product of the linear algebra package
+  this->compareApply( matrix, 1 );
+}
+
+TYPED_TEST_P( BlockCRSMatrixTest, BlockJacobi )
+{
+  typename TypeParam::ParallelMatrix matrix;
+  geosx::testing::compute2DElasticityOperator( MPI_COMM_GEOSX, 1.0, 1.0, 20, 20, 10000., 0.2, matrix );
+  this->testSolve( matrix, BlockCRSSmootherType::Jacobi, 2, 2 );
+}
+
+TYPED_TEST_P( BlockCRSMatrixTest, BlockILU0 )
+{
+  typename TypeParam::ParallelMatrix matrix;
+  geosx::testing::compute2DElasticityOperator( MPI_COMM_GEOSX, 1.0, 1.0, 20, 20, 10000., 0.2, matrix );
+  this->testSolve( matrix, BlockCRSSmootherType::ILU0, 2, 1 );
+}
+
+TYPED_TEST_P( BlockCRSMatrixTest, BlockILU0_SinglePrecision )
+{
+  typename TypeParam::ParallelMatrix matrix;
+  geosx::testing::compute2DElasticityOperator( MPI_COMM_GEOSX, 1.0, 1.0, 20, 20, 10000., 0.2, matrix );
+  this->testSolve( matrix, BlockCRSSmootherType::ILU0, 2, 1, true );
+}
+
+TYPED_TEST_P( BlockCRSMatrixTest, SchwarzILU0 )
+{
+  typename TypeParam::ParallelMatrix matrix;
+  geosx::testing::compute2DElasticityOperator( MPI_COMM_GEOSX, 1.0, 1.0, 20, 20, 10000., 0.2, matrix );
+  this->testSolve( matrix, BlockCRSSmootherType::SchwarzILU0, 2, 1 );
+}
+
+TYPED_TEST_P( BlockCRSMatrixTest, UpdateOperator )
+{
+  using Vector = typename TypeParam::ParallelVector;
+
+  typename TypeParam::ParallelMatrix matrix;
+  geosx::testing::compute2DElasticityOperator( MPI_COMM_GEOSX, 1.0, 1.0, 20, 20, 10000., 0.2, matrix );
+
+  BlockCRSPreconditioner< TypeParam > precond( BlockCRSSmootherType::ILU0, 2 );
+  precond.setup( matrix );
+
+  // Reusing the preconditioner for new values of the matrix must keep the operator up to date
+  matrix.scale( 2.0 );
+  precond.updateOperator( matrix );
+
+  Vector x, y, z;
+  x.create( matrix.numLocalCols(), matrix.comm() );
+  y.create( matrix.numLocalRows(), matrix.comm() );
+  z.create( matrix.numLocalRows(), matrix.comm() );
+
+  x.rand( 1984 );
+  matrix.apply( x, y );
+  precond.blockOperator().apply( x, z );
+
+  z.axpy( -1.0, y );
+  EXPECT_LT( z.norm2(), 1e-12 * y.norm2() );
+}
+
+TYPED_TEST_P( BlockCRSMatrixTest, SetupFromLocalMatrix )
+{
+  using Matrix = typename TypeParam::ParallelMatrix;
+  using Vector = typename TypeParam::ParallelVector;
+
+  Matrix matrix;
+  geosx::testing::compute2DElasticityOperator( MPI_COMM_GEOSX, 1.0, 1.0, 20, 20, 10000., 0.2, matrix );
+
+  // Recover the local rows the matrix would have been assembled from
+  array1d< globalIndex > rowOffsets( matrix.numLocalRows() + 1 );
+  array1d< globalIndex > colIndices( matrix.numLocalNonzeros() );
+  array1d< real64 > values( matrix.numLocalNonzeros() );
+  typename Matrix::Export exporter;
+  exporter.exportCRS( matrix, rowOffsets.toView(), colIndices.toView(), values.toView() );
+
+  CRSMatrix< real64, globalIndex > localMatrix( matrix.numLocalRows(), matrix.numGlobalCols(), matrix.maxRowLength() );
+  for( localIndex i = 0; i < matrix.numLocalRows(); ++i )
+  {
+    localMatrix.insertNonZeros( i,
+                                colIndices.data() + rowOffsets[i],
+                                values.data() + rowOffsets[i],
+                                LvArray::integerConversion< localIndex >( rowOffsets[i + 1] - rowOffsets[i] ) );
+  }
+
+  BlockCRSPreconditioner< TypeParam > precond( BlockCRSSmootherType::ILU0, 2 );
+  precond.setup( matrix, localMatrix.toViewConst(), true );
+  localIndex const numNonzeroBlocks = precond.blockOperator().matrix().numLocalNonzeroBlocks();
+
+  // New values with an unchanged pattern are copied in place into the existing block operator
+  matrix.scale( 2.0 );
+  for( localIndex i = 0; i < localMatrix.numRows(); ++i )
+  {
+    arraySlice1d< real64 > const entries = localMatrix.getEntries( i );
+    for( localIndex k = 0; k < entries.size(); ++k )
+    {
+      entries[k] *= 2.0;
+    }
+  }
+  precond.setup( matrix, localMatrix.toViewConst(), false );
+  EXPECT_EQ( precond.blockOperator().matrix().numLocalNonzeroBlocks(), numNonzeroBlocks );
+
+  Vector x, y, z;
+  x.create( matrix.numLocalCols(), matrix.comm() );
+  y.create( matrix.numLocalRows(), matrix.comm() );
+  z.create( matrix.numLocalRows(), matrix.comm() );
+
+  x.rand( 1984 );
+  matrix.apply( x, y );
+  precond.blockOperator().apply( x, z );
+
+  z.axpy( -1.0, y );
+  EXPECT_LT( z.norm2(), 1e-12 * y.norm2() );
+}
+
+TYPED_TEST_P( BlockCRSMatrixTest, CreatePreconditioner )
+{
+  LinearSolverParameters params;
+  params.preconditionerType = LinearSolverParameters::PreconditionerType::blockILU0;
+  params.native.blockSize = 2;
+
+  std::unique_ptr< PreconditionerBase< TypeParam > > const precond = TypeParam::createPreconditioner( params );
+  EXPECT_NE( dynamic_cast< BlockCRSPreconditioner< TypeParam > * >( precond.get() ), nullptr );
+}
+
+REGISTER_TYPED_TEST_SUITE_P( BlockCRSMatrixTest,
+                             ApplyScalar,
+                             ApplyBlock,
+                             InteriorBoundarySplit,
+                             BlockJacobi,
+                             BlockILU0,
+                             BlockILU0_SinglePrecision,
+                             SchwarzILU0,
+                             UpdateOperator,
+                             SetupFromLocalMatrix,
+                             CreatePreconditioner );
+
+#ifdef GEOSX_USE_TRILINOS
+INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, BlockCRSMatrixTest, TrilinosInterface, );
+#endif
+
+#ifdef GEOSX_USE_HYPRE
+INSTANTIATE_TYPED_TEST_SUITE_P( Hypre, BlockCRSMatrixTest, HypreInterface, );
+#endif
+
+#ifdef GEOSX_USE_PETSC
+INSTANTIATE_TYPED_TEST_SUITE_P( Petsc, BlockCRSMatrixTest, PetscInterface, );
+#endif
+
+int main( int argc, char * * argv )
+{
+  geosx::testing::LinearAlgebraTestScope scope( argc, argv );
+  // Block matrices take their message tags from the shared communication ID pool
+  CommunicationTools commTools;
+  return RUN_ALL_TESTS();
+}
@@ -103,35 +103,70 @@ protected:
   Matrix matrix;
   real64 cond_est = 1.0;
 
-  void test( LinearSolverParameters const & params )
+  void solveAndCheck( LinearSolverBase< LAI > & solver,
+                      Matrix const & mat,
+                      real64 const relTol )
   {
     // Create a random "true" solution vector
     Vector sol_true;
-    sol_true.create( matrix.numLocalCols(), matrix.comm() );
+    sol_true.create( mat.numLocalCols(), mat.comm() );
     sol_true.rand( 1984 );
 
     // Create and compute the right-hand side vector
     Vector rhs;
-    rhs.create( matrix.numLocalRows(), matrix.comm() );
-    matrix.apply( sol_true, rhs );
+    rhs.create( mat.numLocalRows(), mat.comm() );
+    mat.apply( sol_true, rhs );
 
     // Create and zero out the computed solution vector
     Vector sol_comp;
     sol_comp.create( sol_true.localSize(), sol_true.comm() );
     sol_comp.zero();
 
-    // Create the solver and solve the system
-    auto solver = LAI::createSolver( params );
-    solver->setup( matrix );
-    solver->solve( rhs, sol_comp );
-    EXPECT_TRUE( solver->result().success() );
+    // Solve the system
+    solver.solve( rhs, sol_comp );
+    EXPECT_TRUE( solver.result().success() );
 
     // Check that solution is within epsilon of true
     Vector sol_diff( sol_comp );
     sol_diff.axpy( -1.0, sol_true );
-    real64 const relTol = cond_est * params.krylov.relTolerance;
     EXPECT_LT( sol_diff.norm2() / sol_true.norm2(), relTol );
   }
+
+  void test( LinearSolverParameters const & params )
+  {
+    // Create the solver and solve the system
+    auto solver = LAI::createSolver( params );
+    solver->setup( matrix );
+    solveAndCheck( *solver, matrix, cond_est * params.krylov.relTolerance );
+  }
+
+  void testResolve( LinearSolverParameters const & params, bool const releaseNumeric = false )
+  {
+    // Same sparsity pattern with new values: a random non-negative shift of the diagonal
+    Vector random;
+    random.create( matrix.numLocalRows(), matrix.comm() );
+    random.rand( 2021 );
+    Vector shift;
+    shift.create( matrix.numLocalRows(), matrix.comm() );
+    random.pointwiseProduct( random, shift );
+
+    Matrix newMatrix( matrix );
+    newMatrix.addDiagonal( shift, matrix.normMax() );
+
+    // The second setup of the same solver may reuse the data computed from the pattern of the first one,
+    // but the shift only increases diagonal dominance, so that the condition number estimate still holds
+    auto solver = LAI::createSolver( params );
+    solver->setup( matrix );
+    solveAndCheck( *solver, matrix, cond_est * params.krylov.relTolerance );
+    if( releaseNumeric )
+    {
+      // Only the data depending on the pattern is kept (as done at the end of a time step)
+      solver->releaseNumericFactorization();
+      EXPECT_FALSE( solver->ready() );
+    }
+    solver->setup( newMatrix );
+    solveAndCheck( *solver, newMatrix, cond_est * params.krylov.relTolerance );
+  }
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////
@@ -171,6 +206,30 @@ TYPED_TEST_P( SolverTestLaplace2D, DirectParallel )
   this->test( params_DirectParallel() );
 }
 
+TYPED_TEST_P( SolverTestLaplace2D, DirectSerialResolve )
+{
+  LinearSolverParameters params = params_DirectSerial();
+  params.isSymmetric = true;
+  this->testResolve( params );
+}
+
+TYPED_TEST_P( SolverTestLaplace2D, DirectParallelResolve )
+{
+  this->testResolve( params_DirectParallel() );
+}
+
+TYPED_TEST_P( SolverTestLaplace2D, DirectSerialResolveReleased )
+{
+  LinearSolverParameters params = params_DirectSerial();
+  params.isSymmetric = true;
+  this->testResolve( params, true );
+}
+
+TYPED_TEST_P( SolverTestLaplace2D, DirectParallelResolveReleased )
+{
+  this->testResolve( params_DirectParallel(), true );
+}
+
 TYPED_TEST_P( SolverTestLaplace2D, GMRES_ILU )
 {
   this->test( params_GMRES_ILU() );
@@ -189,6 +248,10 @@ TYPED_TEST_P( SolverTestLaplace2D, CG_AMG )
 REGISTER_TYPED_TEST_SUITE_P( SolverTestLaplace2D,
                              DirectSerial,
                              DirectParallel,
+                             DirectSerialResolve,
+                             DirectParallelResolve,
+                             DirectSerialResolveReleased,
+                             DirectParallelResolveReleased,
                              GMRES_ILU,
                              CG_SGS,
                              CG_AMG );
@@ -238,6 +301,16 @@ TYPED_TEST_P( SolverTestElasticity2D, DirectParallel )
   this->test( params_DirectParallel() );
 }
 
+TYPED_TEST_P( SolverTestElasticity2D, DirectSerialResolve )
+{
+  this->testResolve( params_DirectSerial() );
+}
+
+TYPED_TEST_P( SolverTestElasticity2D, DirectParallelResolve )
+{
+  this->testResolve( params_DirectParallel() );
+}
+
 TYPED_TEST_P( SolverTestElasticity2D, GMRES_AMG )
 {
   LinearSolverParameters params = params_GMRES_AMG();
@@ -249,6 +322,8 @@ TYPED_TEST_P( SolverTestElasticity2D, GMRES_AMG )
 REGISTER_TYPED_TEST_SUITE_P( SolverTestElasticity2D,
                              DirectSerial,
                              DirectParallel,
+                             DirectSerialResolve,
+                             DirectParallelResolve,
                              GMRES_AMG );
 
 #ifdef GEOSX_USE_TRILINOS
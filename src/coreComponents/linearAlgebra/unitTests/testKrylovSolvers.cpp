@@ -18,9 +18,11 @@
 
 #include "common/DataTypes.hpp"
 #include "linearAlgebra/solvers/PreconditionerIdentity.hpp"
+#include "linearAlgebra/solvers/GmresSolver.hpp"
 #include "linearAlgebra/solvers/KrylovSolver.hpp"
 #include "linearAlgebra/unitTests/testLinearAlgebraUtils.hpp"
 #include "linearAlgebra/utilities/BlockOperatorWrapper.hpp"
+#include "linearAlgebra/utilities/JacobianFreeOperator.hpp"
 
 #include <gtest/gtest.h>
 
@@ -54,6 +56,20 @@ LinearSolverParameters params_GMRES()
   return parameters;
 }
 
+LinearSolverParameters params_GMRES_CGS()
+{
+  LinearSolverParameters parameters = params_GMRES();
+  parameters.krylov.orthogonalization = geosx::LinearSolverParameters::Krylov::Orthogonalization::cgs;
+  return parameters;
+}
+
+LinearSolverParameters params_GMRES_CGS2()
+{
+  LinearSolverParameters parameters = params_GMRES();
+  parameters.krylov.orthogonalization = geosx::LinearSolverParameters::Krylov::Orthogonalization::cgs2;
+  return parameters;
+}
+
 template< typename OPERATOR, typename PRECOND, typename VECTOR >
 class KrylovSolverTestBase : public ::testing::Test
 {
@@ -153,10 +169,87 @@ TYPED_TEST_P( KrylovSolverTest, GMRES )
   this->test( params_GMRES() );
 }
 
+TYPED_TEST_P( KrylovSolverTest, GMRES_CGS )
+{
+  this->test( params_GMRES_CGS() );
+}
+
+TYPED_TEST_P( KrylovSolverTest, GMRES_CGS2 )
+{
+  this->test( params_GMRES_CGS2() );
+}
+
+TYPED_TEST_P( KrylovSolverTest, GMRES_JacobianFree )
+{
+  using Vector = typename TypeParam::ParallelVector;
+
+  // Linear residual F(u) = A*u around u = 0, so that finite differences reproduce A exactly
+  Vector baseResidual( this->rhs_true );
+  baseResidual.zero();
+  Vector work( this->sol_true );
+  auto residualFunction = [&]( Vector const & dir, real64 const step, Vector & res )
+  {
+    work.copy( dir );
+    work.scale( step );
+    this->matrix.apply( work, res );
+  };
+  JacobianFreeOperator< Vector > const jacobian( residualFunction, baseResidual, 1.0, 0.0 );
+
+  this->sol_true.rand( 1984 );
+  this->sol_comp.zero();
+  this->matrix.apply( this->sol_true, this->rhs_true );
+
+  LinearSolverParameters const params = params_GMRES();
+  std::unique_ptr< KrylovSolver< Vector > > const solver = KrylovSolver< Vector >::create( params, jacobian, this->precond );
+  solver->solve( this->rhs_true, this->sol_comp );
+  EXPECT_TRUE( solver->result().success() );
+  EXPECT_GT( jacobian.numEvaluations(), 0 );
+
+  Vector sol_diff( this->sol_comp );
+  sol_diff.axpy( -1.0, this->sol_true );
+  EXPECT_LT( sol_diff.norm2() / this->sol_true.norm2(), this->cond_est * params.krylov.relTolerance );
+}
+
+TYPED_TEST_P( KrylovSolverTest, GMRES_Recycle )
+{
+  using Vector = typename TypeParam::ParallelVector;
+
+  LinearSolverParameters params = params_GMRES();
+  params.krylov.maxRestart = 10;
+  params.krylov.recycleSize = 5;
+
+  KrylovRecycleSpace< Vector > recycleSpace;
+  array1d< integer > numIterations( 2 );
+  for( integer solve = 0; solve < 2; ++solve )
+  {
+    this->sol_true.rand( 1984 + solve );
+    this->sol_comp.zero();
+    this->matrix.apply( this->sol_true, this->rhs_true );
+
+    GmresSolver< Vector > solver( params, this->matrix, this->precond );
+    solver.setRecycleSpace( &recycleSpace );
+    solver.solve( this->rhs_true, this->sol_comp );
+    EXPECT_TRUE( solver.result().success() );
+    EXPECT_EQ( recycleSpace.size(), params.krylov.recycleSize );
+    numIterations[solve] = solver.result().numIterations;
+
+    Vector sol_diff( this->sol_comp );
+    sol_diff.axpy( -1.0, this->sol_true );
+    EXPECT_LT( sol_diff.norm2() / this->sol_true.norm2(), this->cond_est * params.krylov.relTolerance );
+  }
+
+  // Deflating recycled low modes should not slow down a solve with the same operator
+  EXPECT_LE( numIterations[1], numIterations[0] );
+}
+
 REGISTER_TYPED_TEST_SUITE_P( KrylovSolverTest,
                              CG,
                              BiCGSTAB,
-                             GMRES );
+                             GMRES,
+                             GMRES_CGS,
+                             GMRES_CGS2,
+                             GMRES_JacobianFree,
+                             GMRES_Recycle );
 
 #ifdef GEOSX_USE_TRILINOS
 INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, KrylovSolverTest, TrilinosInterface, );
@@ -243,10 +336,22 @@ TYPED_TEST_P( KrylovSolverBlockTest, GMRES )
   this->test( params_GMRES() );
 }
 
+TYPED_TEST_P( KrylovSolverBlockTest, GMRES_CGS )
+{
+  this->test( params_GMRES_CGS() );
+}
+
+TYPED_TEST_P( KrylovSolverBlockTest, GMRES_CGS2 )
+{
+  this->test( params_GMRES_CGS2() );
+}
+
 REGISTER_TYPED_TEST_SUITE_P( KrylovSolverBlockTest,
                              CG,
                              BiCGSTAB,
-                             GMRES );
+                             GMRES,
+                             GMRES_CGS,
+                             GMRES_CGS2 );
 
 #ifdef GEOSX_USE_TRILINOS
 INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, KrylovSolverBlockTest, TrilinosInterface, );
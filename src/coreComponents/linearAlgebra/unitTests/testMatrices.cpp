@@ -278,9 +278,60 @@ TYPED_TEST_P( MatrixTest, RectangularMatrixOperations )
   EXPECT_DOUBLE_EQ( c, std::sqrt( static_cast< real64 >( nRows * ( nRows + 1 ) * ( 2 * nRows + 1 ) ) / 3.0 ) );
 }
 
+TYPED_TEST_P( MatrixTest, UpdateValues )
+{
+  using Matrix = typename TypeParam::ParallelMatrix;
+
+  int const rank = MpiWrapper::commRank( MPI_COMM_GEOSX );
+  int const nproc = MpiWrapper::commSize( MPI_COMM_GEOSX );
+
+  // Construct a local tridiagonal CRS matrix
+  localIndex const localSize = 10;
+  globalIndex const N = localSize * nproc;
+  globalIndex const ilower = rank * localSize;
+
+  CRSMatrix< real64, globalIndex > localMatrix( localSize, N, 3 );
+  for( localIndex localRow = 0; localRow < localSize; ++localRow )
+  {
+    globalIndex const row = ilower + localRow;
+    if( row > 0 )
+    {
+      localMatrix.insertNonZero( localRow, row - 1, -1.0 );
+    }
+    localMatrix.insertNonZero( localRow, row, 2.0 );
+    if( row < N - 1 )
+    {
+      localMatrix.insertNonZero( localRow, row + 1, -1.0 );
+    }
+  }
+
+  Matrix A;
+  A.create( localMatrix.toViewConst(), localSize, MPI_COMM_GEOSX );
+  globalIndex const numNonzeros = A.numGlobalNonzeros();
+  EXPECT_DOUBLE_EQ( A.normInf(), 4.0 );
+
+  // Modify values only and update the parallel matrix in place
+  localMatrix.move( LvArray::MemorySpace::host, true );
+  for( localIndex localRow = 0; localRow < localSize; ++localRow )
+  {
+    arraySlice1d< real64 > const entries = localMatrix.getEntries( localRow );
+    for( localIndex k = 0; k < entries.size(); ++k )
+    {
+      entries[k] *= 3.0;
+    }
+  }
+  A.updateValues( localMatrix.toViewConst() );
+
+  EXPECT_TRUE( A.ready() );
+  EXPECT_EQ( A.numGlobalNonzeros(), numNonzeros );
+  EXPECT_DOUBLE_EQ( A.normInf(), 12.0 );
+  EXPECT_DOUBLE_EQ( A.norm1(), 12.0 );
+}
+
 REGISTER_TYPED_TEST_SUITE_P( MatrixTest,
                              MatrixMatrixOperations,
-                             RectangularMatrixOperations );
+                             RectangularMatrixOperations,
+                             UpdateValues );
 
 #ifdef GEOSX_USE_TRILINOS
 INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, MatrixTest, TrilinosInterface, );
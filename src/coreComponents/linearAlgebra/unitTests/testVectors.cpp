@@ -278,6 +278,32 @@ TYPED_TEST_P( VectorTest, dotProduct )
   EXPECT_DOUBLE_EQ( dp, x.globalSize() );
 }
 
+TYPED_TEST_P( VectorTest, multiDotProduct )
+{
+  using Vector = typename TypeParam::ParallelVector;
+
+  Vector x;
+  createAndAssemble< parallelDevicePolicy<> >( 3, x );
+
+  Vector y( x );
+  y.reciprocal();
+
+  Vector z( x );
+  z.scale( 2.0 );
+
+  array1d< Vector const * > vecs( 3 );
+  vecs[0] = &x;
+  vecs[1] = &y;
+  vecs[2] = &z;
+
+  array1d< real64 > dp( 3 );
+  x.multiDot( vecs.toSliceConst(), dp.toSlice() );
+
+  EXPECT_DOUBLE_EQ( dp[0], x.dot( x ) );
+  EXPECT_DOUBLE_EQ( dp[1], x.globalSize() );
+  EXPECT_DOUBLE_EQ( dp[2], 2.0 * dp[0] );
+}
+
 TYPED_TEST_P( VectorTest, axpy )
 {
   using Vector = typename TypeParam::ParallelVector;
@@ -358,6 +384,7 @@ REGISTER_TYPED_TEST_SUITE_P( VectorTest,
                              scaleValues,
                              reciprocal,
                              dotProduct,
+                             multiDotProduct,
                              axpy,
                              axpby,
                              norm1,
@@ -101,6 +101,15 @@ public:
    */
   real64 dot( BlockVectorView const & x ) const;
 
+  /**
+   * @brief Dot products with a set of block vectors.
+   * @param vecs pointers to block vectors to compute products with
+   * @param result output array of dot products, must be the same size as @p vecs
+   * @note Performs one global reduction per block.
+   */
+  void multiDot( arraySlice1d< BlockVectorView const * const > const & vecs,
+                 arraySlice1d< real64 > const & result ) const;
+
   /**
    * @brief 2-norm of the block vector.
    * @return 2-norm of the block vector
@@ -305,6 +314,32 @@ real64 BlockVectorView< VECTOR >::dot( BlockVectorView const & src ) const
   return accum;
 }
 
+template< typename VECTOR >
+void BlockVectorView< VECTOR >::multiDot( arraySlice1d< BlockVectorView const * const > const & vecs,
+                                          arraySlice1d< real64 > const & result ) const
+{
+  GEOSX_LAI_ASSERT_EQ( vecs.size(), result.size() );
+  array1d< VECTOR const * > blockVecs( vecs.size() );
+  array1d< real64 > blockResult( vecs.size() );
+  for( localIndex k = 0; k < vecs.size(); ++k )
+  {
+    GEOSX_LAI_ASSERT_EQ( blockSize(), vecs[k]->blockSize() );
+    result[k] = 0.0;
+  }
+  for( localIndex i = 0; i < blockSize(); i++ )
+  {
+    for( localIndex k = 0; k < vecs.size(); ++k )
+    {
+      blockVecs[k] = &vecs[k]->block( i );
+    }
+    block( i ).multiDot( blockVecs.toSliceConst(), blockResult.toSlice() );
+    for( localIndex k = 0; k < vecs.size(); ++k )
+    {
+      result[k] += blockResult[k];
+    }
+  }
+}
+
 template< typename VECTOR >
 real64 BlockVectorView< VECTOR >::norm2() const
 {
@@ -0,0 +1,172 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file JacobianFreeOperator.hpp
+ */
+#ifndef GEOSX_LINEARALGEBRA_JACOBIANFREEOPERATOR_HPP_
+#define GEOSX_LINEARALGEBRA_JACOBIANFREEOPERATOR_HPP_
+
+#include "common/LinearOperator.hpp"
+
+#include <functional>
+
+namespace geosx
+{
+
+/**
+ * @brief Represents the Jacobian of a nonlinear residual as a linear operator,
+ *        applied through first-order finite differences of residual evaluations.
+ * @tparam VECTOR type of vectors the operator can be applied to
+ *
+ * The product is approximated as <tt>J*v = sign * (F(u + h*v) - F(u)) / h</tt>,
+ * with the step <tt>h = perturbation * (1 + ||u||) / ||v||</tt> relative to the size of the solution,
+ * so that a perturbation close to the square root of the machine precision balances truncation and round-off errors.
+ */
+template< typename VECTOR >
+class JacobianFreeOperator : public LinearOperator< VECTOR >
+{
+public:
+
+  /// Alias for base type
+  using Base = LinearOperator< VECTOR >;
+
+  /// Alias for vector type
+  using Vector = typename Base::Vector;
+
+  /**
+   * @brief Type of residual evaluation function.
+   *
+   * Called as <tt>func( v, h, r )</tt>, must compute <tt>r = F(u + h*v)</tt>
+   * and leave the state @p u unchanged on return.
+   */
+  using ResidualFunction = std::function< void ( Vector const &, real64, Vector & ) >;
+
+  /**
+   * @brief Constructor
+   * @param residualFunction the residual evaluation function
+   * @param baseResidual residual at the linearization point, <tt>F(u)</tt> (must outlive this operator)
+   * @param perturbation relative size of the finite-difference perturbation
+   * @param solutionNorm norm of the solution at the linearization point, <tt>||u||</tt>
+   * @param sign factor applied to the difference quotient (e.g. -1 if the residual is assembled with opposite sign)
+   */
+  JacobianFreeOperator( ResidualFunction residualFunction,
+                        Vector const & baseResidual,
+                        real64 const perturbation,
+                        real64 const solutionNorm,
+                        real64 const sign = 1.0 )
+    : m_residualFunction( std::move( residualFunction ) ),
+    m_baseResidual( baseResidual ),
+    m_perturbation( perturbation * ( 1.0 + solutionNorm ) ),
+    m_sign( sign )
+  {
+    GEOSX_ERROR_IF_LE_MSG( perturbation, 0.0, "JacobianFreeOperator: perturbation must be positive" );
+  }
+
+  /**
+   * @brief Destructor.
+   */
+  virtual ~JacobianFreeOperator() override = default;
+
+  /**
+   * @brief Apply operator to a vector.
+   * @param src input vector
+   * @param dst output vector
+   *
+   * @warning @p src and @p dst cannot alias the same vector.
+   */
+  void apply( Vector const & src, Vector & dst ) const override
+  {
+    real64 const srcNorm = src.norm2();
+    if( srcNorm <= 0.0 )
+    {
+      dst.zero();
+      return;
+    }
+
+    real64 const step = m_perturbation / srcNorm;
+    m_residualFunction( src, step, dst );
+    dst.axpby( -m_sign / step, m_baseResidual, m_sign / step );
+    ++m_numEvaluations;
+  }
+
+  /**
+   * @brief @return the global number of rows
+   */
+  globalIndex numGlobalRows() const override
+  {
+    return m_baseResidual.globalSize();
+  }
+
+  /**
+   * @brief @return the global number of columns
+   */
+  globalIndex numGlobalCols() const override
+  {
+    return m_baseResidual.globalSize();
+  }
+
+  /**
+   * @brief @return the local number of rows
+   */
+  localIndex numLocalRows() const override
+  {
+    return m_baseResidual.localSize();
+  }
+
+  /**
+   * @brief @return the local number of columns
+   */
+  localIndex numLocalCols() const override
+  {
+    return m_baseResidual.localSize();
+  }
+
+  /**
+   * @brief @return the communicator
+   */
+  MPI_Comm comm() const override
+  {
+    return m_baseResidual.comm();
+  }
+
+  /**
+   * @brief @return the number of residual evaluations performed so far
+   */
+  integer numEvaluations() const
+  {
+    return m_numEvaluations;
+  }
+
+private:
+
+  /// the residual evaluation function
+  ResidualFunction m_residualFunction;
+
+  /// residual at the linearization point
+  Vector const & m_baseResidual;
+
+  /// norm of the finite-difference perturbation, scaled by the size of the solution
+  real64 m_perturbation;
+
+  /// sign applied to the difference quotient
+  real64 m_sign;
+
+  /// number of residual evaluations
+  integer mutable m_numEvaluations = 0;
+};
+
+} // namespace geosx
+
+#endif //GEOSX_LINEARALGEBRA_JACOBIANFREEOPERATOR_HPP_
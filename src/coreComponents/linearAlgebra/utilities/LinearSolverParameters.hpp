@@ -66,6 +66,9 @@ struct LinearSolverParameters
     block,     ///< Block preconditioner
     direct,    ///< Direct solver as preconditioner
     bgs,       ///< Gauss-Seidel smoothing (backward sweep)
+    blockJacobi, ///< Point-block Jacobi (native)
+    blockILU0, ///< Point-block ILU(0) of the rank-local matrix (native)
+    schwarz,   ///< Restricted additive Schwarz with one layer of overlap and point-block ILU(0) subdomain solves (native)
   };
 
   integer logLevel = 0;     ///< Output level [0=none, 1=basic, 2=everything]
@@ -114,14 +117,45 @@ struct LinearSolverParameters
   /// Krylov-method parameters
   struct Krylov
   {
+    /**
+     * @brief Orthogonalization scheme for the Krylov basis (GMRES only)
+     */
+    enum class Orthogonalization : integer
+    {
+      mgs,  ///< modified Gram-Schmidt, one global reduction per basis vector
+      cgs,  ///< classical Gram-Schmidt, one global reduction per iteration
+      cgs2  ///< classical Gram-Schmidt with reorthogonalization, two global reductions per iteration
+    };
+
     real64 relTolerance = 1e-6;       ///< Relative convergence tolerance for iterative solvers
     integer maxIterations = 200;      ///< Max iterations before declaring convergence failure
     integer maxRestart = 200;         ///< Max number of vectors in Krylov basis before restarting
     integer useAdaptiveTol = false;   ///< Use Eisenstat-Walker adaptive tolerance
     real64 weakestTol = 1e-3;         ///< Weakest allowed tolerance when using adaptive method
+    Orthogonalization orthogonalization = Orthogonalization::mgs; ///< Orthogonalization scheme (GMRES only)
+    integer recycleSize = 0;          ///< Number of vectors recycled across consecutive solves (GMRES only)
   }
   krylov;                             ///< Krylov-method parameter struct
 
+  /// Preconditioner setup reuse parameters
+  struct Reuse
+  {
+    /**
+     * @brief Policy for reusing a preconditioner setup across consecutive solves
+     */
+    enum class Policy : integer
+    {
+      none,    ///< Recompute the preconditioner for every solve
+      fixed,   ///< Recompute the preconditioner after a fixed number of solves
+      adaptive ///< Recompute the preconditioner when Krylov iteration count grows (or after a fixed number of solves)
+    };
+
+    Policy policy = Policy::none;   ///< Preconditioner reuse policy
+    integer maxSolves = 10;         ///< Max number of solves performed with the same preconditioner setup
+    real64 iterGrowthFactor = 1.5;  ///< Recompute when iterations exceed this factor times those of the first solve after setup
+  }
+  reuse;                            ///< Preconditioner reuse parameter struct
+
   /// Matrix-scaling parameters
   struct Scaling
   {
@@ -245,6 +279,15 @@ struct LinearSolverParameters
     integer overlap = 0;   ///< Ghost overlap
   }
   dd;                      ///< Domain decomposition parameter struct
+
+  /// Native (GEOSX-implemented) preconditioner parameters
+  struct Native
+  {
+    integer blockSize = 1;        ///< Size of dense blocks (number of unknowns per node or cell)
+    integer numSweeps = 1;        ///< Number of preconditioner sweeps per application
+    integer singlePrecision = 0;  ///< Whether to store and apply factors in single precision
+  }
+  native;                         ///< Native preconditioner parameter struct
 };
 
 /// Declare strings associated with enumeration values.
@@ -273,7 +316,22 @@ ENUM_STRINGS( LinearSolverParameters::PreconditionerType,
               "mgr",
               "block",
               "direct",
-              "bgs" );
+              "bgs",
+              "blockJacobi",
+              "blockILU0",
+              "schwarz" );
+
+/// Declare strings associated with enumeration values.
+ENUM_STRINGS( LinearSolverParameters::Krylov::Orthogonalization,
+              "mgs",
+              "cgs",
+              "cgs2" );
+
+/// Declare strings associated with enumeration values.
+ENUM_STRINGS( LinearSolverParameters::Reuse::Policy,
+              "none",
+              "fixed",
+              "adaptive" );
 
 /// Declare strings associated with enumeration values.
 ENUM_STRINGS( LinearSolverParameters::Direct::ColPerm,
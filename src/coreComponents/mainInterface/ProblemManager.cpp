@@ -18,6 +18,7 @@
 #include "initialization.hpp"
 
 #include "codingUtilities/StringUtilities.hpp"
+#include "common/MpiWrapper.hpp"
 #include "common/Path.hpp"
 #include "common/TimingMacros.hpp"
 #include "constitutive/ConstitutiveManager.hpp"
@@ -181,6 +182,13 @@ void ProblemManager::parseCommandLineInput()
   outputDirectory = opts.outputDirectory;
   OutputBase::setOutputDirectory( outputDirectory );
 
+  // Each time slice of the parallel-in-time driver writes its outputs in its own directory
+  int const sliceSize = MpiWrapper::commSize( MPI_COMM_GEOSX );
+  if( MpiWrapper::commSize( MPI_COMM_WORLD ) > sliceSize )
+  {
+    OutputBase::setTimeSlice( MpiWrapper::commRank( MPI_COMM_WORLD ) / sliceSize );
+  }
+
   string & inputFileName = commandLine.getReference< string >( viewKeys.inputFileName );
   inputFileName = xmlWrapper::buildMultipleInputXML( opts.inputFileNames, outputDirectory );
 
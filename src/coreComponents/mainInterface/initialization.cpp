@@ -100,6 +100,7 @@ std::unique_ptr< CommandLineOptions > parseCommandLineOptions( int argc, char *
     TIMERS,
     SUPPRESS_MOVE_LOGGING,
     PAUSE_FOR,
+    TIME_SLICES,
   };
 
   const option::Descriptor usage[] =
@@ -119,6 +120,7 @@ std::unique_ptr< CommandLineOptions > parseCommandLineOptions( int argc, char *
     { TIMERS, 0, "t", "timers", Arg::nonEmpty, "\t-t, --timers, \t String specifying the type of timer output." },
     { SUPPRESS_MOVE_LOGGING, 0, "", "suppress-move-logging", Arg::None, "\t--suppress-move-logging \t Suppress logging of host-device data migration" },
     { PAUSE_FOR, 0, "", "pause-for", Arg::numeric, "\t--pause-for, \t Pause geosx for a given number of seconds before starting execution" },
+    { TIME_SLICES, 0, "", "time-slices", Arg::numeric, "\t--time-slices, \t Number of time slices for the parallel-in-time (Parareal) event loop" },
     { 0, 0, nullptr, nullptr, nullptr, nullptr }
   };
 
@@ -228,6 +230,11 @@ std::unique_ptr< CommandLineOptions > parseCommandLineOptions( int argc, char *
         std::this_thread::sleep_for( std::chrono::seconds( duration ) );
       }
       break;
+      case TIME_SLICES:
+      {
+        commandLineOptions->numTimeSlices = std::stoi( opt.arg );
+      }
+      break;
     }
   }
 
@@ -261,7 +268,9 @@ std::unique_ptr< CommandLineOptions > basicSetup( int argc, char * argv[], bool
 
   if( parseCommandLine )
   {
-    return parseCommandLineOptions( argc, argv );
+    std::unique_ptr< CommandLineOptions > commandLineOptions = parseCommandLineOptions( argc, argv );
+    setupTimeSlices( commandLineOptions->numTimeSlices );
+    return commandLineOptions;
   }
   else
   {
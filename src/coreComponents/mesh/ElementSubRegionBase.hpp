@@ -21,6 +21,7 @@
 
 #include "mesh/ElementType.hpp"
 #include "mesh/ObjectManagerBase.hpp"
+#include "mesh/utilities/MeshMapUtilities.hpp"
 
 namespace geosx
 {
@@ -180,6 +181,66 @@ public:
 
   ///@}
 
+  /**
+   * @name Element coloring
+   */
+  ///@{
+
+  /**
+   * @brief Group the elements by color, so that two elements of the same color never share a node.
+   * @tparam NODE_MAP the type of the element-to-node map
+   * @param[in] elemsToNodes the element-to-node map
+   * @param[in] numNodes the number of nodes of the mesh
+   * @return true if the coloring is available, false if it would need too many colors
+   * @details The coloring (or its failure) is computed once and reused as long as the number of elements does not change.
+   */
+  template< typename NODE_MAP >
+  bool computeElementColoring( NODE_MAP const & elemsToNodes,
+                               localIndex const numNodes )
+  {
+    if( m_numColoredElements == size() )
+    {
+      return m_colorOffsets.size() > 0;
+    }
+    m_numColoredElements = size();
+
+    integer const numColors =
+      meshMapUtilities::colorObjects( size(),
+                                      numNodes,
+                                      [&]( localIndex const k, auto && nodeLambda )
+    {
+      for( localIndex a = 0; a < meshMapUtilities::size1( elemsToNodes, k ); ++a )
+      {
+        nodeLambda( elemsToNodes[k][a] );
+      }
+    },
+                                      m_colorOffsets,
+                                      m_elementsByColor );
+    if( numColors < 0 )
+    {
+      m_colorOffsets.clear();
+      m_elementsByColor.clear();
+      return false;
+    }
+    return true;
+  }
+
+  /**
+   * @brief Get the offsets of each color in the list of elements sorted by color.
+   * @return a view on the color offsets (empty if computeElementColoring has not succeeded)
+   */
+  arrayView1d< localIndex const > getColorOffsets() const
+  { return m_colorOffsets.toViewConst(); }
+
+  /**
+   * @brief Get the elements sorted by color.
+   * @return a view on the elements sorted by color
+   */
+  arrayView1d< localIndex const > getElementsByColor() const
+  { return m_elementsByColor.toViewConst(); }
+
+  ///@}
+
   /**
    * @brief A struct to serve as a container for variable strings and keys.
    * @struct viewKeyStruct
@@ -218,6 +279,15 @@ private:
   /// Group in which the constitutive models of this subregion are registered
   dataRepository::Group m_constitutiveModels;
 
+  /// Offsets of each color in m_elementsByColor
+  array1d< localIndex > m_colorOffsets;
+
+  /// Elements sorted by color, two elements of the same color do not share a node
+  array1d< localIndex > m_elementsByColor;
+
+  /// Number of elements when the coloring was last attempted (-1 if never attempted)
+  localIndex m_numColoredElements = -1;
+
 protected:
   /// Number of nodes per element in this subregion.
   localIndex m_numNodesPerElement;
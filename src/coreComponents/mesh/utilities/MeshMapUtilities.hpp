@@ -20,6 +20,8 @@
 
 #include "common/DataTypes.hpp"
 
+#include <vector>
+
 namespace geosx
 {
 
@@ -225,6 +227,75 @@ inline localIndex numElements( ArrayOfSetsView< T const > const & map )
   return size;
 }
 
+//////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Greedy coloring of a set of objects, such that two objects writing to the same target
+ *        (e.g. two elements sharing a node) never get the same color.
+ * @tparam FUNC type of the function enumerating the targets of an object
+ * @param[in] numObjects the number of objects to color
+ * @param[in] numTargets the number of targets
+ * @param[in] forTargets function called as forTargets( object, targetLambda ), which must call
+ *                       targetLambda( target ) for each target of the object
+ * @param[out] colorOffsets the offsets of each color in @p objectsByColor (size is the number of colors + 1)
+ * @param[out] objectsByColor the objects sorted by color
+ * @return the number of colors, or -1 if more than 64 colors would be needed
+ *
+ * This is a host-only setup function. Objects of the same color can be processed concurrently without atomics.
+ */
+template< typename FUNC >
+integer colorObjects( localIndex const numObjects,
+                      localIndex const numTargets,
+                      FUNC && forTargets,
+                      array1d< localIndex > & colorOffsets,
+                      array1d< localIndex > & objectsByColor )
+{
+  // colors already used by the objects writing to each target, as a bit mask
+  std::vector< std::uint64_t > targetColors( numTargets, 0 );
+  array1d< integer > objectColor( numObjects );
+  integer numColors = 0;
+
+  for( localIndex obj = 0; obj < numObjects; ++obj )
+  {
+    std::uint64_t forbidden = 0;
+    forTargets( obj, [&]( localIndex const target ) { forbidden |= targetColors[target]; } );
+    if( forbidden == ~std::uint64_t( 0 ) )
+    {
+      return -1;
+    }
+
+    integer color = 0;
+    while( forbidden & ( std::uint64_t( 1 ) << color ) )
+    {
+      ++color;
+    }
+    forTargets( obj, [&]( localIndex const target ) { targetColors[target] |= std::uint64_t( 1 ) << color; } );
+    objectColor[obj] = color;
+    numColors = std::max( numColors, color + 1 );
+  }
+  // counting sort of the objects by color
+  colorOffsets.resize( numColors + 1 );
+  colorOffsets.zero();
+  for( localIndex obj = 0; obj < numObjects; ++obj )
+  {
+    ++colorOffsets[objectColor[obj] + 1];
+  }
+  for( integer color = 0; color < numColors; ++color )
+  {
+    colorOffsets[color + 1] += colorOffsets[color];
+  }
+
+  array1d< localIndex > cursor( numColors );
+  objectsByColor.resize( numObjects );
+  for( localIndex obj = 0; obj < numObjects; ++obj )
+  {
+    integer const color = objectColor[obj];
+    objectsByColor[colorOffsets[color] + cursor[color]++] = obj;
+  }
+
+  return numColors;
+}
+
 } // namespace meshMapUtilities
 
 } // namespace geosx
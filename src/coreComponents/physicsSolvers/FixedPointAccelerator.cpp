@@ -0,0 +1,264 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file FixedPointAccelerator.cpp
+ */
+
+#include "FixedPointAccelerator.hpp"
+
+#include "common/MpiWrapper.hpp"
+#include "linearAlgebra/interfaces/dense/BlasLapackLA.hpp"
+
+namespace geosx
+{
+
+namespace
+{
+
+real64 maskedDot( arrayView1d< real64 const > const & x,
+                  arrayView1d< real64 const > const & y,
+                  arrayView1d< integer const > const & ghostRank )
+{
+  RAJA::ReduceSum< parallelHostReduce, real64 > localDot( 0.0 );
+  forAll< parallelHostPolicy >( x.size(), [=] ( localIndex const i )
+  {
+    if( ghostRank[i] < 0 )
+    {
+      localDot += x[i] * y[i];
+    }
+  } );
+  return MpiWrapper::sum( localDot.get() );
+}
+
+} // namespace
+
+FixedPointAccelerator::FixedPointAccelerator( Type const type,
+                                              integer const windowSize,
+                                              real64 const relaxation ):
+  m_type( type ),
+  m_windowSize( windowSize ),
+  m_relaxation( relaxation ),
+  m_omega( relaxation ),
+  m_numIterations( 0 ),
+  m_numStored( 0 ),
+  m_nextSlot( 0 )
+{
+  GEOSX_ERROR_IF_LT_MSG( windowSize, 1, "FixedPointAccelerator: window size must be at least 1" );
+  GEOSX_ERROR_IF_LE_MSG( relaxation, 0.0, "FixedPointAccelerator: relaxation factor must be positive" );
+}
+
+FixedPointAccelerator::FixedPointAccelerator( NonlinearSolverParameters const & params ):
+  FixedPointAccelerator( params.m_couplingAcceleration,
+                         params.m_couplingAccelerationWindow,
+                         params.m_couplingRelaxation )
+{}
+
+void FixedPointAccelerator::reset( arrayView1d< real64 const > const & values )
+{
+  localIndex const size = values.size();
+
+  m_omega = m_relaxation;
+  m_numIterations = 0;
+  m_numStored = 0;
+  m_nextSlot = 0;
+
+  m_iterate.resize( size );
+  m_residual.resize( size );
+  m_prevResidual.resize( size );
+  m_prevOutput.resize( size );
+  if( m_type == Type::Anderson )
+  {
+    m_deltaResidual.resize( m_windowSize, size );
+    m_deltaOutput.resize( m_windowSize, size );
+  }
+
+  arrayView1d< real64 > const iterate = m_iterate.toView();
+  forAll< parallelHostPolicy >( size, [=] ( localIndex const i )
+  {
+    iterate[i] = values[i];
+  } );
+}
+
+void FixedPointAccelerator::computeAndersonCoefficients( arrayView1d< real64 const > const & residual,
+                                                         arrayView1d< integer const > const & ghostRank,
+                                                         array1d< real64 > & gamma ) const
+{
+  integer const m = m_numStored;
+
+  // Assemble the normal equations of min |r_k - dR g| with a single global reduction
+  array1d< real64 > localSums( m * m + m );
+  for( integer a = 0; a < m; ++a )
+  {
+    arraySlice1d< real64 const > const dRa = m_deltaResidual[a];
+    for( integer b = a; b < m; ++b )
+    {
+      arraySlice1d< real64 const > const dRb = m_deltaResidual[b];
+      real64 sum = 0.0;
+      for( localIndex i = 0; i < residual.size(); ++i )
+      {
+        sum += ghostRank[i] < 0 ? dRa[i] * dRb[i] : 0.0;
+      }
+      localSums[a * m + b] = sum;
+      localSums[b * m + a] = sum;
+    }
+    real64 sum = 0.0;
+    for( localIndex i = 0; i < residual.size(); ++i )
+    {
+      sum += ghostRank[i] < 0 ? dRa[i] * residual[i] : 0.0;
+    }
+    localSums[m * m + a] = sum;
+  }
+
+  array1d< real64 > globalSums( m * m + m );
+  MpiWrapper::allReduce( localSums.data(), globalSums.data(), LvArray::integerConversion< int >( localSums.size() ), MPI_SUM, MPI_COMM_GEOSX );
+
+  array2d< real64 > H( m, m );
+  for( integer a = 0; a < m; ++a )
+  {
+    for( integer b = 0; b < m; ++b )
+    {
+      H( a, b ) = globalSums[a * m + b];
+    }
+  }
+
+  // Solve with a truncated pseudo-inverse, since residual differences quickly become nearly dependent
+  array2d< real64 > U( m, m );
+  array1d< real64 > S( m );
+  array2d< real64 > VT( m, m );
+  BlasLapackLA::matrixSVD( H.toSliceConst(), U.toSlice(), S.toSlice(), VT.toSlice() );
+
+  gamma.resize( m );
+  gamma.zero();
+  real64 const cutoff = S[0] * 1.0e-12;
+  for( integer k = 0; k < m; ++k )
+  {
+    if( S[k] <= cutoff )
+    {
+      break;
+    }
+    real64 coef = 0.0;
+    for( integer a = 0; a < m; ++a )
+    {
+      coef += U( a, k ) * globalSums[m * m + a];
+    }
+    coef /= S[k];
+    for( integer a = 0; a < m; ++a )
+    {
+      gamma[a] += VT( k, a ) * coef;
+    }
+  }
+}
+
+void FixedPointAccelerator::accelerate( arrayView1d< real64 > const & values,
+                                        arrayView1d< integer const > const & ghostRank )
+{
+  localIndex const size = values.size();
+  GEOSX_ERROR_IF_NE_MSG( size, m_iterate.size(), "FixedPointAccelerator: size of coupling variables has changed since reset" );
+
+  arrayView1d< real64 > const iterate = m_iterate.toView();
+  arrayView1d< real64 > const residual = m_residual.toView();
+  arrayView1d< real64 > const prevResidual = m_prevResidual.toView();
+  arrayView1d< real64 > const prevOutput = m_prevOutput.toView();
+
+  forAll< parallelHostPolicy >( size, [=] ( localIndex const i )
+  {
+    residual[i] = values[i] - iterate[i];
+  } );
+
+  switch( m_type )
+  {
+    case Type::None:
+    {
+      break;
+    }
+    case Type::Aitken:
+    {
+      if( m_numIterations > 0 )
+      {
+        // Reuse the previous residual storage for the residual difference
+        forAll< parallelHostPolicy >( size, [=] ( localIndex const i )
+        {
+          prevResidual[i] = residual[i] - prevResidual[i];
+        } );
+        real64 const den = maskedDot( prevResidual.toViewConst(), prevResidual.toViewConst(), ghostRank );
+        if( den > 0.0 )
+        {
+          real64 const num = maskedDot( residual.toViewConst(), prevResidual.toViewConst(), ghostRank ) - den;
+          m_omega = -m_omega * num / den;
+        }
+      }
+
+      real64 const omega = m_omega;
+      forAll< parallelHostPolicy >( size, [=] ( localIndex const i )
+      {
+        prevResidual[i] = residual[i];
+        values[i] = iterate[i] + omega * residual[i];
+      } );
+      break;
+    }
+    case Type::Anderson:
+    {
+      if( m_numIterations > 0 )
+      {
+        arraySlice1d< real64 > const deltaResidual = m_deltaResidual[m_nextSlot];
+        arraySlice1d< real64 > const deltaOutput = m_deltaOutput[m_nextSlot];
+        for( localIndex i = 0; i < size; ++i )
+        {
+          deltaResidual[i] = residual[i] - prevResidual[i];
+          deltaOutput[i] = values[i] - prevOutput[i];
+        }
+        m_nextSlot = ( m_nextSlot + 1 ) % m_windowSize;
+        m_numStored = std::min( m_numStored + 1, m_windowSize );
+      }
+
+      array1d< real64 > gamma;
+      if( m_numStored > 0 )
+      {
+        computeAndersonCoefficients( residual.toViewConst(), ghostRank, gamma );
+      }
+
+      integer const numStored = m_numStored;
+      real64 const beta = m_relaxation;
+      arrayView1d< real64 const > const coefs = gamma.toViewConst();
+      arrayView2d< real64 const > const deltaResidual = m_deltaResidual.toViewConst();
+      arrayView2d< real64 const > const deltaOutput = m_deltaOutput.toViewConst();
+      forAll< parallelHostPolicy >( size, [=] ( localIndex const i )
+      {
+        prevResidual[i] = residual[i];
+        prevOutput[i] = values[i];
+        real64 next = iterate[i] + beta * residual[i];
+        for( integer a = 0; a < numStored; ++a )
+        {
+          next -= coefs[a] * ( deltaOutput( a, i ) - ( 1.0 - beta ) * deltaResidual( a, i ) );
+        }
+        values[i] = next;
+      } );
+      break;
+    }
+    default:
+    {
+      GEOSX_ERROR( "FixedPointAccelerator: unsupported acceleration type" );
+    }
+  }
+
+  forAll< parallelHostPolicy >( size, [=] ( localIndex const i )
+  {
+    iterate[i] = values[i];
+  } );
+  ++m_numIterations;
+}
+
+} /* namespace geosx */
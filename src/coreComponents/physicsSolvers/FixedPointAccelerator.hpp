@@ -0,0 +1,149 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file FixedPointAccelerator.hpp
+ */
+
+#ifndef GEOSX_PHYSICSSOLVERS_FIXEDPOINTACCELERATOR_HPP_
+#define GEOSX_PHYSICSSOLVERS_FIXEDPOINTACCELERATOR_HPP_
+
+#include "physicsSolvers/NonlinearSolverParameters.hpp"
+
+namespace geosx
+{
+
+/**
+ * @class FixedPointAccelerator
+ * @brief Accelerates the fixed-point iteration x_{k+1} = G(x_k) on the coupling variables of a sequential coupling loop.
+ *
+ * The caller registers the initial iterate with reset() at the beginning of a coupling loop, applies the
+ * sub-solvers to obtain G(x_k), and calls accelerate() to replace G(x_k) with the accelerated iterate x_{k+1}.
+ * Two schemes are available:
+ *  - Aitken: x_{k+1} = x_k + w_k r_k with r_k = G(x_k) - x_k and the dynamic relaxation factor
+ *    w_k = -w_{k-1} r_{k-1}.(r_k - r_{k-1}) / |r_k - r_{k-1}|^2;
+ *  - Anderson: x_{k+1} = x_k + b r_k - sum_i g_i ( dX_i + b dR_i ), where dX_i, dR_i are differences of the
+ *    last m iterates and residuals and g minimizes |r_k - sum_i g_i dR_i| (b being the mixing parameter).
+ *
+ * Values are stored as a flat local array; entries with non-negative ghost rank are updated but excluded
+ * from global inner products, so that all ranks compute consistent coefficients.
+ */
+class FixedPointAccelerator
+{
+public:
+
+  /// Alias for the acceleration type
+  using Type = NonlinearSolverParameters::CouplingAcceleration;
+
+  /**
+   * @brief Constructor.
+   * @param type type of acceleration
+   * @param windowSize number of previous iterates used in Anderson mixing
+   * @param relaxation initial Aitken relaxation factor or Anderson mixing parameter
+   */
+  FixedPointAccelerator( Type const type,
+                         integer const windowSize,
+                         real64 const relaxation );
+
+  /**
+   * @brief Constructor from nonlinear solver parameters.
+   * @param params the parameters of the coupled solver
+   */
+  explicit FixedPointAccelerator( NonlinearSolverParameters const & params );
+
+  /**
+   * @brief Start a new coupling loop.
+   * @param values the initial iterate x_0
+   */
+  void reset( arrayView1d< real64 const > const & values );
+
+  /**
+   * @brief Compute the next iterate.
+   * @param values on input, the result of a fixed-point sweep G(x_k); on output, the accelerated iterate x_{k+1}
+   * @param ghostRank ghost rank of each entry, used to exclude non-owned entries from inner products
+   */
+  void accelerate( arrayView1d< real64 > const & values,
+                   arrayView1d< integer const > const & ghostRank );
+
+  /**
+   * @return the type of acceleration
+   */
+  Type type() const { return m_type; }
+
+  /**
+   * @return the number of accelerated iterations since the last reset
+   */
+  integer numIterations() const { return m_numIterations; }
+
+  /**
+   * @return the last relaxation factor used in Aitken acceleration
+   */
+  real64 relaxationFactor() const { return m_omega; }
+
+private:
+
+  /**
+   * @brief Compute the Anderson mixing coefficients from the stored residual differences.
+   * @param residual the current residual r_k
+   * @param ghostRank ghost rank of each entry
+   * @param gamma the resulting coefficients
+   */
+  void computeAndersonCoefficients( arrayView1d< real64 const > const & residual,
+                                    arrayView1d< integer const > const & ghostRank,
+                                    array1d< real64 > & gamma ) const;
+
+  /// Type of acceleration
+  Type m_type;
+
+  /// Number of previous iterates used in Anderson mixing
+  integer m_windowSize;
+
+  /// Initial relaxation factor / mixing parameter
+  real64 m_relaxation;
+
+  /// Current Aitken relaxation factor
+  real64 m_omega;
+
+  /// Number of iterations since the last reset
+  integer m_numIterations;
+
+  /// Number of differences stored in the Anderson window
+  integer m_numStored;
+
+  /// Position of the next difference to be overwritten in the Anderson window
+  integer m_nextSlot;
+
+  /// Current iterate x_k
+  array1d< real64 > m_iterate;
+
+  /// Current residual r_k
+  array1d< real64 > m_residual;
+
+  /// Previous residual r_{k-1}
+  array1d< real64 > m_prevResidual;
+
+  /// Previous sweep result G(x_{k-1})
+  array1d< real64 > m_prevOutput;
+
+  /// Window of residual differences (one per row)
+  array2d< real64 > m_deltaResidual;
+
+  /// Window of sweep result differences (one per row)
+  array2d< real64 > m_deltaOutput;
+};
+
+} /* namespace geosx */
+
+#endif /* GEOSX_PHYSICSSOLVERS_FIXEDPOINTACCELERATOR_HPP_ */
@@ -18,6 +18,8 @@
 
 #include "LinearSolverParameters.hpp"
 
+#include "linearAlgebra/solvers/BlockCRSPreconditioner.hpp"
+
 namespace geosx
 {
 using namespace dataRepository;
@@ -113,6 +115,39 @@ LinearSolverParametersInput::LinearSolverParametersInput( string const & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "Weakest-allowed tolerance for adaptive method" );
 
+  registerWrapper( viewKeyStruct::krylovOrthogonalizationString(), &m_parameters.krylov.orthogonalization ).
+    setApplyDefaultValue( m_parameters.krylov.orthogonalization ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Orthogonalization scheme of the Krylov basis (GMRES only): "
+                    "modified Gram-Schmidt (one global reduction per basis vector), "
+                    "classical Gram-Schmidt (one global reduction per iteration), "
+                    "or classical Gram-Schmidt with reorthogonalization (two global reductions per iteration). "
+                    "Available options are: ``" + EnumStrings< LinearSolverParameters::Krylov::Orthogonalization >::concat( "|" ) + "``" );
+
+  registerWrapper( viewKeyStruct::krylovRecycleSizeString(), &m_parameters.krylov.recycleSize ).
+    setApplyDefaultValue( m_parameters.krylov.recycleSize ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Number of approximate low-mode vectors kept from a linear solve and deflated in the next one (GMRES only). "
+                    "If positive, iterative solves use GEOSX native Krylov solvers. Set to 0 to disable recycling" );
+
+  registerWrapper( viewKeyStruct::precondReusePolicyString(), &m_parameters.reuse.policy ).
+    setApplyDefaultValue( m_parameters.reuse.policy ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Policy for reusing the preconditioner setup across consecutive linear solves "
+                    "(Newton iterations and time steps). If enabled, iterative solves use GEOSX native Krylov solvers. "
+                    "Available options are: ``" + EnumStrings< LinearSolverParameters::Reuse::Policy >::concat( "|" ) + "``" );
+
+  registerWrapper( viewKeyStruct::precondReuseMaxSolvesString(), &m_parameters.reuse.maxSolves ).
+    setApplyDefaultValue( m_parameters.reuse.maxSolves ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Maximum number of linear solves performed with the same preconditioner setup" );
+
+  registerWrapper( viewKeyStruct::precondReuseIterGrowthString(), &m_parameters.reuse.iterGrowthFactor ).
+    setApplyDefaultValue( m_parameters.reuse.iterGrowthFactor ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "With ``adaptive`` reuse policy, the preconditioner is recomputed when the number of Krylov iterations "
+                    "exceeds this factor times the number of iterations of the first solve after the last setup" );
+
   registerWrapper( viewKeyStruct::amgNumSweepsString(), &m_parameters.amg.numSweeps ).
     setApplyDefaultValue( m_parameters.amg.numSweeps ).
     setInputFlag( InputFlags::OPTIONAL ).
@@ -174,6 +209,21 @@ LinearSolverParametersInput::LinearSolverParametersInput( string const & name,
     setApplyDefaultValue( m_parameters.ifact.threshold ).
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "ILU(T) threshold factor" );
+
+  registerWrapper( viewKeyStruct::nativeBlockSizeString(), &m_parameters.native.blockSize ).
+    setApplyDefaultValue( m_parameters.native.blockSize ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Size of dense blocks (number of unknowns per node or cell) in native point-block preconditioners" );
+
+  registerWrapper( viewKeyStruct::nativeNumSweepsString(), &m_parameters.native.numSweeps ).
+    setApplyDefaultValue( m_parameters.native.numSweeps ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Number of sweeps per application of native point-block preconditioners" );
+
+  registerWrapper( viewKeyStruct::nativeSinglePrecisionString(), &m_parameters.native.singlePrecision ).
+    setApplyDefaultValue( m_parameters.native.singlePrecision ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Whether native point-block preconditioners store and apply their factors in single precision" );
 }
 
 void LinearSolverParametersInput::postProcessInput()
@@ -188,16 +238,27 @@ void LinearSolverParametersInput::postProcessInput()
   GEOSX_ERROR_IF( binaryOptions.count( m_parameters.direct.replaceTinyPivot ) == 0, viewKeyStruct::directReplTinyPivotString() << " option can be either 0 (false) or 1 (true)" );
   GEOSX_ERROR_IF( binaryOptions.count( m_parameters.direct.iterativeRefine ) == 0, viewKeyStruct::directIterRefString() << " option can be either 0 (false) or 1 (true)" );
   GEOSX_ERROR_IF( binaryOptions.count( m_parameters.direct.parallel ) == 0, viewKeyStruct::directParallelString() << " option can be either 0 (false) or 1 (true)" );
+  GEOSX_ERROR_IF( binaryOptions.count( m_parameters.native.singlePrecision ) == 0, viewKeyStruct::nativeSinglePrecisionString() << " option can be either 0 (false) or 1 (true)" );
 
   GEOSX_ERROR_IF_LT_MSG( m_parameters.krylov.maxIterations, 0, "Invalid value of " << viewKeyStruct::krylovMaxIterString() );
   GEOSX_ERROR_IF_LT_MSG( m_parameters.krylov.maxRestart, 0, "Invalid value of " << viewKeyStruct::krylovMaxRestartString() );
+  GEOSX_ERROR_IF_LT_MSG( m_parameters.krylov.recycleSize, 0, "Invalid value of " << viewKeyStruct::krylovRecycleSizeString() );
 
   GEOSX_ERROR_IF_LT_MSG( m_parameters.krylov.relTolerance, 0.0, "Invalid value of " << viewKeyStruct::krylovTolString() );
   GEOSX_ERROR_IF_GT_MSG( m_parameters.krylov.relTolerance, 1.0, "Invalid value of " << viewKeyStruct::krylovTolString() );
 
+  GEOSX_ERROR_IF_LT_MSG( m_parameters.reuse.maxSolves, 1, "Invalid value of " << viewKeyStruct::precondReuseMaxSolvesString() );
+  GEOSX_ERROR_IF_LT_MSG( m_parameters.reuse.iterGrowthFactor, 1.0, "Invalid value of " << viewKeyStruct::precondReuseIterGrowthString() );
+
   GEOSX_ERROR_IF_LT_MSG( m_parameters.ifact.fill, 0, "Invalid value of " << viewKeyStruct::iluFillString() );
   GEOSX_ERROR_IF_LT_MSG( m_parameters.ifact.threshold, 0.0, "Invalid value of " << viewKeyStruct::iluThresholdString() );
 
+  GEOSX_ERROR_IF_LT_MSG( m_parameters.native.blockSize, 1, "Invalid value of " << viewKeyStruct::nativeBlockSizeString() );
+  GEOSX_ERROR_IF_LT_MSG( m_parameters.native.numSweeps, 1, "Invalid value of " << viewKeyStruct::nativeNumSweepsString() );
+  GEOSX_ERROR_IF( isNativePreconditioner( m_parameters.preconditionerType )
+                  && m_parameters.solverType == LinearSolverParameters::SolverType::preconditioner,
+                  "Native preconditioners can only be used within a Krylov solver" );
+
   GEOSX_ERROR_IF_LT_MSG( m_parameters.amg.numSweeps, 0, "Invalid value of " << viewKeyStruct::amgNumSweepsString() );
   GEOSX_ERROR_IF_LT_MSG( m_parameters.amg.threshold, 0.0, "Invalid value of " << viewKeyStruct::amgThresholdString() );
   GEOSX_ERROR_IF_GT_MSG( m_parameters.amg.threshold, 1.0, "Invalid value of " << viewKeyStruct::amgThresholdString() );
@@ -100,6 +100,17 @@ public:
     static constexpr char const * krylovAdaptiveTolString() { return "krylovAdaptiveTol"; }
     /// Krylov weakest tolerance key
     static constexpr char const * krylovWeakTolString() { return "krylovWeakestTol"; }
+    /// Krylov orthogonalization scheme key
+    static constexpr char const * krylovOrthogonalizationString() { return "krylovOrthogonalization"; }
+    /// Krylov recycle space size key
+    static constexpr char const * krylovRecycleSizeString() { return "krylovRecycleSize"; }
+
+    /// Preconditioner reuse policy key
+    static constexpr char const * precondReusePolicyString() { return "precondReusePolicy"; }
+    /// Preconditioner reuse max solves key
+    static constexpr char const * precondReuseMaxSolvesString() { return "precondReuseMaxSolves"; }
+    /// Preconditioner reuse iteration growth factor key
+    static constexpr char const * precondReuseIterGrowthString() { return "precondReuseIterGrowth"; }
 
     /// AMG number of sweeps key
     static constexpr char const * amgNumSweepsString() { return "amgNumSweeps"; }
@@ -120,6 +131,13 @@ public:
     static constexpr char const * iluFillString() { return "iluFill"; }
     /// ILU threshold key
     static constexpr char const * iluThresholdString() { return "iluThreshold"; }
+
+    /// Native preconditioner block size key
+    static constexpr char const * nativeBlockSizeString() { return "nativeBlockSize"; }
+    /// Native preconditioner number of sweeps key
+    static constexpr char const * nativeNumSweepsString() { return "nativeNumSweeps"; }
+    /// Native preconditioner single precision key
+    static constexpr char const * nativeSinglePrecisionString() { return "nativeSinglePrecision"; }
   };
 
 private:
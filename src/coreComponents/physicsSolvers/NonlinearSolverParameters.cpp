@@ -14,6 +14,8 @@
 
 #include "NonlinearSolverParameters.hpp"
 
+#include <limits>
+
 namespace geosx
 {
 
@@ -99,6 +101,120 @@ NonlinearSolverParameters::NonlinearSolverParameters( string const & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "Maximum number of time sub-steps allowed for the solver" );
 
+  registerWrapper( viewKeysStruct::jacobianFreeString, &m_jacobianFree ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Flag to use a Jacobian-free Newton-Krylov method: the Krylov solver applies the Jacobian "
+                    "through finite differences of the residual, and the assembled matrix is only used to build "
+                    "the preconditioner. Requires an iterative linear solver. The matrix is still assembled "
+                    "whenever the Jacobian is updated, so that this option saves neither memory nor assembly "
+                    "time unless combined with ``" + string( viewKeysStruct::jacobianUpdateIntervalString ) + "`` > 1." );
+
+  registerWrapper( viewKeysStruct::jacobianFreePerturbationString, &m_jacobianFreePerturbation ).
+    setApplyDefaultValue( std::sqrt( std::numeric_limits< real64 >::epsilon() ) ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Relative size of the perturbation used in finite-difference Jacobian-vector products: "
+                    "the product with v uses the step jacobianFreePerturbation * (1 + ||u||) / ||v||, "
+                    "where u is the vector of primary variables." );
+
+  registerWrapper( viewKeysStruct::jacobianUpdateIntervalString, &m_jacobianUpdateInterval ).
+    setApplyDefaultValue( 1 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Maximum number of Newton iterations between Jacobian updates. In between, the Jacobian "
+                    "(and its preconditioner or factorization) from a previous iteration is reused. "
+                    "A value of 1 recomputes the Jacobian at every iteration." );
+
+  registerWrapper( viewKeysStruct::jacobianContractionLimitString, &m_jacobianContractionLimit ).
+    setApplyDefaultValue( 0.5 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Maximum ratio of consecutive residual norms allowed while reusing a lagged Jacobian. "
+                    "A fresh Jacobian is computed whenever the residual is reduced by less than this factor." );
+
+  registerWrapper( viewKeysStruct::broydenUpdateString, &m_broydenUpdate ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Flag to apply Broyden rank-one corrections to a lagged Jacobian." );
+
+  registerWrapper( viewKeysStruct::couplingAccelerationString, &m_couplingAcceleration ).
+    setApplyDefaultValue( CouplingAcceleration::None ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Acceleration of the fixed-point iterations of a sequentially coupled solver. Options are: \n "
+                    "* None     - Plain fixed-point update.\n"
+                    "* Aitken   - Dynamic Aitken relaxation of the coupling variables.\n"
+                    "* Anderson - Windowed Anderson mixing of the coupling variables." );
+
+  registerWrapper( viewKeysStruct::couplingAccelerationWindowString, &m_couplingAccelerationWindow ).
+    setApplyDefaultValue( 5 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Number of previous iterates used in Anderson mixing." );
+
+  registerWrapper( viewKeysStruct::couplingRelaxationString, &m_couplingRelaxation ).
+    setApplyDefaultValue( 1.0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Initial relaxation factor for Aitken acceleration, or mixing parameter for Anderson acceleration." );
+
+  registerWrapper( viewKeysStruct::nonlinearPreconditionerString, &m_nonlinearPreconditioner ).
+    setApplyDefaultValue( NonlinearPreconditioner::None ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Nonlinear preconditioner applied before each global Newton iteration. Options are: \n "
+                    "* None - No nonlinear preconditioning.\n"
+                    "* NonlinearBlockJacobi - Nonlinear block Jacobi: local Newton iterations on the cells owned by each rank, "
+                    "without the couplings to ghost cells. The ghost values are synchronized after each local iteration, "
+                    "and all ranks iterate until the last one has converged. The global Newton correction follows." );
+
+  registerWrapper( viewKeysStruct::subdomainMaxIterString, &m_subdomainMaxIter ).
+    setApplyDefaultValue( 3 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Maximum number of local Newton iterations in each subdomain solve of the nonlinear preconditioner." );
+
+  registerWrapper( viewKeysStruct::subdomainTolString, &m_subdomainTol ).
+    setApplyDefaultValue( 0.1 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Relative reduction of the local residual norm at which a subdomain solve of the nonlinear preconditioner is converged." );
+
+  registerWrapper( viewKeysStruct::timeStepControlString, &m_timeStepControl ).
+    setApplyDefaultValue( TimeStepControl::NewtonIterations ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Criterion used to select the size of the next time step. Options are: \n "
+                    "* NewtonIterations - Double or halve the time step based on the number of Newton iterations.\n"
+                    "* StateChange      - Scale the time step to meet the solver targets on the state change over a step.\n"
+                    "* PID              - PID control of the state change over a step.\n"
+                    "With StateChange and PID, the time step is also limited by the Newton iteration count "
+                    "and, if available, by the stability (CFL) estimate of the solver." );
+
+  registerWrapper( viewKeysStruct::timeStepTargetWeightString, &m_timeStepTargetWeight ).
+    setApplyDefaultValue( 0.5 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Weight w of the target in the StateChange time step control: the time step is scaled by (1 + w) / (r + w), "
+                    "where r is the ratio of the state change to its target. Larger values damp the response to small state changes." );
+
+  // Default gains of Valli et al., "Control strategies for timestep selection in finite element simulation
+  // of incompressible flows and coupled reaction-convection-diffusion processes" (2005)
+  registerWrapper( viewKeysStruct::timeStepProportionalGainString, &m_timeStepProportionalGain ).
+    setApplyDefaultValue( 0.075 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Proportional gain of the PID time step control." );
+
+  registerWrapper( viewKeysStruct::timeStepIntegralGainString, &m_timeStepIntegralGain ).
+    setApplyDefaultValue( 0.175 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Integral gain of the PID time step control." );
+
+  registerWrapper( viewKeysStruct::timeStepDerivativeGainString, &m_timeStepDerivativeGain ).
+    setApplyDefaultValue( 0.01 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Derivative gain of the PID time step control." );
+
+  registerWrapper( viewKeysStruct::timeStepMinChangeFactorString, &m_timeStepMinChangeFactor ).
+    setApplyDefaultValue( 0.1 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Smallest factor applied to the time step by the StateChange and PID time step controls." );
+
+  registerWrapper( viewKeysStruct::timeStepMaxChangeFactorString, &m_timeStepMaxChangeFactor ).
+    setApplyDefaultValue( 2.0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Largest factor applied to the time step by the StateChange and PID time step controls." );
+
 
 
 }
@@ -109,6 +225,26 @@ void NonlinearSolverParameters::postProcessInput()
   {
     GEOSX_ERROR( " dtIncIterLimit should be smaller than dtCutIterLimit!!" );
   }
+  GEOSX_ERROR_IF_LE_MSG( m_jacobianFreePerturbation, 0.0, viewKeysStruct::jacobianFreePerturbationString << " must be positive" );
+  GEOSX_ERROR_IF_LT_MSG( m_jacobianUpdateInterval, 1, viewKeysStruct::jacobianUpdateIntervalString << " must be at least 1" );
+  GEOSX_ERROR_IF_LE_MSG( m_jacobianContractionLimit, 0.0, viewKeysStruct::jacobianContractionLimitString << " must be positive" );
+  GEOSX_ERROR_IF( m_broydenUpdate && m_jacobianFree,
+                  viewKeysStruct::broydenUpdateString << " cannot be used with " << viewKeysStruct::jacobianFreeString );
+  GEOSX_ERROR_IF_LT_MSG( m_couplingAccelerationWindow, 1, viewKeysStruct::couplingAccelerationWindowString << " must be at least 1" );
+  GEOSX_ERROR_IF_LE_MSG( m_couplingRelaxation, 0.0, viewKeysStruct::couplingRelaxationString << " must be positive" );
+  GEOSX_ERROR_IF_LT_MSG( m_subdomainMaxIter, 1, viewKeysStruct::subdomainMaxIterString << " must be at least 1" );
+  GEOSX_ERROR_IF( m_subdomainTol <= 0.0 || m_subdomainTol >= 1.0,
+                  viewKeysStruct::subdomainTolString << " must be in (0,1)" );
+  GEOSX_ERROR_IF( m_nonlinearPreconditioner != NonlinearPreconditioner::None && m_jacobianFree,
+                  viewKeysStruct::nonlinearPreconditionerString << " cannot be used with " << viewKeysStruct::jacobianFreeString );
+  GEOSX_ERROR_IF( m_nonlinearPreconditioner != NonlinearPreconditioner::None && m_broydenUpdate,
+                  viewKeysStruct::nonlinearPreconditionerString << " cannot be used with " << viewKeysStruct::broydenUpdateString );
+  GEOSX_ERROR_IF_LT_MSG( m_timeStepTargetWeight, 0.0, viewKeysStruct::timeStepTargetWeightString << " must be non-negative" );
+  GEOSX_ERROR_IF( m_timeStepProportionalGain < 0.0 || m_timeStepIntegralGain < 0.0 || m_timeStepDerivativeGain < 0.0,
+                  "The gains of the PID time step control must be non-negative" );
+  GEOSX_ERROR_IF( m_timeStepMinChangeFactor <= 0.0 || m_timeStepMinChangeFactor > 1.0,
+                  viewKeysStruct::timeStepMinChangeFactorString << " must be in (0,1]" );
+  GEOSX_ERROR_IF_LT_MSG( m_timeStepMaxChangeFactor, 1.0, viewKeysStruct::timeStepMaxChangeFactorString << " must be at least 1" );
 }
 
 
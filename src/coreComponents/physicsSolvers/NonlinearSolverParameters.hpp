@@ -83,6 +83,29 @@ public:
     static constexpr auto minNumNewtonIterationsString  = "minNumberOfNewtonIterations";
     static constexpr auto timeStepCutFactorString       = "timestepCutFactor";
 
+    static constexpr auto jacobianFreeString            = "jacobianFree";
+    static constexpr auto jacobianFreePerturbationString = "jacobianFreePerturbation";
+
+    static constexpr auto jacobianUpdateIntervalString  = "jacobianUpdateInterval";
+    static constexpr auto jacobianContractionLimitString = "jacobianContractionLimit";
+    static constexpr auto broydenUpdateString           = "broydenUpdate";
+
+    static constexpr auto couplingAccelerationString    = "couplingAcceleration";
+    static constexpr auto couplingAccelerationWindowString = "couplingAccelerationWindow";
+    static constexpr auto couplingRelaxationString      = "couplingRelaxation";
+
+    static constexpr auto nonlinearPreconditionerString = "nonlinearPreconditioner";
+    static constexpr auto subdomainMaxIterString        = "subdomainMaxIter";
+    static constexpr auto subdomainTolString            = "subdomainTol";
+
+    static constexpr auto timeStepControlString         = "timeStepControl";
+    static constexpr auto timeStepTargetWeightString    = "timeStepTargetWeight";
+    static constexpr auto timeStepProportionalGainString = "timeStepProportionalGain";
+    static constexpr auto timeStepIntegralGainString    = "timeStepIntegralGain";
+    static constexpr auto timeStepDerivativeGainString  = "timeStepDerivativeGain";
+    static constexpr auto timeStepMinChangeFactorString = "timeStepMinChangeFactor";
+    static constexpr auto timeStepMaxChangeFactorString = "timeStepMaxChangeFactor";
+
   } viewKeys;
 
 
@@ -117,6 +140,35 @@ public:
     Require, ///< Use line search. If smaller residual than starting residual is not achieved, cut time step.
   };
 
+  /**
+   * @brief Acceleration applied to the coupling variables of a sequential (fixed-point) coupling loop.
+   */
+  enum class CouplingAcceleration : integer
+  {
+    None,     ///< Plain fixed-point update
+    Aitken,   ///< Dynamic Aitken relaxation
+    Anderson, ///< Windowed Anderson mixing
+  };
+
+  /**
+   * @brief Nonlinear preconditioner applied before each global Newton iteration.
+   */
+  enum class NonlinearPreconditioner : integer
+  {
+    None, ///< No nonlinear preconditioning
+    NonlinearBlockJacobi, ///< Nonlinear block Jacobi with one block per rank
+  };
+
+  /**
+   * @brief Criterion used to select the size of the next time step.
+   */
+  enum class TimeStepControl : integer
+  {
+    NewtonIterations, ///< Grow or shrink the time step based on the number of Newton iterations
+    StateChange,      ///< Scale the time step to meet the solver's targets on the state change over a step
+    PID,              ///< PID control of the state change over a step
+  };
+
   /// Flag to apply a line search.
   LineSearchAction m_lineSearchAction;
 
@@ -159,6 +211,60 @@ public:
   /// number of times that the time-step had to be cut
   integer m_numdtAttempts;
 
+  /// Flag to apply the Jacobian through finite differences of the residual in the linear solver
+  integer m_jacobianFree;
+
+  /// Relative size of the finite-difference perturbation used in Jacobian-free products
+  real64 m_jacobianFreePerturbation;
+
+  /// Maximum number of Newton iterations between Jacobian updates (1 means a new Jacobian at every iteration)
+  integer m_jacobianUpdateInterval;
+
+  /// Residual reduction factor above which a lagged Jacobian is recomputed
+  real64 m_jacobianContractionLimit;
+
+  /// Flag to apply Broyden low-rank corrections to a lagged Jacobian
+  integer m_broydenUpdate;
+
+  /// Acceleration of the fixed-point iterations in sequentially coupled solvers
+  CouplingAcceleration m_couplingAcceleration;
+
+  /// Number of previous iterates used in Anderson mixing
+  integer m_couplingAccelerationWindow;
+
+  /// Initial Aitken relaxation factor, or mixing parameter for Anderson acceleration
+  real64 m_couplingRelaxation;
+
+  /// Nonlinear preconditioner applied before each global Newton iteration
+  NonlinearPreconditioner m_nonlinearPreconditioner;
+
+  /// Maximum number of local Newton iterations in each subdomain solve
+  integer m_subdomainMaxIter;
+
+  /// Relative reduction of the local residual at which a subdomain solve is converged
+  real64 m_subdomainTol;
+
+  /// Criterion used to select the size of the next time step
+  TimeStepControl m_timeStepControl;
+
+  /// Weight of the target in the proportional rule of the state change control
+  real64 m_timeStepTargetWeight;
+
+  /// Proportional gain of the PID control
+  real64 m_timeStepProportionalGain;
+
+  /// Integral gain of the PID control
+  real64 m_timeStepIntegralGain;
+
+  /// Derivative gain of the PID control
+  real64 m_timeStepDerivativeGain;
+
+  /// Smallest factor applied to the time step by the state change and PID controls
+  real64 m_timeStepMinChangeFactor;
+
+  /// Largest factor applied to the time step by the state change and PID controls
+  real64 m_timeStepMaxChangeFactor;
+
 };
 
 ENUM_STRINGS( NonlinearSolverParameters::LineSearchAction,
@@ -166,6 +272,20 @@ ENUM_STRINGS( NonlinearSolverParameters::LineSearchAction,
               "Attempt",
               "Require" );
 
+ENUM_STRINGS( NonlinearSolverParameters::CouplingAcceleration,
+              "None",
+              "Aitken",
+              "Anderson" );
+
+ENUM_STRINGS( NonlinearSolverParameters::NonlinearPreconditioner,
+              "None",
+              "NonlinearBlockJacobi" );
+
+ENUM_STRINGS( NonlinearSolverParameters::TimeStepControl,
+              "NewtonIterations",
+              "StateChange",
+              "PID" );
+
 } /* namespace geosx */
 
 #endif /* GEOSX_PHYSICSSOLVERS_NONLINEARSOLVERPARAMETERS_HPP_ */
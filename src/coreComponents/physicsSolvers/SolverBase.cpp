@@ -16,7 +16,10 @@
 #include "PhysicsSolverManager.hpp"
 
 #include "common/TimingMacros.hpp"
+#include "common/TypeDispatch.hpp"
 #include "linearAlgebra/utilities/LinearSolverParameters.hpp"
+#include "linearAlgebra/solvers/BlockCRSPreconditioner.hpp"
+#include "linearAlgebra/solvers/GmresSolver.hpp"
 #include "linearAlgebra/solvers/KrylovSolver.hpp"
 #include "mesh/DomainPartition.hpp"
 
@@ -51,7 +54,7 @@ SolverBase::SolverBase( string const & name,
                     " when calculating the maximum allowable time step. Values should be in the interval (0,1] " );
 
   registerWrapper( viewKeyStruct::maxStableDtString(), &m_maxStableDt ).
-    setApplyDefaultValue( 0.5 ).
+    setApplyDefaultValue( 1e99 ).
     setInputFlag( InputFlags::FALSE ).
     setDescription( "Value of the Maximum Stable Timestep for this solver." );
 
@@ -225,7 +228,71 @@ bool SolverBase::execute( real64 const time_n,
 void SolverBase::setNextDt( real64 const & currentDt,
                             real64 & nextDt )
 {
+  GEOSX_MARK_FUNCTION;
+
   setNextDtBasedOnNewtonIter( currentDt, nextDt );
+  if( m_nonlinearSolverParameters.m_timeStepControl == NonlinearSolverParameters::TimeStepControl::NewtonIterations )
+  {
+    return;
+  }
+  char const * limiter = "Newton iterations";
+
+  // the Newton iteration count remains a safeguard when the step is driven by the state change
+  if( m_stateChangeRatios[0] >= 0.0 )
+  {
+    real64 const stateChangeDt = setNextDtBasedOnStateChange( currentDt );
+    if( stateChangeDt < nextDt )
+    {
+      nextDt = stateChangeDt;
+      limiter = "state change";
+    }
+  }
+
+  if( m_maxStableDt < nextDt )
+  {
+    nextDt = m_maxStableDt;
+    limiter = "stability (CFL)";
+  }
+
+  GEOSX_LOG_LEVEL_RANK_0( 1, GEOSX_FMT( "{}: next time step = {}, limited by {}", getName(), nextDt, limiter ) );
+}
+
+real64 SolverBase::setNextDtBasedOnStateChange( real64 const & currentDt ) const
+{
+  NonlinearSolverParameters const & params = m_nonlinearSolverParameters;
+  real64 const targetWeight = params.m_timeStepTargetWeight;
+  real64 const kP = params.m_timeStepProportionalGain;
+  real64 const kI = params.m_timeStepIntegralGain;
+  real64 const kD = params.m_timeStepDerivativeGain;
+
+  // guards the ratios of state changes against a step that did not change the state
+  real64 constexpr minRatio = 1e-3;
+
+  real64 const ratio = LvArray::math::max( m_stateChangeRatios[0], minRatio );
+  real64 factor = ( 1.0 + targetWeight ) / ( ratio + targetWeight );
+
+  if( params.m_timeStepControl == NonlinearSolverParameters::TimeStepControl::PID
+      && m_stateChangeRatios[1] >= 0.0 )
+  {
+    real64 const prevRatio = LvArray::math::max( m_stateChangeRatios[1], minRatio );
+    factor = std::pow( prevRatio / ratio, kP ) * std::pow( 1.0 / ratio, kI );
+    if( m_stateChangeRatios[2] >= 0.0 )
+    {
+      real64 const prevPrevRatio = LvArray::math::max( m_stateChangeRatios[2], minRatio );
+      factor *= std::pow( prevRatio * prevRatio / ( ratio * prevPrevRatio ), kD );
+    }
+  }
+
+  return currentDt * LvArray::math::min( LvArray::math::max( factor, params.m_timeStepMinChangeFactor ), params.m_timeStepMaxChangeFactor );
+}
+
+void SolverBase::recordStateChange( real64 const ratio )
+{
+  m_stateChangeRatios[2] = m_stateChangeRatios[1];
+  m_stateChangeRatios[1] = m_stateChangeRatios[0];
+  m_stateChangeRatios[0] = ratio;
+
+  GEOSX_LOG_LEVEL_RANK_0( 2, GEOSX_FMT( "{}: state change over the step = {:4.2e} x target", getName(), ratio ) );
 }
 
 void SolverBase::setNextDtBasedOnNewtonIter( real64 const & currentDt,
@@ -298,14 +365,8 @@ real64 SolverBase::linearImplicitStep( real64 const & time_n,
     m_assemblyCallback( m_localMatrix, std::move( localRhsCopy ) );
   }
 
-  // TODO: Trilinos currently requires this, re-evaluate after moving to Tpetra-based solvers
-  if( m_precond )
-  {
-    m_precond->clear();
-  }
-
   // Compose parallel LA matrix out of local matrix
-  m_matrix.create( m_localMatrix.toViewConst(), m_dofManager.numLocalDofs(), MPI_COMM_GEOSX );
+  composeParallelMatrix();
 
   // Output the linear system matrix/rhs for debugging purposes
   debugOutputSystem( 0.0, 0, 0, m_matrix, m_rhs );
@@ -325,6 +386,8 @@ real64 SolverBase::linearImplicitStep( real64 const & time_n,
   // final step for completion of timestep. typically secondary variable updates and cleanup.
   implicitStepComplete( time_n, dt, domain );
 
+  releaseDirectSolverFactorization();
+
   // return the achieved timestep
   return dt;
 }
@@ -374,13 +437,12 @@ bool SolverBase::lineSearch( real64 const & time_n,
     // update non-primary variables (constitutive models)
     updateState( domain );
 
-    // re-assemble system
-    localMatrix.zero();
+    // re-assemble the residual, the Jacobian is only needed once the line search is over
     rhs.zero();
 
     {
       arrayView1d< real64 > const localRhs = rhs.open();
-      assembleSystem( time_n, dt, domain, dofManager, localMatrix, localRhs );
+      m_localJacobianCurrent = assembleResidual( time_n, dt, domain, dofManager, localMatrix, localRhs );
       applyBoundaryConditions( time_n, dt, domain, dofManager, localMatrix, localRhs );
       rhs.close();
     }
@@ -458,6 +520,36 @@ real64 SolverBase::eisenstatWalker( real64 const newNewtonNorm,
   return krylovTol;
 }
 
+void SolverBase::composeParallelMatrix()
+{
+  GEOSX_MARK_FUNCTION;
+
+  // The decision must be collective, since matrix creation involves global communication
+  int const localPatternChanged = !m_matrix.ready()
+                                  || m_matrix.numLocalRows() != m_localMatrix.numRows()
+                                  || m_matrix.numLocalNonzeros() != m_localMatrix.numNonZeros()
+                                  || m_matrixSparsityPatternVersion != m_sparsityPatternVersion;
+  bool const patternChanged = MpiWrapper::max( localPatternChanged, MPI_COMM_GEOSX ) > 0;
+
+  // A preconditioner computed for a re-created matrix cannot be reused; otherwise keep it only if requested.
+  // TODO: Trilinos currently requires this, re-evaluate after moving to Tpetra-based solvers
+  if( m_precond && ( patternChanged || m_linearSolverParameters.get().reuse.policy == LinearSolverParameters::Reuse::Policy::none ) )
+  {
+    m_precond->clear();
+  }
+
+  if( patternChanged )
+  {
+    m_matrix.create( m_localMatrix.toViewConst(), m_dofManager.numLocalDofs(), MPI_COMM_GEOSX );
+    m_matrixSparsityPatternVersion = m_sparsityPatternVersion;
+    m_krylovRecycleSpace.clear();
+  }
+  else
+  {
+    m_matrix.updateValues( m_localMatrix.toViewConst() );
+  }
+}
+
 real64 SolverBase::nonlinearImplicitStep( real64 const & time_n,
                                           real64 const & dt,
                                           integer const cycleNumber,
@@ -502,30 +594,21 @@ real64 SolverBase::nonlinearImplicitStep( real64 const & time_n,
     {
       GEOSX_LOG_LEVEL_RANK_0( 1, GEOSX_FMT( "    Attempt: {:2}, NewtonIter: {:2}", dtAttempt, newtonIter ) );
 
-      // zero out matrix/rhs before assembly
-      m_localMatrix.zero();
-      m_rhs.zero();
+      // local nonlinear solves on each rank before the global Newton correction
+      bool assembled = false;
+      if( m_nonlinearSolverParameters.m_nonlinearPreconditioner != NonlinearSolverParameters::NonlinearPreconditioner::None )
+      {
+        assembled = applyNonlinearPreconditioner( time_n, stepDt, domain );
+      }
+
+      // with a lagged Jacobian, the residual is enough to decide whether the Jacobian is recomputed
+      bool const residualOnly = m_nonlinearSolverParameters.m_jacobianUpdateInterval > 1
+                                && newtonIter > 0
+                                && !m_assemblyCallback;
 
+      if( !assembled )
       {
-        arrayView1d< real64 > const localRhs = m_rhs.open();
-
-        // call assemble to fill the matrix and the rhs
-        assembleSystem( time_n,
-                        stepDt,
-                        domain,
-                        m_dofManager,
-                        m_localMatrix.toViewConstSizes(),
-                        localRhs );
-
-        // apply boundary conditions to system
-        applyBoundaryConditions( time_n,
-                                 stepDt,
-                                 domain,
-                                 m_dofManager,
-                                 m_localMatrix.toViewConstSizes(),
-                                 localRhs );
-
-        m_rhs.close();
+        assembleNewtonSystem( time_n, stepDt, domain, residualOnly );
       }
 
       if( m_assemblyCallback )
@@ -560,9 +643,11 @@ real64 SolverBase::nonlinearImplicitStep( real64 const & time_n,
       }
 
       // do line search in case residual has increased
+      bool lineSearchApplied = false;
       if( m_nonlinearSolverParameters.m_lineSearchAction != NonlinearSolverParameters::LineSearchAction::None
           && residualNorm > lastResidual )
       {
+        lineSearchApplied = true;
         residualNorm = lastResidual;
         bool lineSearchSuccess = lineSearch( time_n,
                                              stepDt,
@@ -597,20 +682,42 @@ real64 SolverBase::nonlinearImplicitStep( real64 const & time_n,
         krylovParams.relTolerance = eisenstatWalker( residualNorm, lastResidual, krylovParams.weakestTol );
       }
 
-      // TODO: Trilinos currently requires this, re-evaluate after moving to Tpetra-based solvers
-      if( m_precond )
+      // Compose parallel LA matrix/rhs out of local LA matrix/rhs, unless the previous Jacobian is reused
+      if( jacobianUpdateRequired( newtonIter, residualNorm, lastResidual, lineSearchApplied ) )
+      {
+        // the last assembly (lagged iteration or line search) may have skipped the Jacobian
+        if( !m_localJacobianCurrent )
+        {
+          assembleNewtonSystem( time_n, stepDt, domain, false );
+        }
+        composeParallelMatrix();
+        m_jacobianAge = 0;
+        m_broydenCorrections.clear();
+        m_broydenSteps.clear();
+      }
+      else
       {
-        m_precond->clear();
+        ++m_jacobianAge;
+        GEOSX_LOG_LEVEL_RANK_0( 2, GEOSX_FMT( "    Reusing Jacobian from {} iteration(s) ago", m_jacobianAge ) );
       }
 
-      // Compose parallel LA matrix/rhs out of local LA matrix/rhs
-      m_matrix.create( m_localMatrix.toViewConst(), m_dofManager.numLocalDofs(), MPI_COMM_GEOSX );
-
       // Output the linear system matrix/rhs for debugging purposes
       debugOutputSystem( time_n, cycleNumber, newtonIter, m_matrix, m_rhs );
 
+      // Keep the linearization point if the Jacobian is to be applied matrix-free
+      if( m_nonlinearSolverParameters.m_jacobianFree )
+      {
+        setupJacobianFree( time_n, stepDt, domain, m_rhs );
+      }
+
       // Solve the linear system
       solveSystem( m_dofManager, m_matrix, m_rhs, m_solution );
+      clearJacobianFree();
+
+      if( m_nonlinearSolverParameters.m_broydenUpdate && m_jacobianAge > 0 )
+      {
+        applyBroydenUpdate( m_solution );
+      }
 
       // Output the linear system solution for debugging purposes
       debugOutputSolution( time_n, cycleNumber, newtonIter, m_solution );
@@ -624,6 +731,12 @@ real64 SolverBase::nonlinearImplicitStep( real64 const & time_n,
         break;
       }
 
+      if( m_nonlinearSolverParameters.m_broydenUpdate )
+      {
+        m_broydenDirection = m_solution;
+        m_broydenScale = scaleFactor;
+      }
+
       // apply the system solution to the fields/variables
       applySystemSolution( m_dofManager, m_solution.values(), scaleFactor, domain );
 
@@ -645,6 +758,10 @@ real64 SolverBase::nonlinearImplicitStep( real64 const & time_n,
     }
   }
 
+  // The lagged Jacobian is only reused within a Newton loop
+  m_jacobianAge = 0;
+  releaseDirectSolverFactorization();
+
   if( !isConverged )
   {
     GEOSX_LOG_RANK_0( "Convergence not achieved." );
@@ -679,6 +796,42 @@ void SolverBase::implicitStepSetup( real64 const & GEOSX_UNUSED_PARAM( time_n ),
   GEOSX_ERROR( "SolverBase::ImplicitStepSetup called!. Should be overridden." );
 }
 
+void SolverBase::assimilateSparsityPattern( CRSMatrix< real64, globalIndex > & localMatrix,
+                                            SparsityPattern< globalIndex > && pattern )
+{
+  GEOSX_MARK_FUNCTION;
+
+  bool samePattern = localMatrix.numRows() == pattern.numRows()
+                     && localMatrix.numColumns() == pattern.numColumns()
+                     && localMatrix.numNonZeros() == pattern.numNonZeros();
+  if( samePattern )
+  {
+    localMatrix.move( LvArray::MemorySpace::host, false );
+    pattern.move( LvArray::MemorySpace::host, false );
+    CRSMatrixView< real64 const, globalIndex const > const matrixView = localMatrix.toViewConst();
+    SparsityPatternView< globalIndex const > const patternView = pattern.toViewConst();
+
+    RAJA::ReduceMin< parallelHostReduce, int > same( 1 );
+    forAll< parallelHostPolicy >( matrixView.numRows(), [=]( localIndex const row )
+    {
+      arraySlice1d< globalIndex const > const matrixCols = matrixView.getColumns( row );
+      arraySlice1d< globalIndex const > const patternCols = patternView.getColumns( row );
+      if( matrixCols.size() != patternCols.size()
+          || !std::equal( matrixCols.begin(), matrixCols.end(), patternCols.begin() ) )
+      {
+        same.min( 0 );
+      }
+    } );
+    samePattern = same.get() == 1;
+  }
+
+  localMatrix.assimilate< parallelDevicePolicy<> >( std::move( pattern ) );
+  if( !samePattern )
+  {
+    ++m_sparsityPatternVersion;
+  }
+}
+
 void SolverBase::setupDofs( DomainPartition const & GEOSX_UNUSED_PARAM( domain ),
                             DofManager & GEOSX_UNUSED_PARAM( dofManager ) ) const
 {
@@ -703,7 +856,7 @@ void SolverBase::setupSystem( DomainPartition & domain,
   {
     SparsityPattern< globalIndex > pattern;
     dofManager.setSparsityPattern( pattern );
-    localMatrix.assimilate< parallelDevicePolicy<> >( std::move( pattern ) );
+    assimilateSparsityPattern( localMatrix, std::move( pattern ) );
   }
   localMatrix.setName( this->getName() + "/matrix" );
 
@@ -724,6 +877,18 @@ void SolverBase::assembleSystem( real64 const GEOSX_UNUSED_PARAM( time ),
   GEOSX_ERROR( "SolverBase::Assemble called!. Should be overridden." );
 }
 
+bool SolverBase::assembleResidual( real64 const time,
+                                   real64 const dt,
+                                   DomainPartition & domain,
+                                   DofManager const & dofManager,
+                                   CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                                   arrayView1d< real64 > const & localRhs )
+{
+  localMatrix.zero();
+  assembleSystem( time, dt, domain, dofManager, localMatrix, localRhs );
+  return true;
+}
+
 void SolverBase::applyBoundaryConditions( real64 const GEOSX_UNUSED_PARAM( time ),
                                           real64 const GEOSX_UNUSED_PARAM( dt ),
                                           DomainPartition & GEOSX_UNUSED_PARAM( domain ),
@@ -831,10 +996,54 @@ void SolverBase::solveSystem( DofManager const & dofManager,
 {
   GEOSX_MARK_FUNCTION;
 
+  if( m_subdomainSolve )
+  {
+    solveSubdomainSystem( rhs, solution );
+    return;
+  }
+
   LinearSolverParameters const & params = m_linearSolverParameters.get();
   matrix.setDofManager( &dofManager );
 
-  if( params.solverType == LinearSolverParameters::SolverType::direct || !m_precond )
+  bool const iterative = params.solverType != LinearSolverParameters::SolverType::direct
+                         && params.solverType != LinearSolverParameters::SolverType::preconditioner;
+  bool const reusePrecond = iterative && params.reuse.policy != LinearSolverParameters::Reuse::Policy::none;
+  bool const jacobianFree = m_jacobianFreeDomain != nullptr;
+  bool const recycle = params.solverType == LinearSolverParameters::SolverType::gmres && params.krylov.recycleSize > 0;
+  bool const nativePrecond = iterative && isNativePreconditioner( params.preconditionerType );
+  bool const lagJacobian = iterative && m_nonlinearSolverParameters.m_jacobianUpdateInterval > 1;
+  bool const jacobianLagged = m_jacobianAge > 0;
+
+  GEOSX_ERROR_IF( jacobianFree && !iterative,
+                  getName() << ": " << NonlinearSolverParameters::viewKeysStruct::jacobianFreeString << " requires an iterative linear solver" );
+
+  if( ( reusePrecond || jacobianFree || recycle || nativePrecond || lagJacobian ) && !m_precond )
+  {
+    // Preconditioner reuse, Jacobian-free products, subspace recycling, native preconditioners and
+    // Jacobian lagging require a persistent preconditioner driven by a native Krylov solver
+    m_precond = LAInterface::createPreconditioner( params );
+    GEOSX_LOG_LEVEL_RANK_0( 1, GEOSX_FMT( "{}: the {} iterations are performed by the GEOSX native Krylov solver "
+                                          "instead of the one of the linear algebra package",
+                                          getName(), EnumStrings< LinearSolverParameters::SolverType >::toString( params.solverType ) ) );
+  }
+
+  if( params.solverType == LinearSolverParameters::SolverType::direct )
+  {
+    // Direct solver is kept alive across solves, so that it can reuse symbolic factorization;
+    // its numeric factorization is released at the end of each step (see releaseDirectSolverFactorization)
+    if( !m_directSolver )
+    {
+      m_directSolver = LAInterface::createSolver( params );
+    }
+    // A lagged Jacobian reuses the existing factorization
+    if( !jacobianLagged || !m_directSolver->ready() )
+    {
+      m_directSolver->setup( matrix );
+    }
+    m_directSolver->solve( rhs, solution );
+    m_linearSolverResult = m_directSolver->result();
+  }
+  else if( !m_precond )
   {
     std::unique_ptr< LinearSolverBase< LAInterface > > solver = LAInterface::createSolver( params );
     solver->setup( matrix );
@@ -843,10 +1052,79 @@ void SolverBase::solveSystem( DofManager const & dofManager,
   }
   else
   {
-    m_precond->setup( matrix );
-    std::unique_ptr< KrylovSolver< ParallelVector > > solver = KrylovSolver< ParallelVector >::create( params, matrix, *m_precond );
+    bool const setupPrecond = jacobianLagged
+                              ? !m_precond->ready() || m_precondSetupMatrix != &matrix
+                              : !reusePrecond || preconditionerSetupRequired( matrix );
+    // The native block preconditioner holds a block-CRS copy of the matrix, which is also used
+    // for the matrix-vector products of the Krylov solver. If the matrix has just been composed from
+    // the local matrix, the copy is taken from the latter, and only its values are updated while the
+    // sparsity pattern is unchanged, instead of exporting the whole matrix from the LA package.
+    BlockCRSPreconditioner< LAInterface > * const blockPrecond =
+      dynamic_cast< BlockCRSPreconditioner< LAInterface > * >( m_precond.get() );
+    bool const useLocalMatrix = blockPrecond != nullptr && &matrix == &m_matrix && !jacobianLagged;
+
+    if( setupPrecond )
+    {
+      if( useLocalMatrix )
+      {
+        blockPrecond->setup( matrix, m_localMatrix.toViewConst(), m_precondSparsityPatternVersion != m_matrixSparsityPatternVersion );
+        m_precondSparsityPatternVersion = m_matrixSparsityPatternVersion;
+      }
+      else
+      {
+        m_precond->setup( matrix );
+        m_precondSparsityPatternVersion = -1;
+      }
+      m_precondSetupMatrix = &matrix;
+      m_precondNumSolves = 0;
+    }
+
+    // A reused preconditioner gets the new values
+    if( blockPrecond != nullptr && !setupPrecond && !jacobianLagged && !jacobianFree )
+    {
+      if( useLocalMatrix )
+      {
+        blockPrecond->updateOperator( m_localMatrix.toViewConst() );
+      }
+      else
+      {
+        blockPrecond->updateOperator( matrix );
+      }
+    }
+
+    // With Jacobian-free products, the assembled matrix is only used to build the preconditioner
+    std::unique_ptr< JacobianFreeOperator< ParallelVector > > jacobianOperator;
+    if( jacobianFree )
+    {
+      jacobianOperator = createJacobianFreeOperator( dofManager );
+    }
+    LinearOperator< ParallelVector > const & op =
+      jacobianFree ? static_cast< LinearOperator< ParallelVector > const & >( *jacobianOperator )
+      : blockPrecond != nullptr ? static_cast< LinearOperator< ParallelVector > const & >( blockPrecond->blockOperator() )
+      : matrix;
+
+    std::unique_ptr< KrylovSolver< ParallelVector > > solver = KrylovSolver< ParallelVector >::create( params, op, *m_precond );
+    if( recycle )
+    {
+      dynamic_cast< GmresSolver< ParallelVector > & >( *solver ).setRecycleSpace( &m_krylovRecycleSpace );
+    }
     solver->solve( rhs, solution );
     m_linearSolverResult = solver->result();
+
+    if( jacobianFree )
+    {
+      GEOSX_LOG_LEVEL_RANK_0( 2, GEOSX_FMT( "{}: {} residual evaluations in Jacobian-free products",
+                                            getName(), jacobianOperator->numEvaluations() ) );
+    }
+
+    if( setupPrecond )
+    {
+      m_precondSetupIterations = m_linearSolverResult.numIterations;
+    }
+    ++m_precondNumSolves;
+
+    GEOSX_LOG_LEVEL_RANK_0( 2, GEOSX_FMT( "{}: preconditioner {} ({} solves since last setup)",
+                                          getName(), setupPrecond ? "recomputed" : "reused", m_precondNumSolves ) );
   }
 
   if( params.stopIfError )
@@ -859,6 +1137,491 @@ void SolverBase::solveSystem( DofManager const & dofManager,
   }
 }
 
+void SolverBase::setupJacobianFree( real64 const time,
+                                    real64 const dt,
+                                    DomainPartition & domain,
+                                    ParallelVector const & residual )
+{
+  if( !m_jacobianFreeResidual.ready() || m_jacobianFreeResidual.localSize() != residual.localSize() )
+  {
+    m_jacobianFreeResidual.create( residual.localSize(), residual.comm() );
+  }
+  m_jacobianFreeResidual.copy( residual );
+  m_jacobianFreeDomain = &domain;
+  m_jacobianFreeTime = time;
+  m_jacobianFreeDt = dt;
+}
+
+void SolverBase::clearJacobianFree()
+{
+  m_jacobianFreeDomain = nullptr;
+}
+
+std::unique_ptr< JacobianFreeOperator< ParallelVector > >
+SolverBase::createJacobianFreeOperator( DofManager const & dofManager )
+{
+  GEOSX_ASSERT( m_jacobianFreeDomain != nullptr );
+
+  // Undoing a perturbation with applySystemSolution() is not exact when the update is clamped,
+  // so the linearization point is saved once and restored after each residual evaluation
+  saveSystemState( *m_jacobianFreeDomain );
+
+  auto residualFunction = [this, &dofManager]( ParallelVector const & dir,
+                                               real64 const step,
+                                               ParallelVector & residual )
+  {
+    DomainPartition & domain = *m_jacobianFreeDomain;
+
+    applySystemSolution( dofManager, dir.values(), step, domain );
+    updateState( domain );
+
+    // The local matrix has already been composed into the parallel one and is used as scratch space
+    residual.zero();
+    {
+      arrayView1d< real64 > const localResidual = residual.open();
+      m_localJacobianCurrent = assembleResidual( m_jacobianFreeTime, m_jacobianFreeDt, domain, dofManager,
+                                                 m_localMatrix.toViewConstSizes(), localResidual );
+      applyBoundaryConditions( m_jacobianFreeTime, m_jacobianFreeDt, domain, dofManager, m_localMatrix.toViewConstSizes(), localResidual );
+      residual.close();
+    }
+
+    // Restore the linearization point
+    restoreSystemState( domain );
+    updateState( domain );
+  };
+
+  // The Newton update satisfies R(u) + (dR/du)*dx = 0, with dx added to or subtracted from
+  // the primary variables depending on the sign convention of the solver
+  return std::make_unique< JacobianFreeOperator< ParallelVector > >( residualFunction,
+                                                                     m_jacobianFreeResidual,
+                                                                     m_nonlinearSolverParameters.m_jacobianFreePerturbation,
+                                                                     primaryVariableNorm( *m_jacobianFreeDomain ),
+                                                                     systemSolutionSign() );
+}
+
+void SolverBase::forFieldsOnMeshTargets( DomainPartition & domain,
+                                         std::map< string, string_array > const & fieldNames,
+                                         std::function< void ( WrapperBase & ) > const & func ) const
+{
+  forFieldsOnMeshTargets( domain, fieldNames, [&]( ObjectManagerBase &, WrapperBase & wrapper )
+  {
+    func( wrapper );
+  } );
+}
+
+void SolverBase::forFieldsOnMeshTargets( DomainPartition & domain,
+                                         std::map< string, string_array > const & fieldNames,
+                                         std::function< void ( ObjectManagerBase &, WrapperBase & ) > const & func ) const
+{
+  auto const visitFields = [&]( ObjectManagerBase & group, string const & location )
+  {
+    auto const it = fieldNames.find( location );
+    if( it == fieldNames.end() )
+    {
+      return;
+    }
+    for( string const & fieldName : it->second )
+    {
+      if( group.hasWrapper( fieldName ) )
+      {
+        func( group, group.getWrapperBase( fieldName ) );
+      }
+    }
+  };
+
+  forMeshTargets( domain.getMeshBodies(), [&]( string const &,
+                                               MeshLevel & mesh,
+                                               arrayView1d< string const > const & regionNames )
+  {
+    visitFields( mesh.getNodeManager(), "node" );
+    visitFields( mesh.getFaceManager(), "face" );
+    mesh.getElemManager().forElementSubRegions( regionNames, [&]( localIndex const,
+                                                                  ElementSubRegionBase & subRegion )
+    {
+      visitFields( subRegion, "elems" );
+    } );
+  } );
+}
+
+void SolverBase::forSystemSolutionFields( DomainPartition & GEOSX_UNUSED_PARAM( domain ),
+                                          std::function< void ( WrapperBase & ) > const & GEOSX_UNUSED_PARAM( func ) )
+{
+  GEOSX_ERROR( getName() << ": the fields modified by the solution of the linear system are not declared, "
+                            "Jacobian-free products are not supported" );
+}
+
+void SolverBase::forPrimaryVariableFields( DomainPartition & GEOSX_UNUSED_PARAM( domain ),
+                                           std::function< void ( ObjectManagerBase &, WrapperBase & ) > const & GEOSX_UNUSED_PARAM( func ) )
+{
+  GEOSX_ERROR( getName() << ": the primary variable fields are not declared, "
+                            "Jacobian-free products are not supported" );
+}
+
+real64 SolverBase::primaryVariableNorm( DomainPartition & domain )
+{
+  real64 localSquaredNorm = 0.0;
+  forPrimaryVariableFields( domain, [&]( ObjectManagerBase & group, WrapperBase & wrapper )
+  {
+    // ghost values are counted on the rank that owns them
+    arrayView1d< integer const > const ghostRank = group.ghostRank();
+    types::dispatch( types::RealArrays{}, wrapper.getTypeId(), true, [&]( auto array )
+    {
+      using ArrayType = decltype( array );
+      ArrayType const & field = Wrapper< ArrayType >::cast( wrapper ).reference();
+      field.move( LvArray::MemorySpace::host, false );
+
+      for( localIndex a = 0; a < field.size( 0 ); ++a )
+      {
+        if( ghostRank[a] < 0 )
+        {
+          LvArray::forValuesInSlice( field[a], [&]( real64 const value )
+          {
+            localSquaredNorm += value * value;
+          } );
+        }
+      }
+    } );
+  } );
+  return std::sqrt( MpiWrapper::sum( localSquaredNorm ) );
+}
+
+void SolverBase::saveSystemState( DomainPartition & domain )
+{
+  std::size_t numFields = 0;
+  forSystemSolutionFields( domain, [&]( WrapperBase & wrapper )
+  {
+    types::dispatch( types::RealArrays{}, wrapper.getTypeId(), true, [&]( auto array )
+    {
+      using ArrayType = decltype( array );
+      ArrayType const & field = Wrapper< ArrayType >::cast( wrapper ).reference();
+      field.move( LvArray::MemorySpace::host, false );
+
+      if( numFields == m_jacobianFreeState.size() )
+      {
+        m_jacobianFreeState.emplace_back();
+      }
+      array1d< real64 > & saved = m_jacobianFreeState[numFields++];
+      saved.resize( field.size() );
+      std::copy( field.data(), field.data() + field.size(), saved.data() );
+    } );
+  } );
+  m_jacobianFreeState.resize( numFields );
+}
+
+void SolverBase::restoreSystemState( DomainPartition & domain )
+{
+  std::size_t numFields = 0;
+  forSystemSolutionFields( domain, [&]( WrapperBase & wrapper )
+  {
+    types::dispatch( types::RealArrays{}, wrapper.getTypeId(), true, [&]( auto array )
+    {
+      using ArrayType = decltype( array );
+      ArrayType & field = Wrapper< ArrayType >::cast( wrapper ).reference();
+      field.move( LvArray::MemorySpace::host, true );
+
+      array1d< real64 > const & saved = m_jacobianFreeState[numFields++];
+      GEOSX_ASSERT_EQ( saved.size(), field.size() );
+      std::copy( saved.data(), saved.data() + saved.size(), field.data() );
+    } );
+  } );
+  GEOSX_ASSERT_EQ( numFields, m_jacobianFreeState.size() );
+}
+
+void SolverBase::assembleNewtonSystem( real64 const time,
+                                       real64 const dt,
+                                       DomainPartition & domain,
+                                       bool const residualOnly )
+{
+  // zero out matrix/rhs before assembly (the matrix is left to the residual-only assembly)
+  m_rhs.zero();
+
+  arrayView1d< real64 > const localRhs = m_rhs.open();
+
+  if( residualOnly )
+  {
+    m_localJacobianCurrent = assembleResidual( time,
+                                               dt,
+                                               domain,
+                                               m_dofManager,
+                                               m_localMatrix.toViewConstSizes(),
+                                               localRhs );
+  }
+  else
+  {
+    m_localMatrix.zero();
+
+    // call assemble to fill the matrix and the rhs
+    assembleSystem( time,
+                    dt,
+                    domain,
+                    m_dofManager,
+                    m_localMatrix.toViewConstSizes(),
+                    localRhs );
+    m_localJacobianCurrent = true;
+  }
+
+  // apply boundary conditions to system
+  applyBoundaryConditions( time,
+                           dt,
+                           domain,
+                           m_dofManager,
+                           m_localMatrix.toViewConstSizes(),
+                           localRhs );
+
+  m_rhs.close();
+}
+
+bool SolverBase::applyNonlinearPreconditioner( real64 const time,
+                                               real64 const dt,
+                                               DomainPartition & domain )
+{
+  GEOSX_MARK_FUNCTION;
+
+  integer const maxIter = m_nonlinearSolverParameters.m_subdomainMaxIter;
+  real64 const subdomainTol = m_nonlinearSolverParameters.m_subdomainTol;
+
+  // linear solves issued by the physics solver are now restricted to the owned dofs
+  m_subdomainSolve = true;
+  m_subdomainPatternCurrent = false;
+
+  bool assembled = false;
+  real64 initialNorm = 0.0;
+  integer iter = 0;
+  for( ; iter < maxIter; ++iter )
+  {
+    assembleNewtonSystem( time, dt, domain, false );
+    assembled = true;
+
+    // convergence is checked on the residual of the rank-local equations
+    arrayView1d< real64 const > const localRhs = m_rhs.values();
+    RAJA::ReduceSum< parallelDeviceReduce, real64 > localSumSq( 0.0 );
+    forAll< parallelDevicePolicy<> >( localRhs.size(), [=] GEOSX_HOST_DEVICE ( localIndex const i )
+    {
+      localSumSq += localRhs[i] * localRhs[i];
+    } );
+    real64 const localNorm = std::sqrt( localSumSq.get() );
+    if( iter == 0 )
+    {
+      initialNorm = localNorm;
+    }
+    bool const locallyConverged = localNorm <= subdomainTol * initialNorm;
+
+    // state updates synchronize the ghost values, so all ranks iterate until the last one has converged
+    if( MpiWrapper::min( static_cast< int >( locallyConverged ), MPI_COMM_GEOSX ) )
+    {
+      break;
+    }
+
+    solveSystem( m_dofManager, m_matrix, m_rhs, m_solution );
+    if( locallyConverged )
+    {
+      m_solution.zero();
+    }
+
+    real64 const scaleFactor = scalingForSystemSolution( domain, m_dofManager, m_solution.values() );
+    if( !checkSystemSolution( domain, m_dofManager, m_solution.values(), scaleFactor ) )
+    {
+      // leave the remaining work to the global Newton iteration
+      break;
+    }
+
+    // the owned values are updated, and the ghost values are refreshed from their owners
+    applySystemSolution( m_dofManager, m_solution.values(), scaleFactor, domain );
+    updateState( domain );
+    assembled = false;
+  }
+
+  m_subdomainSolve = false;
+
+  GEOSX_LOG_LEVEL_RANK_0( 2, GEOSX_FMT( "    Nonlinear preconditioner: {} subdomain iteration(s)", iter ) );
+
+  return assembled;
+}
+
+void SolverBase::solveSubdomainSystem( ParallelVector const & rhs,
+                                       ParallelVector & solution )
+{
+  GEOSX_MARK_FUNCTION;
+
+  globalIndex const rankOffset = m_dofManager.rankOffset();
+  localIndex const numRows = m_localMatrix.numRows();
+
+  m_localMatrix.move( LvArray::MemorySpace::host, false );
+  CRSMatrixView< real64 const, globalIndex const > const localMatrix = m_localMatrix.toViewConst();
+
+  // The pattern of the local matrix does not change within a Newton step, so the owned block is only built once
+  if( !m_subdomainPatternCurrent )
+  {
+    // Keep the columns of owned dofs only, the couplings to ghost dofs are dropped from subdomain solves.
+    // The columns of a row are sorted, so the owned ones form a contiguous range of its entries.
+    m_subdomainFirstEntry.resizeWithoutInitializationOrDestruction( numRows );
+    array1d< localIndex > rowLengths( numRows );
+    arrayView1d< localIndex > const firstEntry = m_subdomainFirstEntry.toView();
+    arrayView1d< localIndex > const lengths = rowLengths.toView();
+    forAll< parallelHostPolicy >( numRows, [=]( localIndex const row )
+    {
+      arraySlice1d< globalIndex const > const cols = localMatrix.getColumns( row );
+      globalIndex const * const first = std::lower_bound( cols.begin(), cols.end(), rankOffset );
+      globalIndex const * const last = std::lower_bound( first, cols.end(), rankOffset + numRows );
+      firstEntry[row] = first - cols.begin();
+      lengths[row] = last - first;
+    } );
+
+    SparsityPattern< globalIndex > pattern;
+    pattern.resizeFromRowCapacities< parallelHostPolicy >( numRows, numRows, rowLengths.data() );
+    SparsityPatternView< globalIndex > const patternView = pattern.toView();
+    forAll< parallelHostPolicy >( numRows, [=]( localIndex const row )
+    {
+      arraySlice1d< globalIndex const > const cols = localMatrix.getColumns( row );
+      for( localIndex k = firstEntry[row]; k < firstEntry[row] + lengths[row]; ++k )
+      {
+        patternView.insertNonZero( row, cols[k] - rankOffset );
+      }
+    } );
+    m_subdomainLocalMatrix.assimilate< parallelHostPolicy >( std::move( pattern ) );
+  }
+
+  m_subdomainLocalMatrix.move( LvArray::MemorySpace::host, true );
+  CRSMatrixView< real64, globalIndex const > const subdomainMatrix = m_subdomainLocalMatrix.toViewConstSizes();
+  arrayView1d< localIndex const > const firstEntry = m_subdomainFirstEntry.toViewConst();
+  forAll< parallelHostPolicy >( numRows, [=]( localIndex const row )
+  {
+    arraySlice1d< real64 const > const vals = localMatrix.getEntries( row );
+    arraySlice1d< real64 > const subdomainVals = subdomainMatrix.getEntries( row );
+    for( localIndex k = 0; k < subdomainVals.size(); ++k )
+    {
+      subdomainVals[k] = vals[firstEntry[row] + k];
+    }
+  } );
+
+  if( m_subdomainPatternCurrent )
+  {
+    m_subdomainMatrix.updateValues( m_subdomainLocalMatrix.toViewConst() );
+  }
+  else
+  {
+    m_subdomainMatrix.create( m_subdomainLocalMatrix.toViewConst(), numRows, MPI_COMM_SELF );
+    m_subdomainPatternCurrent = true;
+  }
+
+  if( !m_subdomainSolver )
+  {
+    LinearSolverParameters params = m_linearSolverParameters.get();
+    params.solverType = LinearSolverParameters::SolverType::direct;
+    m_subdomainSolver = LAInterface::createSolver( params );
+  }
+
+  // the values change at every local Newton iteration, so the factorization is recomputed
+  m_subdomainSolver->setup( m_subdomainMatrix );
+
+  ParallelVector subdomainRhs;
+  ParallelVector subdomainSolution;
+  subdomainRhs.create( numRows, MPI_COMM_SELF );
+  subdomainSolution.create( numRows, MPI_COMM_SELF );
+  subdomainRhs.open().setValues< parallelDevicePolicy<> >( rhs.values() );
+  subdomainRhs.close();
+
+  m_subdomainSolver->solve( subdomainRhs, subdomainSolution );
+  GEOSX_WARNING_IF( !m_subdomainSolver->result().success(), "Subdomain linear solution failed" );
+
+  solution.open().setValues< parallelDevicePolicy<> >( subdomainSolution.values() );
+  solution.close();
+}
+
+bool SolverBase::jacobianUpdateRequired( integer const newtonIter,
+                                         real64 const residualNorm,
+                                         real64 const lastResidual,
+                                         bool const lineSearchApplied ) const
+{
+  NonlinearSolverParameters const & params = m_nonlinearSolverParameters;
+
+  // Always start a Newton loop with a fresh Jacobian, and recompute it when the lag limit is reached
+  if( params.m_jacobianUpdateInterval <= 1 || newtonIter == 0 || m_jacobianAge + 1 >= params.m_jacobianUpdateInterval )
+  {
+    return true;
+  }
+
+  // The previous iteration was not a productive one
+  if( lineSearchApplied || !m_linearSolverResult.success() )
+  {
+    return true;
+  }
+
+  // The contraction rate of the (quasi-)Newton iteration has degraded
+  return residualNorm > params.m_jacobianContractionLimit * lastResidual;
+}
+
+void SolverBase::applyBroydenUpdate( ParallelVector & solution )
+{
+  // On input, solution = H_0 b_{k+1}; apply previous corrections H_k = (I + a_{k-1} t_{k-1}^T) ... (I + a_0 t_0^T) H_0
+  for( std::size_t j = 0; j < m_broydenSteps.size(); ++j )
+  {
+    solution.axpy( m_broydenSteps[j].dot( solution ), m_broydenCorrections[j] );
+  }
+
+  // New rank-one correction from the last step t_k = scale * x_k, with x_k = H_k b_k:
+  // a_k = ( t_k - H_k ( b_k - b_{k+1} ) ) / ( t_k^T H_k ( b_k - b_{k+1} ) )
+  ParallelVector step( m_broydenDirection );
+  step.scale( m_broydenScale );
+
+  ParallelVector correction( m_broydenDirection );
+  correction.axpy( -1.0, solution );
+  real64 const denom = step.dot( correction );
+  if( std::abs( denom ) <= std::numeric_limits< real64 >::epsilon() * step.norm2() * correction.norm2() )
+  {
+    // Degenerate secant condition, keep the lagged direction
+    return;
+  }
+  correction.axpby( 1.0 / denom, step, -1.0 / denom );
+
+  // x_{k+1} = ( I + a_k t_k^T ) H_k b_{k+1}
+  solution.axpy( step.dot( solution ), correction );
+
+  m_broydenSteps.emplace_back( std::move( step ) );
+  m_broydenCorrections.emplace_back( std::move( correction ) );
+}
+
+void SolverBase::releaseDirectSolverFactorization()
+{
+  // Numeric factors are as large as the factorized matrix (or larger), and cannot be reused
+  // for the next step, whose matrix values are different
+  if( m_directSolver )
+  {
+    m_directSolver->releaseNumericFactorization();
+  }
+}
+
+bool SolverBase::preconditionerSetupRequired( ParallelMatrix const & matrix ) const
+{
+  LinearSolverParameters::Reuse const & reuse = m_linearSolverParameters.get().reuse;
+
+  // The preconditioner has been cleared (e.g. matrix re-created) or was computed for another matrix
+  if( !m_precond->ready() || m_precondSetupMatrix != &matrix )
+  {
+    return true;
+  }
+
+  // The last solve with the current setup failed to converge
+  if( !m_linearSolverResult.success() )
+  {
+    return true;
+  }
+
+  if( m_precondNumSolves >= reuse.maxSolves )
+  {
+    return true;
+  }
+
+  // Krylov iteration count has grown too much compared to the first solve after setup
+  if( reuse.policy == LinearSolverParameters::Reuse::Policy::adaptive
+      && m_linearSolverResult.numIterations > reuse.iterGrowthFactor * std::max( m_precondSetupIterations, 1 ) )
+  {
+    return true;
+  }
+
+  return false;
+}
+
 bool SolverBase::checkSystemSolution( DomainPartition const & GEOSX_UNUSED_PARAM( domain ),
                                       DofManager const & GEOSX_UNUSED_PARAM( dofManager ),
                                       arrayView1d< real64 const > const & GEOSX_UNUSED_PARAM( localSolution ),
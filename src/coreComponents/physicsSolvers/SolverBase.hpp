@@ -19,6 +19,8 @@
 #include "common/DataTypes.hpp"
 #include "dataRepository/ExecutableGroup.hpp"
 #include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "linearAlgebra/solvers/KrylovRecycleSpace.hpp"
+#include "linearAlgebra/utilities/JacobianFreeOperator.hpp"
 #include "linearAlgebra/utilities/LinearSolverResult.hpp"
 #include "linearAlgebra/DofManager.hpp"
 #include "mesh/DomainPartition.hpp"
@@ -27,6 +29,7 @@
 #include "physicsSolvers/LinearSolverParameters.hpp"
 
 
+#include <functional>
 #include <limits>
 
 namespace geosx
@@ -150,6 +153,23 @@ public:
   void setNextDtBasedOnNewtonIter( real64 const & currentDt,
                                    real64 & nextDt );
 
+  /**
+   * @brief Select the next time step from the state change over the last converged steps.
+   * @param currentDt the last accepted time step
+   * @return the time step meeting the state change targets of the solver
+   *
+   * Uses the state changes recorded with recordStateChange(), either through a proportional
+   * rule or a PID controller depending on the time step control of the nonlinear solver, with the
+   * gains and the bounds on the change of the time step set in the nonlinear solver parameters.
+   */
+  real64 setNextDtBasedOnStateChange( real64 const & currentDt ) const;
+
+  /**
+   * @brief Record the state change over the last converged step.
+   * @param ratio largest ratio of the change of a monitored quantity to its target
+   */
+  void recordStateChange( real64 const ratio );
+
 
   /**
    * @brief Entry function for an explicit time integration step
@@ -314,6 +334,30 @@ public:
                   CRSMatrixView< real64, globalIndex const > const & localMatrix,
                   arrayView1d< real64 > const & localRhs );
 
+  /**
+   * @brief function to assemble the residual only, skipping the derivatives wherever possible
+   * @param time the time at the beginning of the step
+   * @param dt the desired timestep
+   * @param domain the domain partition
+   * @param dofManager degree-of-freedom manager associated with the linear system
+   * @param localMatrix the system matrix (not zeroed by the caller)
+   * @param localRhs the system right-hand side vector
+   * @return @p true if @p localMatrix holds the Jacobian at the current state on exit
+   *
+   * This is used by the line search and the Jacobian-free products, which only need residual
+   * values. Overrides launching residual-only kernels must leave @p localMatrix untouched and
+   * return false: its diagonal, last computed by a full assembly, is still used by the boundary
+   * conditions to scale the constrained rows. The default implementation zeroes the matrix and
+   * performs a full assembly.
+   */
+  virtual bool
+  assembleResidual( real64 const time,
+                    real64 const dt,
+                    DomainPartition & domain,
+                    DofManager const & dofManager,
+                    CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                    arrayView1d< real64 > const & localRhs );
+
   /**
    * @brief apply boundary condition to system
    * @param domain the domain partition
@@ -457,6 +501,37 @@ public:
                        real64 const scalingFactor,
                        DomainPartition & domain );
 
+  /**
+   * @brief Get the sign convention of the linear system.
+   * @return 1 if the solver solves <tt>J*dx = -R</tt> and applySystemSolution() adds the solution,
+   *         -1 if it solves <tt>J*dx = R</tt> and applySystemSolution() subtracts the solution
+   *
+   * Relates finite differences of the assembled residual to the system operator in Jacobian-free products.
+   */
+  virtual real64 systemSolutionSign() const { return 1.0; }
+
+  /**
+   * @brief Apply a function to the fields modified by applySystemSolution().
+   * @param domain the domain partition
+   * @param func the function called with the wrapper of each field
+   *
+   * Used to save and restore the state around residual evaluations at perturbed states. The derived
+   * physics solver must override this function in order to use Jacobian-free products.
+   */
+  virtual void forSystemSolutionFields( DomainPartition & domain,
+                                        std::function< void ( dataRepository::WrapperBase & ) > const & func );
+
+  /**
+   * @brief Apply a function to the primary variable fields updated by applySystemSolution().
+   * @param domain the domain partition
+   * @param func the function called with the object manager holding each field and its wrapper
+   *
+   * Used to scale the finite-difference step of Jacobian-free products with the size of the solution.
+   * The derived physics solver must override this function in order to use Jacobian-free products.
+   */
+  virtual void forPrimaryVariableFields( DomainPartition & domain,
+                                         std::function< void ( ObjectManagerBase &, dataRepository::WrapperBase & ) > const & func );
+
   /**
    * @brief Recompute all dependent quantities from primary variables (including constitutive models)
    * @param domain the domain containing the mesh and fields
@@ -575,6 +650,15 @@ public:
     return m_nonlinearSolverParameters;
   }
 
+  /**
+   * @brief Get the number of linear solves performed with the current preconditioner setup.
+   * @return the number of solves since the last setup of the persistent preconditioner (0 if there is none)
+   */
+  integer numSolvesSincePreconditionerSetup() const
+  {
+    return m_precond ? m_precondNumSolves : 0;
+  }
+
   /**
    * @brief Get position of a given region within solver's target region list
    * @param regionName the region name to find
@@ -623,6 +707,173 @@ protected:
                                  real64 const oldNewtonNorm,
                                  real64 const weakestTol );
 
+  /**
+   * @brief Compose the parallel system matrix out of the local matrix.
+   *
+   * If the sparsity pattern of the local matrix has not changed since the parallel
+   * matrix was last created, only the values are copied into the existing parallel
+   * structure (row/column maps and communication data are reused). Otherwise, the
+   * parallel matrix is fully re-created.
+   */
+  void composeParallelMatrix();
+
+  /**
+   * @brief Move a sparsity pattern into a local matrix, and record whether the pattern has changed.
+   * @param localMatrix the local matrix
+   * @param pattern the new sparsity pattern of @p localMatrix
+   *
+   * The pattern version is only incremented if @p pattern differs from the current pattern of @p localMatrix.
+   * Solvers that rebuild the same pattern at each time step thus keep the parallel matrix structure,
+   * the reused preconditioner and the recycled Krylov subspace across time steps.
+   */
+  void assimilateSparsityPattern( CRSMatrix< real64, globalIndex > & localMatrix,
+                                  SparsityPattern< globalIndex > && pattern );
+
+  /**
+   * @brief Decide whether the preconditioner must be recomputed before the next solve.
+   * @param matrix the system matrix about to be solved
+   * @return @p true if the preconditioner setup cannot be reused according to the reuse policy
+   */
+  bool preconditionerSetupRequired( ParallelMatrix const & matrix ) const;
+
+  /**
+   * @brief Free the numeric factorization of the direct solver at the end of a step.
+   *
+   * Only data depending on the sparsity pattern (e.g. the symbolic factorization) is kept for the next step.
+   */
+  void releaseDirectSolverFactorization();
+
+  /**
+   * @brief Assemble the residual, and optionally the Jacobian, of the Newton system at the current state.
+   * @param time the time at the beginning of the step
+   * @param dt the time step size
+   * @param domain the domain partition
+   * @param residualOnly if true, the local matrix is only updated if the physics solver cannot skip it
+   */
+  void assembleNewtonSystem( real64 const time,
+                             real64 const dt,
+                             DomainPartition & domain,
+                             bool const residualOnly );
+
+  /**
+   * @brief Apply the nonlinear preconditioner ahead of a global Newton iteration.
+   * @param time the time at the beginning of the step
+   * @param dt the time step size
+   * @param domain the domain partition
+   * @return @p true if the Newton system is assembled at the resulting state
+   *
+   * Nonlinear block Jacobi: each rank runs a few Newton iterations on the equations of its locally
+   * owned dofs. The couplings to ghost dofs are dropped from the local linear systems, so each local
+   * solve only updates the owned dofs. The state update that follows each local solve synchronizes
+   * the ghosts, so the blocks exchange their latest values between local iterations, and the
+   * iterations are collective: all ranks continue until the last one has converged. Since there is
+   * no overlap and the ghost values are not frozen, this is not a restricted additive Schwarz method.
+   */
+  bool applyNonlinearPreconditioner( real64 const time,
+                                     real64 const dt,
+                                     DomainPartition & domain );
+
+  /**
+   * @brief Solve the Newton system restricted to the dofs owned by this rank.
+   * @param rhs the right-hand side of the linear system
+   * @param solution the solution vector (ghost couplings are ignored)
+   *
+   * The sparsity pattern of the owned block is built at the first local iteration of a Newton step,
+   * later iterations only copy the values of the local matrix into it.
+   */
+  void solveSubdomainSystem( ParallelVector const & rhs,
+                             ParallelVector & solution );
+
+  /**
+   * @brief Decide whether the Jacobian must be recomputed in the current Newton iteration.
+   * @param newtonIter index of the current Newton iteration
+   * @param residualNorm the current residual norm
+   * @param lastResidual the residual norm of the previous Newton iteration
+   * @param lineSearchApplied whether a line search was performed in the current iteration
+   * @return @p false if the Jacobian of a previous iteration can be reused
+   */
+  bool jacobianUpdateRequired( integer const newtonIter,
+                               real64 const residualNorm,
+                               real64 const lastResidual,
+                               bool const lineSearchApplied ) const;
+
+  /**
+   * @brief Turn the solution computed with a lagged Jacobian into a Broyden quasi-Newton direction.
+   * @param solution on input, the solution of the lagged system; on output, the corrected direction
+   *
+   * Uses the "good" Broyden update of the inverse Jacobian in product form, so that each iteration only
+   * requires one solve with the lagged Jacobian and a rank-one correction per lagged iteration.
+   */
+  void applyBroydenUpdate( ParallelVector & solution );
+
+  /**
+   * @brief Store the linearization point for Jacobian-free products in the next linear solve.
+   * @param time the time at the beginning of the step
+   * @param dt the time step size
+   * @param domain the domain partition
+   * @param residual the assembled residual at the current state
+   *
+   * Must be called after assembly and before solveSystem(); the stored context is
+   * released by clearJacobianFree().
+   */
+  void setupJacobianFree( real64 const time,
+                          real64 const dt,
+                          DomainPartition & domain,
+                          ParallelVector const & residual );
+
+  /**
+   * @brief Release the Jacobian-free context stored by setupJacobianFree().
+   */
+  void clearJacobianFree();
+
+  /**
+   * @brief Create an operator applying the Jacobian through finite differences of the residual.
+   * @param dofManager degree-of-freedom manager associated with the linear system
+   * @return the operator
+   */
+  std::unique_ptr< JacobianFreeOperator< ParallelVector > >
+  createJacobianFreeOperator( DofManager const & dofManager );
+
+  /**
+   * @brief Apply a function to fields of the mesh targets of the solver.
+   * @param domain the domain partition
+   * @param fieldNames names of the fields by location ("node", "face" or "elems"), as in synchronizeFields()
+   * @param func the function called with the wrapper of each field
+   *
+   * Subregions of the target regions that do not hold a field are skipped.
+   */
+  void forFieldsOnMeshTargets( DomainPartition & domain,
+                               std::map< string, string_array > const & fieldNames,
+                               std::function< void ( dataRepository::WrapperBase & ) > const & func ) const;
+
+  /**
+   * @copydoc forFieldsOnMeshTargets( DomainPartition &, std::map< string, string_array > const &, std::function< void ( dataRepository::WrapperBase & ) > const & ) const
+   *
+   * The function is also called with the object manager (node, face or element subregion) holding the field.
+   */
+  void forFieldsOnMeshTargets( DomainPartition & domain,
+                               std::map< string, string_array > const & fieldNames,
+                               std::function< void ( ObjectManagerBase &, dataRepository::WrapperBase & ) > const & func ) const;
+
+  /**
+   * @brief Save the fields modified by applySystemSolution() into m_jacobianFreeState.
+   * @param domain the domain partition
+   */
+  void saveSystemState( DomainPartition & domain );
+
+  /**
+   * @brief Restore the fields modified by applySystemSolution() from m_jacobianFreeState.
+   * @param domain the domain partition
+   */
+  void restoreSystemState( DomainPartition & domain );
+
+  /**
+   * @brief Compute the norm of the primary variables over the locally owned objects.
+   * @param domain the domain partition
+   * @return the global 2-norm of the fields visited by forPrimaryVariableFields()
+   */
+  real64 primaryVariableNorm( DomainPartition & domain );
+
   /**
    * @brief Get the Constitutive Name object
    *
@@ -665,9 +916,87 @@ protected:
   /// Local system matrix and rhs
   CRSMatrix< real64, globalIndex > m_localMatrix;
 
+  /// Version of the sparsity pattern of the local matrix, incremented each time the pattern is (re)built
+  integer m_sparsityPatternVersion = 0;
+
+  /// Version of the sparsity pattern used to create the current parallel matrix
+  integer m_matrixSparsityPatternVersion = -1;
+
   /// Custom preconditioner for the "native" iterative solver
   std::unique_ptr< PreconditionerBase< LAInterface > > m_precond;
 
+  /// Direct solver, persistent to allow reuse of the symbolic factorization
+  std::unique_ptr< LinearSolverBase< LAInterface > > m_directSolver;
+
+  /// Version of the sparsity pattern of the block operator of the native preconditioner (-1 if unknown)
+  integer m_precondSparsityPatternVersion = -1;
+
+  /// Matrix used in the last preconditioner setup
+  ParallelMatrix const * m_precondSetupMatrix = nullptr;
+
+  /// Number of linear solves performed since the last preconditioner setup
+  integer m_precondNumSolves = 0;
+
+  /// Number of Krylov iterations of the first solve after the last preconditioner setup
+  integer m_precondSetupIterations = 0;
+
+  /// Approximate low modes recycled across consecutive GMRES solves
+  KrylovRecycleSpace< ParallelVector > m_krylovRecycleSpace;
+
+  /// Residual at the linearization point of Jacobian-free products
+  ParallelVector m_jacobianFreeResidual;
+
+  /// Domain for residual evaluations in Jacobian-free products (nullptr if not active)
+  DomainPartition * m_jacobianFreeDomain = nullptr;
+
+  /// Time for residual evaluations in Jacobian-free products
+  real64 m_jacobianFreeTime = 0.0;
+
+  /// Time step size for residual evaluations in Jacobian-free products
+  real64 m_jacobianFreeDt = 0.0;
+
+  /// Values of the fields modified by applySystemSolution() at the linearization point of Jacobian-free products
+  std::vector< array1d< real64 > > m_jacobianFreeState;
+
+  /// Number of Newton iterations since the Jacobian in the parallel matrix was computed (0 if current)
+  integer m_jacobianAge = 0;
+
+  /// Flag indicating whether the local matrix holds the Jacobian at the current state
+  bool m_localJacobianCurrent = false;
+
+  /// State change ratios of the last three converged steps, most recent first (negative if not measured)
+  real64 m_stateChangeRatios[3] = { -1.0, -1.0, -1.0 };
+
+  /// Flag to restrict linear solves to the dofs owned by this rank (during nonlinear preconditioning)
+  bool m_subdomainSolve = false;
+
+  /// Flag indicating that the owned block of the local matrix has been built in the current Newton step
+  bool m_subdomainPatternCurrent = false;
+
+  /// Block of the local matrix coupling the dofs owned by this rank
+  CRSMatrix< real64, globalIndex > m_subdomainLocalMatrix;
+
+  /// Position, in each row of the local matrix, of the first entry in an owned column
+  array1d< localIndex > m_subdomainFirstEntry;
+
+  /// Parallel (single rank) version of the owned block
+  ParallelMatrix m_subdomainMatrix;
+
+  /// Direct solver for the subdomain solves of the nonlinear preconditioner
+  std::unique_ptr< LinearSolverBase< LAInterface > > m_subdomainSolver;
+
+  /// Rank-one corrections of the inverse Jacobian in Broyden updates
+  std::vector< ParallelVector > m_broydenCorrections;
+
+  /// Scaled Newton steps of previous iterations in Broyden updates
+  std::vector< ParallelVector > m_broydenSteps;
+
+  /// Newton direction of the last iteration in Broyden updates
+  ParallelVector m_broydenDirection;
+
+  /// Scaling factor applied to the last Newton direction in Broyden updates
+  real64 m_broydenScale = 1.0;
+
   /// Linear solver parameters
   LinearSolverParametersInput m_linearSolverParameters;
 
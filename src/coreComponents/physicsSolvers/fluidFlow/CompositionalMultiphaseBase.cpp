@@ -62,7 +62,11 @@ CompositionalMultiphaseBase::CompositionalMultiphaseBase( const string & name,
   m_thermalFlag( 0 ),
   m_maxCompFracChange( 1.0 ),
   m_minScalingFactor( 0.01 ),
-  m_allowCompDensChopping( 1 )
+  m_allowCompDensChopping( 1 ),
+  m_targetRelativePresChange( 0.2 ),
+  m_targetPhaseVolFracChange( 0.2 ),
+  m_targetCompFracChange( 0.1 ),
+  m_targetFlowCFL( -1.0 )
 {
 //START_SPHINX_INCLUDE_00
   this->registerWrapper( viewKeyStruct::inputTemperatureString(), &m_inputTemperature ).
@@ -91,6 +95,30 @@ CompositionalMultiphaseBase::CompositionalMultiphaseBase( const string & name,
     setApplyDefaultValue( 1 ).
     setDescription( "Flag indicating whether local (cell-wise) chopping of negative compositions is allowed" );
 
+  this->registerWrapper( viewKeyStruct::targetRelativePresChangeString(), &m_targetRelativePresChange ).
+    setSizedFromParent( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 0.2 ).
+    setDescription( "Target (relative) change in pressure over a time step, used with state-based time step control" );
+
+  this->registerWrapper( viewKeyStruct::targetPhaseVolFracChangeString(), &m_targetPhaseVolFracChange ).
+    setSizedFromParent( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 0.2 ).
+    setDescription( "Target (absolute) change in phase volume fraction over a time step, used with state-based time step control" );
+
+  this->registerWrapper( viewKeyStruct::targetCompFracChangeString(), &m_targetCompFracChange ).
+    setSizedFromParent( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 0.1 ).
+    setDescription( "Target (absolute) change in component fraction over a time step, used with state-based time step control" );
+
+  this->registerWrapper( viewKeyStruct::targetFlowCFLString(), &m_targetFlowCFL ).
+    setSizedFromParent( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( -1.0 ).
+    setDescription( "Target CFL number limiting the next time step with the StateChange and PID time step controls (only with finite volumes, disabled if not positive)" );
+
 }
 
 void CompositionalMultiphaseBase::postProcessInput()
@@ -101,6 +129,19 @@ void CompositionalMultiphaseBase::postProcessInput()
                          "The maximum absolute change in component fraction must smaller or equal to 1.0" );
   GEOSX_ERROR_IF_LT_MSG( m_maxCompFracChange, 0.0,
                          "The maximum absolute change in component fraction must larger or equal to 0.0" );
+
+  GEOSX_ERROR_IF_LE_MSG( m_targetRelativePresChange, 0.0,
+                         viewKeyStruct::targetRelativePresChangeString() << " must be positive" );
+  GEOSX_ERROR_IF_LE_MSG( m_targetPhaseVolFracChange, 0.0,
+                         viewKeyStruct::targetPhaseVolFracChangeString() << " must be positive" );
+  GEOSX_ERROR_IF_LE_MSG( m_targetCompFracChange, 0.0,
+                         viewKeyStruct::targetCompFracChangeString() << " must be positive" );
+
+  // the time step limit is derived from the CFL numbers of the last step
+  if( m_targetFlowCFL > 0.0 )
+  {
+    m_computeCFLNumbers = 1;
+  }
 }
 
 void CompositionalMultiphaseBase::registerDataOnMesh( Group & meshBodies )
@@ -497,12 +538,54 @@ void CompositionalMultiphaseBase::updateFluidState( ObjectManagerBase & subRegio
 {
   GEOSX_MARK_FUNCTION;
 
+  // the fluid update runs with the execution policy of the fluid model, which may be serial
   updateComponentFraction( subRegion );
   updateFluidModel( subRegion );
-  updatePhaseVolumeFraction( subRegion );
-  updateRelPermModel( subRegion );
+
+  string const & fluidName = subRegion.getReference< string >( viewKeyStruct::fluidNamesString() );
+  MultiFluidBase const & fluid = getConstitutiveModel< MultiFluidBase >( subRegion, fluidName );
+
+  string const & relpermName = subRegion.getReference< string >( viewKeyStruct::relPermNamesString() );
+  RelativePermeabilityBase & relPerm = getConstitutiveModel< RelativePermeabilityBase >( subRegion, relpermName );
+
+  // phase volume fractions, relperms and capillary pressures do not depend on the fluid model type,
+  // so they are updated in a single parallel sweep over the elements
+  constitutive::constitutiveUpdatePassThru( relPerm, [&] ( auto & castedRelPerm )
+  {
+    typename TYPEOFREF( castedRelPerm ) ::KernelWrapper relPermWrapper = castedRelPerm.createKernelWrapper();
+
+    if( m_capPressureFlag )
+    {
+      string const & cappresName = subRegion.getReference< string >( viewKeyStruct::capPressureNamesString() );
+      CapillaryPressureBase & capPressure = getConstitutiveModel< CapillaryPressureBase >( subRegion, cappresName );
+
+      constitutive::constitutiveUpdatePassThru( capPressure, [&] ( auto & castedCapPres )
+      {
+        typename TYPEOFREF( castedCapPres ) ::KernelWrapper capPresWrapper = castedCapPres.createKernelWrapper();
+
+        PhaseStateUpdateKernelFactory::
+          createAndLaunch< parallelDevicePolicy<> >( m_numComponents,
+                                                     m_numPhases,
+                                                     subRegion,
+                                                     fluid,
+                                                     relPermWrapper,
+                                                     capPresWrapper );
+      } );
+    }
+    else
+    {
+      PhaseStateUpdateKernelFactory::
+        createAndLaunch< parallelDevicePolicy<> >( m_numComponents,
+                                                   m_numPhases,
+                                                   subRegion,
+                                                   fluid,
+                                                   relPermWrapper,
+                                                   NoOpCapPressureWrapper{} );
+    }
+  } );
+
+  // the phase mobility depends on the discretization, so it is updated in a separate sweep
   updatePhaseMobility( subRegion );
-  updateCapPressureModel( subRegion );
   // note: for now, thermal conductivity is treated explicitly, so no update here
 }
 
@@ -1038,7 +1121,8 @@ void CompositionalMultiphaseBase::assembleSystem( real64 const GEOSX_UNUSED_PARA
 void CompositionalMultiphaseBase::assembleAccumulationAndVolumeBalanceTerms( DomainPartition & domain,
                                                                              DofManager const & dofManager,
                                                                              CRSMatrixView< real64, globalIndex const > const & localMatrix,
-                                                                             arrayView1d< real64 > const & localRhs ) const
+                                                                             arrayView1d< real64 > const & localRhs,
+                                                                             bool const residualOnly ) const
 {
   GEOSX_MARK_FUNCTION;
 
@@ -1057,16 +1141,29 @@ void CompositionalMultiphaseBase::assembleAccumulationAndVolumeBalanceTerms( Dom
       MultiFluidBase const & fluid = getConstitutiveModel< MultiFluidBase >( subRegion, fluidName );
       CoupledSolidBase const & solid = getConstitutiveModel< CoupledSolidBase >( subRegion, solidName );
 
-      ElementBasedAssemblyKernelFactory::
-        createAndLaunch< parallelDevicePolicy<> >( m_numComponents,
-                                                   m_numPhases,
-                                                   dofManager.rankOffset(),
-                                                   dofKey,
-                                                   subRegion,
-                                                   fluid,
-                                                   solid,
-                                                   localMatrix,
-                                                   localRhs );
+      auto launchKernel = [&]( auto RO )
+      {
+        bool constexpr RESIDUAL_ONLY = RO();
+        ElementBasedAssemblyKernelFactory::
+          createAndLaunch< parallelDevicePolicy<>, RESIDUAL_ONLY >( m_numComponents,
+                                                                    m_numPhases,
+                                                                    dofManager.rankOffset(),
+                                                                    dofKey,
+                                                                    subRegion,
+                                                                    fluid,
+                                                                    solid,
+                                                                    localMatrix,
+                                                                    localRhs );
+      };
+
+      if( residualOnly )
+      {
+        launchKernel( std::true_type{} );
+      }
+      else
+      {
+        launchKernel( std::false_type{} );
+      }
     } );
   } );
 }
@@ -1536,6 +1633,12 @@ void CompositionalMultiphaseBase::implicitStepComplete( real64 const & time,
   // otherwise the aquifer flux is saved with the wrong pressure time level
   saveAquiferConvergedState( time, dt, domain );
 
+  // the state change must be measured before the Newton updates are accumulated into the primary variables
+  if( m_nonlinearSolverParameters.m_timeStepControl != NonlinearSolverParameters::TimeStepControl::NewtonIterations )
+  {
+    recordStateChange( computeStateChangeRatio( domain ) );
+  }
+
   forMeshTargets( domain.getMeshBodies(), [&]( string const &,
                                                MeshLevel & mesh,
                                                arrayView1d< string const > const & regionNames )
@@ -1606,6 +1709,56 @@ void CompositionalMultiphaseBase::implicitStepComplete( real64 const & time,
   } );
 }
 
+real64 CompositionalMultiphaseBase::computeStateChangeRatio( DomainPartition const & domain ) const
+{
+  GEOSX_MARK_FUNCTION;
+
+  real64 localMaxRatio = 0.0;
+
+  forMeshTargets( domain.getMeshBodies(), [&]( string const &,
+                                               MeshLevel const & mesh,
+                                               arrayView1d< string const > const & regionNames )
+  {
+    mesh.getElemManager().forElementSubRegions( regionNames,
+                                                [&]( localIndex const,
+                                                     ElementSubRegionBase const & subRegion )
+    {
+      arrayView1d< integer const > const & elemGhostRank = subRegion.ghostRank();
+
+      arrayView1d< real64 const > const pres =
+        subRegion.getExtrinsicData< extrinsicMeshData::flow::pressure >();
+      arrayView1d< real64 const > const dPres =
+        subRegion.getExtrinsicData< extrinsicMeshData::flow::deltaPressure >();
+      arrayView2d< real64 const, compflow::USD_COMP > const compDens =
+        subRegion.getExtrinsicData< extrinsicMeshData::flow::globalCompDensity >();
+      arrayView2d< real64 const, compflow::USD_COMP > const dCompDens =
+        subRegion.getExtrinsicData< extrinsicMeshData::flow::deltaGlobalCompDensity >();
+      arrayView2d< real64 const, compflow::USD_PHASE > const phaseVolFrac =
+        subRegion.getExtrinsicData< extrinsicMeshData::flow::phaseVolumeFraction >();
+      arrayView2d< real64 const, compflow::USD_PHASE > const phaseVolFracOld =
+        subRegion.getExtrinsicData< extrinsicMeshData::flow::phaseVolumeFractionOld >();
+
+      real64 const subRegionMaxRatio =
+        StateChangeKernel::launch< parallelDevicePolicy<>,
+                                   parallelDeviceReduce >( m_numComponents,
+                                                           m_numPhases,
+                                                           elemGhostRank,
+                                                           pres,
+                                                           dPres,
+                                                           compDens,
+                                                           dCompDens,
+                                                           phaseVolFrac,
+                                                           phaseVolFracOld,
+                                                           m_targetRelativePresChange,
+                                                           m_targetPhaseVolFracChange,
+                                                           m_targetCompFracChange );
+      localMaxRatio = LvArray::math::max( localMaxRatio, subRegionMaxRatio );
+    } );
+  } );
+
+  return MpiWrapper::max( localMaxRatio );
+}
+
 void CompositionalMultiphaseBase::updateState( DomainPartition & domain )
 {
   forMeshTargets( domain.getMeshBodies(), [&]( string const &,
@@ -118,6 +118,15 @@ public:
                         real64 const & dt,
                         DomainPartition & domain ) override;
 
+  /**
+   * @brief Measure the state change over the current time step
+   * @param domain the domain containing the mesh and fields
+   * @return the largest ratio of the change in pressure, phase volume fraction or component fraction to its target
+   *
+   * Must be called before the Newton updates are accumulated into the primary variables.
+   */
+  real64 computeStateChangeRatio( DomainPartition const & domain ) const;
+
   /**
    * @brief Recompute component fractions from primary variables (component densities)
    * @param dataGroup the group storing the required fields
@@ -154,6 +163,13 @@ public:
    */
   virtual void updatePhaseMobility( ObjectManagerBase & dataGroup ) const = 0;
 
+  /**
+   * @brief Update the component fractions, the constitutive models and the phase mobility in a subregion
+   * @param dataGroup the group storing the required fields
+   *
+   * The phase volume fraction, relative permeability and capillary pressure updates are fused in a single
+   * kernel launch, while the fluid update keeps its own sweep with the execution policy of the fluid model.
+   */
   void updateFluidState( ObjectManagerBase & dataGroup ) const;
 
   virtual void updateState( DomainPartition & domain ) override final;
@@ -178,11 +194,13 @@ public:
    * @param dofManager degree-of-freedom manager associated with the linear system
    * @param localMatrix the system matrix
    * @param localRhs the system right-hand side vector
+   * @param residualOnly if true, the derivatives are skipped and the matrix is left untouched
    */
   void assembleAccumulationAndVolumeBalanceTerms( DomainPartition & domain,
                                                   DofManager const & dofManager,
                                                   CRSMatrixView< real64, globalIndex const > const & localMatrix,
-                                                  arrayView1d< real64 > const & localRhs ) const;
+                                                  arrayView1d< real64 > const & localRhs,
+                                                  bool const residualOnly = false ) const;
 
   /**
    * @brief assembles the flux terms for all cells
@@ -224,6 +242,14 @@ public:
     static constexpr char const * maxCompFracChangeString() { return "maxCompFractionChange"; }
 
     static constexpr char const * allowLocalCompDensChoppingString() { return "allowLocalCompDensityChopping"; }
+
+    static constexpr char const * targetRelativePresChangeString() { return "targetRelativePressureChangeInTimeStep"; }
+
+    static constexpr char const * targetPhaseVolFracChangeString() { return "targetPhaseVolFractionChangeInTimeStep"; }
+
+    static constexpr char const * targetCompFracChangeString() { return "targetCompFractionChangeInTimeStep"; }
+
+    static constexpr char const * targetFlowCFLString() { return "targetFlowCFL"; }
   };
 
   /**
@@ -347,6 +373,18 @@ protected:
   /// flag indicating whether local (cell-wise) chopping of negative compositions is allowed
   integer m_allowCompDensChopping;
 
+  /// target (relative) change in pressure over a time step, used in state-based time step control
+  real64 m_targetRelativePresChange;
+
+  /// target (absolute) change in phase volume fraction over a time step, used in state-based time step control
+  real64 m_targetPhaseVolFracChange;
+
+  /// target (absolute) change in component fraction over a time step, used in state-based time step control
+  real64 m_targetCompFracChange;
+
+  /// target CFL number limiting the time step (disabled if not positive)
+  real64 m_targetFlowCFL;
+
   /// name of the fluid constitutive model used as a reference for component/phase description
   string m_referenceFluidModelName;
 
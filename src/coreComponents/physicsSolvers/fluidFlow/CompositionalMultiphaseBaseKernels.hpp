@@ -591,19 +591,171 @@ struct CapillaryPressureUpdateKernel
   }
 };
 
+/******************************** PhaseStateUpdateKernel ********************************/
+
+/**
+ * @struct NoOpCapPressureWrapper
+ * @brief Stand-in for the capillary pressure kernel wrapper when capillary pressure is not used
+ */
+struct NoOpCapPressureWrapper
+{
+  /**
+   * @brief Get the number of quadrature points
+   * @return zero, so that no update is performed
+   */
+  GEOSX_HOST_DEVICE
+  constexpr localIndex numGauss() const { return 0; }
+
+  /**
+   * @brief No-op update
+   */
+  template< typename ... Ts >
+  GEOSX_HOST_DEVICE
+  constexpr void update( Ts && ... ) const {}
+};
+
+/**
+ * @class PhaseStateUpdateKernel
+ * @tparam NUM_COMP number of fluid components
+ * @tparam NUM_PHASE number of fluid phases
+ * @tparam RELPERM_WRAPPER the type of the relative permeability kernel wrapper
+ * @tparam CAPPRES_WRAPPER the type of the capillary pressure kernel wrapper
+ * @brief Define the interface for the kernel updating, in a single pass over the elements, the phase volume
+ *   fractions, the relative permeabilities and the capillary pressures from the updated fluid properties
+ */
+template< integer NUM_COMP, integer NUM_PHASE, typename RELPERM_WRAPPER, typename CAPPRES_WRAPPER >
+class PhaseStateUpdateKernel : public PropertyKernelBase< NUM_COMP >
+{
+public:
+
+  using Base = PropertyKernelBase< NUM_COMP >;
+  using Base::numComp;
+
+  /// Compile time value for the number of phases
+  static constexpr integer numPhase = NUM_PHASE;
+
+  /**
+   * @brief Constructor
+   * @param[in] subRegion the element subregion
+   * @param[in] fluid the fluid model
+   * @param[in] relPermWrapper the kernel wrapper of the relative permeability model
+   * @param[in] capPresWrapper the kernel wrapper of the capillary pressure model
+   */
+  PhaseStateUpdateKernel( ObjectManagerBase & subRegion,
+                          MultiFluidBase const & fluid,
+                          RELPERM_WRAPPER const & relPermWrapper,
+                          CAPPRES_WRAPPER const & capPresWrapper )
+    : Base(),
+    m_phaseVolFractionKernel( subRegion, fluid ),
+    m_relPermWrapper( relPermWrapper ),
+    m_capPresWrapper( capPresWrapper ),
+    m_phaseVolFrac( subRegion.getExtrinsicData< extrinsicMeshData::flow::phaseVolumeFraction >() )
+  {}
+
+  /**
+   * @brief Update the phase state in an element
+   * @param[in] ei the element index
+   *
+   * The steps are performed in the same order as in the individual update sweeps,
+   * so the results are identical, but the element data is only brought into cache once.
+   */
+  GEOSX_HOST_DEVICE
+  void compute( localIndex const ei ) const
+  {
+    m_phaseVolFractionKernel.compute( ei );
+
+    for( localIndex q = 0; q < m_relPermWrapper.numGauss(); ++q )
+    {
+      m_relPermWrapper.update( ei, q, m_phaseVolFrac[ei] );
+    }
+    for( localIndex q = 0; q < m_capPresWrapper.numGauss(); ++q )
+    {
+      m_capPresWrapper.update( ei, q, m_phaseVolFrac[ei] );
+    }
+  }
+
+protected:
+
+  /// Kernel component reused for the phase volume fractions
+  PhaseVolumeFractionKernel< NUM_COMP, NUM_PHASE > const m_phaseVolFractionKernel;
+
+  /// Kernel wrappers of the constitutive models
+  RELPERM_WRAPPER const m_relPermWrapper;
+  CAPPRES_WRAPPER const m_capPresWrapper;
+
+  /// View on the phase volume fractions, written by the kernel component above
+  arrayView2d< real64 const, compflow::USD_PHASE > m_phaseVolFrac;
+
+};
+
+/**
+ * @class PhaseStateUpdateKernelFactory
+ */
+class PhaseStateUpdateKernelFactory
+{
+public:
+
+  /**
+   * @brief Create a new kernel and launch
+   * @tparam POLICY the policy used in the RAJA kernel
+   * @tparam RELPERM_WRAPPER the type of the relative permeability kernel wrapper
+   * @tparam CAPPRES_WRAPPER the type of the capillary pressure kernel wrapper
+   * @param[in] numComp the number of fluid components
+   * @param[in] numPhase the number of fluid phases
+   * @param[in] subRegion the element subregion
+   * @param[in] fluid the fluid model
+   * @param[in] relPermWrapper the kernel wrapper of the relative permeability model
+   * @param[in] capPresWrapper the kernel wrapper of the capillary pressure model
+   */
+  template< typename POLICY, typename RELPERM_WRAPPER, typename CAPPRES_WRAPPER >
+  static void
+  createAndLaunch( integer const numComp,
+                   integer const numPhase,
+                   ObjectManagerBase & subRegion,
+                   MultiFluidBase const & fluid,
+                   RELPERM_WRAPPER const & relPermWrapper,
+                   CAPPRES_WRAPPER const & capPresWrapper )
+  {
+    if( numPhase == 2 )
+    {
+      internal::kernelLaunchSelectorCompSwitch( numComp, [&] ( auto NC )
+      {
+        integer constexpr NUM_COMP = NC();
+        using KernelType = PhaseStateUpdateKernel< NUM_COMP, 2, RELPERM_WRAPPER, CAPPRES_WRAPPER >;
+        KernelType kernel( subRegion, fluid, relPermWrapper, capPresWrapper );
+        KernelType::template launch< POLICY >( subRegion.size(), kernel );
+      } );
+    }
+    else if( numPhase == 3 )
+    {
+      internal::kernelLaunchSelectorCompSwitch( numComp, [&] ( auto NC )
+      {
+        integer constexpr NUM_COMP = NC();
+        using KernelType = PhaseStateUpdateKernel< NUM_COMP, 3, RELPERM_WRAPPER, CAPPRES_WRAPPER >;
+        KernelType kernel( subRegion, fluid, relPermWrapper, capPresWrapper );
+        KernelType::template launch< POLICY >( subRegion.size(), kernel );
+      } );
+    }
+  }
+};
+
 /******************************** ElementBasedAssemblyKernel ********************************/
 
 /**
  * @class ElementBasedAssemblyKernel
  * @tparam NUM_COMP number of fluid components
  * @tparam NUM_DOF number of degrees of freedom
+ * @tparam RESIDUAL_ONLY if true, only the residual is assembled (no derivatives, no matrix scatter)
  * @brief Define the interface for the assembly kernel in charge of accumulation and volume balance
  */
-template< integer NUM_COMP, integer NUM_DOF >
+template< integer NUM_COMP, integer NUM_DOF, bool RESIDUAL_ONLY = false >
 class ElementBasedAssemblyKernel
 {
 public:
 
+  /// Compile time flag to skip the derivatives and the matrix scatter
+  static constexpr bool residualOnly = RESIDUAL_ONLY;
+
   /// Compile time value for the number of components
   static constexpr integer numComp = NUM_COMP;
 
@@ -789,6 +941,10 @@ public:
                                            + phaseAmountNew * dPhaseCompFrac_dPres[ip][ic];
 
         stack.localResidual[ic] += phaseCompAmountNew - phaseCompAmountOld;
+        if( residualOnly )
+        {
+          continue;
+        }
         stack.localJacobian[ic][0] += dPhaseCompAmount_dP;
 
         // jc - index of component w.r.t. whose compositional var the derivative is being taken
@@ -867,8 +1023,11 @@ public:
     using namespace compositionalMultiphaseUtilities;
 
     // apply equation/variable change transformation to the component mass balance equations
-    real64 work[numDof]{};
-    shiftRowsAheadByOneAndReplaceFirstRowWithColumnSum( numComp, numDof, stack.localJacobian, work );
+    if( !residualOnly )
+    {
+      real64 work[numDof]{};
+      shiftRowsAheadByOneAndReplaceFirstRowWithColumnSum( numComp, numDof, stack.localJacobian, work );
+    }
     shiftElementsAheadByOneAndReplaceFirstElementWithSum( numComp, stack.localResidual );
 
     // add contribution to residual and jacobian into:
@@ -877,10 +1036,13 @@ public:
     for( integer i = 0; i < numComp+1; ++i )
     {
       m_localRhs[stack.localRow + i] += stack.localResidual[i];
-      m_localMatrix.addToRow< serialAtomic >( stack.localRow + i,
-                                              stack.dofIndices,
-                                              stack.localJacobian[i],
-                                              numDof );
+      if( !residualOnly )
+      {
+        m_localMatrix.addToRow< serialAtomic >( stack.localRow + i,
+                                                stack.dofIndices,
+                                                stack.localJacobian[i],
+                                                numDof );
+      }
     }
   }
 
@@ -974,6 +1136,7 @@ public:
   /**
    * @brief Create a new kernel and launch
    * @tparam POLICY the policy used in the RAJA kernel
+   * @tparam RESIDUAL_ONLY if true, only the residual is assembled and the matrix is left untouched
    * @param[in] numComps the number of fluid components
    * @param[in] numPhases the number of fluid phases
    * @param[in] rankOffset the offset of my MPI rank
@@ -984,7 +1147,7 @@ public:
    * @param[inout] localMatrix the local CRS matrix
    * @param[inout] localRhs the local right-hand side vector
    */
-  template< typename POLICY >
+  template< typename POLICY, bool RESIDUAL_ONLY = false >
   static void
   createAndLaunch( integer const numComps,
                    integer const numPhases,
@@ -1000,9 +1163,9 @@ public:
     {
       integer constexpr NUM_COMP = NC();
       integer constexpr NUM_DOF = NC()+1;
-      ElementBasedAssemblyKernel< NUM_COMP, NUM_DOF >
+      ElementBasedAssemblyKernel< NUM_COMP, NUM_DOF, RESIDUAL_ONLY >
       kernel( numPhases, rankOffset, dofKey, subRegion, fluid, solid, localMatrix, localRhs );
-      ElementBasedAssemblyKernel< NUM_COMP, NUM_DOF >::template launch< POLICY >( subRegion.size(), kernel );
+      ElementBasedAssemblyKernel< NUM_COMP, NUM_DOF, RESIDUAL_ONLY >::template launch< POLICY >( subRegion.size(), kernel );
     } );
   }
 
@@ -1106,6 +1269,67 @@ struct SolutionCheckKernel
 
 };
 
+/******************************** StateChangeKernel ********************************/
+
+struct StateChangeKernel
+{
+  template< typename POLICY, typename REDUCE_POLICY >
+  static real64
+  launch( integer const numComponents,
+          integer const numPhases,
+          arrayView1d< integer const > const & ghostRank,
+          arrayView1d< real64 const > const & pres,
+          arrayView1d< real64 const > const & dPres,
+          arrayView2d< real64 const, compflow::USD_COMP > const & compDens,
+          arrayView2d< real64 const, compflow::USD_COMP > const & dCompDens,
+          arrayView2d< real64 const, compflow::USD_PHASE > const & phaseVolFrac,
+          arrayView2d< real64 const, compflow::USD_PHASE > const & phaseVolFracOld,
+          real64 const targetRelPresChange,
+          real64 const targetPhaseVolFracChange,
+          real64 const targetCompFracChange )
+  {
+    real64 constexpr eps = minDensForDivision;
+
+    RAJA::ReduceMax< REDUCE_POLICY, real64 > maxRatio( 0.0 );
+
+    forAll< POLICY >( ghostRank.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+    {
+      if( ghostRank[ei] < 0 )
+      {
+        // pressure change relative to the pressure at the beginning of the step
+        real64 const absPres = LvArray::math::abs( pres[ei] );
+        if( absPres > 0.0 )
+        {
+          maxRatio.max( LvArray::math::abs( dPres[ei] ) / ( absPres * targetRelPresChange ) );
+        }
+
+        for( integer ip = 0; ip < numPhases; ++ip )
+        {
+          maxRatio.max( LvArray::math::abs( phaseVolFrac[ei][ip] - phaseVolFracOld[ei][ip] ) / targetPhaseVolFracChange );
+        }
+
+        real64 totalDensOld = 0.0;
+        real64 totalDensNew = 0.0;
+        for( integer ic = 0; ic < numComponents; ++ic )
+        {
+          totalDensOld += compDens[ei][ic];
+          totalDensNew += compDens[ei][ic] + dCompDens[ei][ic];
+        }
+        if( totalDensOld > eps && totalDensNew > eps )
+        {
+          for( integer ic = 0; ic < numComponents; ++ic )
+          {
+            real64 const compFracChange = ( compDens[ei][ic] + dCompDens[ei][ic] ) / totalDensNew - compDens[ei][ic] / totalDensOld;
+            maxRatio.max( LvArray::math::abs( compFracChange ) / targetCompFracChange );
+          }
+        }
+      }
+    } );
+    return maxRatio.get();
+  }
+
+};
+
 /******************************** HydrostaticPressureKernel ********************************/
 
 struct HydrostaticPressureKernel
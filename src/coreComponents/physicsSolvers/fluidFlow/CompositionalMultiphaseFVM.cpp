@@ -49,9 +49,57 @@ using namespace compositionalMultiphaseBaseKernels;
 CompositionalMultiphaseFVM::CompositionalMultiphaseFVM( const string & name,
                                                         Group * const parent )
   :
-  CompositionalMultiphaseBase( name, parent )
+  CompositionalMultiphaseBase( name, parent ),
+  m_solutionScheme( SolutionScheme::FullyImplicit ),
+  m_transportCFL( 0.9 ),
+  m_maxTransportSubSteps( 100 ),
+  m_coloredAssembly( 0 )
 {
   m_linearSolverParameters.get().mgr.strategy = LinearSolverParameters::MGR::StrategyType::compositionalMultiphaseFVM;
+
+  this->registerWrapper( viewKeyStruct::solutionSchemeString(), &m_solutionScheme ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( m_solutionScheme ).
+    setDescription( "Coupling of the pressure and the transport of the components. Options are:\n* " +
+                    EnumStrings< SolutionScheme >::concat( "\n* " ) );
+
+  this->registerWrapper( viewKeyStruct::transportCFLString(), &m_transportCFL ).
+    setApplyDefaultValue( 0.9 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "CFL number of the explicit transport sub-steps of the IMPES scheme" );
+
+  this->registerWrapper( viewKeyStruct::maxTransportSubStepsString(), &m_maxTransportSubSteps ).
+    setApplyDefaultValue( 100 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Maximum number of explicit transport sub-steps in a time step of the IMPES scheme" );
+
+  this->registerWrapper( viewKeyStruct::coloredAssemblyString(), &m_coloredAssembly ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Flag to assemble the fluxes one color of connections at a time, where connections of the same color "
+                    "share no element, so that the residual and Jacobian are updated without atomic operations. "
+                    "A stencil that needs more than 64 colors is assembled with the default launch." );
+}
+
+void CompositionalMultiphaseFVM::postProcessInput()
+{
+  CompositionalMultiphaseBase::postProcessInput();
+
+  if( m_solutionScheme == SolutionScheme::IMPES )
+  {
+    GEOSX_ERROR_IF_LE_MSG( m_transportCFL, 0.0,
+                           viewKeyStruct::transportCFLString() << " must be positive" );
+    GEOSX_ERROR_IF_LT_MSG( m_maxTransportSubSteps, 1,
+                           viewKeyStruct::maxTransportSubStepsString() << " must be at least 1" );
+
+    NonlinearSolverParameters const & nonlinearParams = m_nonlinearSolverParameters;
+    GEOSX_ERROR_IF( nonlinearParams.m_jacobianFree || nonlinearParams.m_broydenUpdate ||
+                    nonlinearParams.m_nonlinearPreconditioner != NonlinearSolverParameters::NonlinearPreconditioner::None,
+                    getName() << ": the IMPES scheme requires Newton iterations with an assembled Jacobian" );
+
+    // the transport sub-steps are limited by the CFL numbers
+    m_computeCFLNumbers = 1;
+  }
 }
 
 void CompositionalMultiphaseFVM::initializePreSubGroups()
@@ -83,6 +131,63 @@ void CompositionalMultiphaseFVM::setupDofs( DomainPartition const & domain,
 }
 
 
+bool CompositionalMultiphaseFVM::assembleResidual( real64 const GEOSX_UNUSED_PARAM( time_n ),
+                                                  real64 const dt,
+                                                  DomainPartition & domain,
+                                                  DofManager const & dofManager,
+                                                  CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                                                  arrayView1d< real64 > const & localRhs )
+{
+  GEOSX_MARK_FUNCTION;
+
+  assembleAccumulationAndVolumeBalanceTerms( domain,
+                                             dofManager,
+                                             localMatrix,
+                                             localRhs,
+                                             true );
+
+  launchFluxAssembly( dt,
+                      domain,
+                      dofManager,
+                      localMatrix,
+                      localRhs,
+                      true );
+
+  // the matrix still holds the Jacobian of the last full assembly
+  return false;
+}
+
+void CompositionalMultiphaseFVM::setupSystem( DomainPartition & domain,
+                                              DofManager & dofManager,
+                                              CRSMatrix< real64, globalIndex > & localMatrix,
+                                              ParallelVector & rhs,
+                                              ParallelVector & solution,
+                                              bool const setSparsity )
+{
+  GEOSX_MARK_FUNCTION;
+
+  CompositionalMultiphaseBase::setupSystem( domain,
+                                            dofManager,
+                                            localMatrix,
+                                            rhs,
+                                            solution,
+                                            setSparsity );
+
+  // the sparsity pattern is fixed until the next call, precompute where the fluxes go in the matrix
+  computeConnectionSlots( domain,
+                          dofManager.getKey( viewKeyStruct::elemDofFieldString() ),
+                          dofManager.rankOffset(),
+                          localMatrix.toViewConst() );
+
+  // reuse the transmissibilities across the Newton iterations if the permeability is constant
+  updateCachedTransmissibilities( domain );
+
+  if( m_coloredAssembly )
+  {
+    computeConnectionColoring( domain );
+  }
+}
+
 void CompositionalMultiphaseFVM::assembleFluxTerms( real64 const dt,
                                                     DomainPartition const & domain,
                                                     DofManager const & dofManager,
@@ -91,6 +196,21 @@ void CompositionalMultiphaseFVM::assembleFluxTerms( real64 const dt,
 {
   GEOSX_MARK_FUNCTION;
 
+  launchFluxAssembly( dt,
+                      domain,
+                      dofManager,
+                      localMatrix,
+                      localRhs,
+                      false );
+}
+
+void CompositionalMultiphaseFVM::launchFluxAssembly( real64 const dt,
+                                                     DomainPartition const & domain,
+                                                     DofManager const & dofManager,
+                                                     CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                                                     arrayView1d< real64 > const & localRhs,
+                                                     bool const residualOnly ) const
+{
   forMeshTargets( domain.getMeshBodies(), [&]( string const &,
                                                MeshLevel const & mesh,
                                                arrayView1d< string const > const & )
@@ -108,18 +228,40 @@ void CompositionalMultiphaseFVM::assembleFluxTerms( real64 const dt,
     {
       typename TYPEOFREF( stencil ) ::StencilWrapper stencilWrapper = stencil.createStencilWrapper();
 
-      FaceBasedAssemblyKernelFactory::
-        createAndLaunch< parallelDevicePolicy<> >( m_numComponents,
-                                                   m_numPhases,
-                                                   dofManager.rankOffset(),
-                                                   elemDofKey,
-                                                   m_capPressureFlag,
-                                                   getName(),
-                                                   mesh.getElemManager(),
-                                                   stencilWrapper,
-                                                   dt,
-                                                   localMatrix.toViewConstSizes(),
-                                                   localRhs.toView() );
+      ConnectionColoring const * const coloring = getConnectionColoring( &stencil );
+      arrayView1d< localIndex const > const colorOffsets =
+        coloring != nullptr ? coloring->colorOffsets.toViewConst() : arrayView1d< localIndex const >();
+      arrayView1d< localIndex const > const connectionsByColor =
+        coloring != nullptr ? coloring->connectionsByColor.toViewConst() : arrayView1d< localIndex const >();
+
+      auto launchKernel = [&]( auto RO )
+      {
+        bool constexpr RESIDUAL_ONLY = RO();
+        FaceBasedAssemblyKernelFactory::
+          createAndLaunch< parallelDevicePolicy<>, RESIDUAL_ONLY >( m_numComponents,
+                                                                    m_numPhases,
+                                                                    dofManager.rankOffset(),
+                                                                    elemDofKey,
+                                                                    m_capPressureFlag,
+                                                                    getName(),
+                                                                    mesh.getElemManager(),
+                                                                    stencilWrapper,
+                                                                    dt,
+                                                                    localMatrix.toViewConstSizes(),
+                                                                    localRhs.toView(),
+                                                                    getConnectionSlots( &stencil, localMatrix ),
+                                                                    colorOffsets,
+                                                                    connectionsByColor );
+      };
+
+      if( residualOnly )
+      {
+        launchKernel( std::true_type{} );
+      }
+      else
+      {
+        launchKernel( std::false_type{} );
+      }
     } );
   } );
 }
@@ -128,16 +270,165 @@ void CompositionalMultiphaseFVM::implicitStepComplete( real64 const & time,
                                                        real64 const & dt,
                                                        DomainPartition & domain )
 {
+  if( m_solutionScheme == SolutionScheme::IMPES )
+  {
+    explicitTransportStep( time, dt, domain );
+  }
+
   CompositionalMultiphaseBase::implicitStepComplete( time, dt, domain );
 
-  if( m_computeCFLNumbers )
+  // with the IMPES scheme, the CFL numbers only limit the transport sub-steps
+  if( m_computeCFLNumbers && m_solutionScheme == SolutionScheme::FullyImplicit )
+  {
+    real64 const maxCFLNumber = computeCFLNumbers( dt, domain );
+
+    // the CFL number scales linearly with the time step size
+    if( m_targetFlowCFL > 0.0 && maxCFLNumber > 0.0 )
+    {
+      m_maxStableDt = dt * m_targetFlowCFL / maxCFLNumber;
+    }
+  }
+}
+
+void CompositionalMultiphaseFVM::explicitTransportStep( real64 const & time_n,
+                                                        real64 const & dt,
+                                                        DomainPartition & domain )
+{
+  GEOSX_MARK_FUNCTION;
+
+  integer const numComp = m_numComponents;
+  globalIndex const rankOffset = m_dofManager.rankOffset();
+  string const dofKey = m_dofManager.getKey( viewKeyStruct::elemDofFieldString() );
+
+  FieldSpecificationManager & fsManager = FieldSpecificationManager::getInstance();
+
+  // the component densities of the cells with Dirichlet conditions are not transported
+  auto const freezeDirichletCells = [&]()
+  {
+    fsManager.apply( time_n + dt,
+                     domain,
+                     "ElementRegions",
+                     extrinsicMeshData::flow::pressure::key(),
+                     [&]( FieldSpecificationBase const &,
+                          string const &,
+                          SortedArrayView< localIndex const > const & targetSet,
+                          Group & subRegion,
+                          string const & )
+    {
+      arrayView2d< real64, compflow::USD_COMP > const dCompDens =
+        subRegion.getReference< array2d< real64, compflow::LAYOUT_COMP > >( extrinsicMeshData::flow::deltaGlobalCompDensity::key() );
+      forAll< parallelDevicePolicy<> >( targetSet.size(), [=] GEOSX_HOST_DEVICE ( localIndex const i )
+      {
+        for( integer ic = 0; ic < numComp; ++ic )
+        {
+          dCompDens[targetSet[i]][ic] = 0.0;
+        }
+      } );
+    } );
+  };
+
+  auto const synchronizeAndUpdateState = [&]()
   {
-    computeCFLNumbers( dt, domain );
+    forMeshTargets( domain.getMeshBodies(), [&]( string const &,
+                                                 MeshLevel & mesh,
+                                                 arrayView1d< string const > const & )
+    {
+      std::map< string, string_array > fieldNames;
+      fieldNames["elems"].emplace_back( extrinsicMeshData::flow::deltaGlobalCompDensity::key() );
+      CommunicationTools::getInstance().synchronizeFields( fieldNames, mesh, domain.getNeighbors(), true );
+    } );
+    updateState( domain );
+  };
+
+  // Step 1: express the component masses at the beginning of the step in the pore volume of the converged pressure
+  forMeshTargets( domain.getMeshBodies(), [&]( string const &,
+                                               MeshLevel & mesh,
+                                               arrayView1d< string const > const & regionNames )
+  {
+    mesh.getElemManager().forElementSubRegions( regionNames,
+                                                [&]( localIndex const,
+                                                     ElementSubRegionBase & subRegion )
+    {
+      string const & solidName = subRegion.getReference< string >( viewKeyStruct::solidNamesString() );
+      CoupledSolidBase const & solidModel = getConstitutiveModel< CoupledSolidBase >( subRegion, solidName );
+
+      IMPESKernel::startTransport< parallelDevicePolicy<> >( numComp,
+                                                            subRegion.ghostRank(),
+                                                            solidModel.getOldPorosity(),
+                                                            solidModel.getPorosity(),
+                                                            subRegion.getExtrinsicData< extrinsicMeshData::flow::globalCompDensity >(),
+                                                            subRegion.getExtrinsicData< extrinsicMeshData::flow::deltaGlobalCompDensity >() );
+    } );
+  } );
+  freezeDirichletCells();
+  synchronizeAndUpdateState();
+
+  // Step 2: advance the component densities with the fluxes of the current state, at the largest stable sub-step
+
+  array1d< real64 > localFlux( m_localMatrix.numRows() );
+  real64 time = 0.0;
+  integer numSubSteps = 0;
+  while( time < dt * ( 1.0 - 1e-12 ) )
+  {
+    real64 const maxCFLNumber = computeCFLNumbers( dt, domain );
+    real64 subDt = dt - time;
+    if( maxCFLNumber > 0.0 )
+    {
+      subDt = LvArray::math::min( subDt, dt * m_transportCFL / maxCFLNumber );
+    }
+    if( numSubSteps + 1 >= m_maxTransportSubSteps && subDt < dt - time )
+    {
+      GEOSX_WARNING( getName() << ": the maximum number of transport sub-steps is reached, "
+                               << "the last sub-step exceeds the target CFL number" );
+      subDt = dt - time;
+    }
+
+    localFlux.zero();
+    launchFluxAssembly( subDt,
+                        domain,
+                        m_dofManager,
+                        m_localMatrix.toViewConstSizes(),
+                        localFlux.toView(),
+                        true );
+
+    forMeshTargets( domain.getMeshBodies(), [&]( string const &,
+                                                 MeshLevel & mesh,
+                                                 arrayView1d< string const > const & regionNames )
+    {
+      mesh.getElemManager().forElementSubRegions( regionNames,
+                                                  [&]( localIndex const,
+                                                       ElementSubRegionBase & subRegion )
+      {
+        string const & solidName = subRegion.getReference< string >( viewKeyStruct::solidNamesString() );
+        CoupledSolidBase const & solidModel = getConstitutiveModel< CoupledSolidBase >( subRegion, solidName );
+
+        IMPESKernel::transportUpdate< parallelDevicePolicy<> >( numComp,
+                                                               localFlux.toViewConst(),
+                                                               rankOffset,
+                                                               subRegion.getReference< array1d< globalIndex > >( dofKey ),
+                                                               subRegion.ghostRank(),
+                                                               subRegion.getElementVolume(),
+                                                               solidModel.getPorosity(),
+                                                               subRegion.getExtrinsicData< extrinsicMeshData::flow::deltaGlobalCompDensity >() );
+      } );
+    } );
+
+    if( m_allowCompDensChopping )
+    {
+      chopNegativeDensities( domain );
+    }
+    freezeDirichletCells();
+    synchronizeAndUpdateState();
+
+    time += subDt;
+    ++numSubSteps;
   }
+
+  GEOSX_LOG_LEVEL_RANK_0( 1, getName() << ": " << numSubSteps << " explicit transport sub-steps" );
 }
 
-void CompositionalMultiphaseFVM::computeCFLNumbers( real64 const & dt,
-                                                    DomainPartition & domain )
+real64 CompositionalMultiphaseFVM::computeCFLNumbers( real64 const & dt,
+                                                      DomainPartition & domain )
 {
   GEOSX_MARK_FUNCTION;
 
@@ -276,6 +567,53 @@ void CompositionalMultiphaseFVM::computeCFLNumbers( real64 const & dt,
 
   GEOSX_LOG_LEVEL_RANK_0( 1, getName() << ": Max phase CFL number: " << globalMaxPhaseCFLNumber );
   GEOSX_LOG_LEVEL_RANK_0( 1, getName() << ": Max component CFL number: " << globalMaxCompCFLNumber );
+
+  return LvArray::math::max( globalMaxPhaseCFLNumber, globalMaxCompCFLNumber );
+}
+
+void CompositionalMultiphaseFVM::applyBoundaryConditions( real64 const time_n,
+                                                          real64 const dt,
+                                                          DomainPartition & domain,
+                                                          DofManager const & dofManager,
+                                                          CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                                                          arrayView1d< real64 > const & localRhs )
+{
+  CompositionalMultiphaseBase::applyBoundaryConditions( time_n, dt, domain, dofManager, localMatrix, localRhs );
+
+  // the weights are computed from the Jacobian that is about to be solved, so that they are never stale
+  if( m_solutionScheme == SolutionScheme::IMPES )
+  {
+    computePressureWeights( domain, dofManager, localMatrix.toViewConst() );
+  }
+}
+
+void CompositionalMultiphaseFVM::computePressureWeights( DomainPartition const & domain,
+                                                         DofManager const & dofManager,
+                                                         CRSMatrixView< real64 const, globalIndex const > const & localMatrix )
+{
+  GEOSX_MARK_FUNCTION;
+
+  globalIndex const rankOffset = dofManager.rankOffset();
+  string const dofKey = dofManager.getKey( viewKeyStruct::elemDofFieldString() );
+
+  m_pressureWeights.resizeWithoutInitializationOrDestruction( localMatrix.numRows() );
+
+  forMeshTargets( domain.getMeshBodies(), [&]( string const &,
+                                               MeshLevel const & mesh,
+                                               arrayView1d< string const > const & regionNames )
+  {
+    mesh.getElemManager().forElementSubRegions( regionNames,
+                                                [&]( localIndex const,
+                                                     ElementSubRegionBase const & subRegion )
+    {
+      IMPESKernel::launchPressureWeights< parallelDevicePolicy<> >( m_numComponents,
+                                                                    rankOffset,
+                                                                    subRegion.getReference< array1d< globalIndex > >( dofKey ),
+                                                                    subRegion.ghostRank(),
+                                                                    localMatrix,
+                                                                    m_pressureWeights.toView() );
+    } );
+  } );
 }
 
 real64 CompositionalMultiphaseFVM::calculateResidualNorm( DomainPartition const & domain,
@@ -308,6 +646,25 @@ real64 CompositionalMultiphaseFVM::calculateResidualNorm( DomainPartition const
       arrayView1d< real64 const > const & referencePorosity = solidModel.getReferencePorosity();
 
       real64 subRegionResidualNorm = 0.0;
+      if( m_solutionScheme == SolutionScheme::IMPES )
+      {
+        arrayView1d< real64 const > const & pres = subRegion.getExtrinsicData< extrinsicMeshData::flow::pressure >();
+        arrayView1d< real64 const > const & dPres = subRegion.getExtrinsicData< extrinsicMeshData::flow::deltaPressure >();
+
+        IMPESKernel::pressureResidualNorm< parallelDevicePolicy<>,
+                                           parallelDeviceReduce >( m_numComponents,
+                                                                   localRhs,
+                                                                   rankOffset,
+                                                                   dofNumber,
+                                                                   elemGhostRank,
+                                                                   m_pressureWeights.toViewConst(),
+                                                                   pres,
+                                                                   dPres,
+                                                                   subRegionResidualNorm );
+        localResidualNorm += subRegionResidualNorm;
+        return;
+      }
+
       ResidualNormKernel::launch< parallelDevicePolicy<>,
                                   parallelDeviceReduce >( localRhs,
                                                           rankOffset,
@@ -333,6 +690,136 @@ real64 CompositionalMultiphaseFVM::calculateResidualNorm( DomainPartition const
   return residual;
 }
 
+void CompositionalMultiphaseFVM::solveSystem( DofManager const & dofManager,
+                                              ParallelMatrix & matrix,
+                                              ParallelVector & rhs,
+                                              ParallelVector & solution )
+{
+  if( m_solutionScheme == SolutionScheme::FullyImplicit )
+  {
+    CompositionalMultiphaseBase::solveSystem( dofManager, matrix, rhs, solution );
+    return;
+  }
+
+  GEOSX_MARK_FUNCTION;
+
+  rhs.scale( -1.0 );
+  solution.zero();
+
+  solvePressureSystem( dofManager, rhs, solution );
+}
+
+void CompositionalMultiphaseFVM::solvePressureSystem( DofManager const & dofManager,
+                                                      ParallelVector const & rhs,
+                                                      ParallelVector & solution )
+{
+  GEOSX_MARK_FUNCTION;
+
+  localIndex const numDofPerCell = m_numDofPerCell;
+  globalIndex const rankOffset = dofManager.rankOffset();
+  localIndex const numLocalCells = m_localMatrix.numRows() / numDofPerCell;
+
+  // the pressure of a cell is numbered after its first dof, which requires the cell dofs to be the only dofs
+  GEOSX_ERROR_IF( rankOffset % numDofPerCell != 0 || dofManager.numGlobalDofs() % numDofPerCell != 0,
+                  getName() << ": the IMPES scheme is only available when the flow solver is not coupled to other solvers" );
+
+  m_localMatrix.move( LvArray::MemorySpace::host, false );
+  CRSMatrixView< real64 const, globalIndex const > const localMatrix = m_localMatrix.toViewConst();
+  m_pressureWeights.move( LvArray::MemorySpace::host, false );
+  arrayView1d< real64 const > const pressureWeights = m_pressureWeights.toViewConst();
+
+  // Step 1: combine the rows of each cell, keeping the pressure columns only
+
+  array1d< localIndex > rowLengths( numLocalCells );
+  for( localIndex cell = 0; cell < numLocalCells; ++cell )
+  {
+    rowLengths[cell] = localMatrix.numNonZeros( cell * numDofPerCell ) / numDofPerCell;
+  }
+
+  SparsityPattern< globalIndex > pattern;
+  pattern.resizeFromRowCapacities< parallelHostPolicy >( numLocalCells,
+                                                         dofManager.numGlobalDofs() / numDofPerCell,
+                                                         rowLengths.data() );
+  for( localIndex cell = 0; cell < numLocalCells; ++cell )
+  {
+    for( globalIndex const col : localMatrix.getColumns( cell * numDofPerCell ) )
+    {
+      if( col % numDofPerCell == 0 )
+      {
+        pattern.insertNonZero( cell, col / numDofPerCell );
+      }
+    }
+  }
+
+  CRSMatrix< real64, globalIndex > pressureMatrix;
+  pressureMatrix.assimilate< parallelHostPolicy >( std::move( pattern ) );
+  for( localIndex cell = 0; cell < numLocalCells; ++cell )
+  {
+    for( localIndex idof = 0; idof < numDofPerCell; ++idof )
+    {
+      localIndex const row = cell * numDofPerCell + idof;
+      arraySlice1d< globalIndex const > const cols = localMatrix.getColumns( row );
+      arraySlice1d< real64 const > const vals = localMatrix.getEntries( row );
+      for( localIndex k = 0; k < cols.size(); ++k )
+      {
+        if( cols[k] % numDofPerCell == 0 )
+        {
+          globalIndex const col = cols[k] / numDofPerCell;
+          real64 const value = pressureWeights[row] * vals[k];
+          pressureMatrix.addToRowBinarySearchUnsorted< serialAtomic >( cell, &col, &value, 1 );
+        }
+      }
+    }
+  }
+
+  m_pressureMatrix.create( pressureMatrix.toViewConst(), numLocalCells, MPI_COMM_GEOSX );
+
+  ParallelVector pressureRhs;
+  ParallelVector pressureSolution;
+  pressureRhs.create( numLocalCells, MPI_COMM_GEOSX );
+  pressureSolution.create( numLocalCells, MPI_COMM_GEOSX );
+
+  arrayView1d< real64 const > const localRhs = rhs.values();
+  arrayView1d< real64 > const localPressureRhs = pressureRhs.open();
+  forAll< parallelHostPolicy >( numLocalCells, [=] ( localIndex const cell )
+  {
+    real64 value = 0.0;
+    for( localIndex idof = 0; idof < numDofPerCell; ++idof )
+    {
+      localIndex const row = cell * numDofPerCell + idof;
+      value += pressureWeights[row] * localRhs[row];
+    }
+    localPressureRhs[cell] = value;
+  } );
+  pressureRhs.close();
+
+  // Step 2: solve for the pressure updates, with a preconditioner suited to a scalar equation
+
+  if( !m_pressureSolver )
+  {
+    LinearSolverParameters params = m_linearSolverParameters.get();
+    if( params.preconditionerType == LinearSolverParameters::PreconditionerType::mgr )
+    {
+      params.preconditionerType = LinearSolverParameters::PreconditionerType::amg;
+    }
+    params.dofsPerNode = 1;
+    m_pressureSolver = LAInterface::createSolver( params );
+  }
+  m_pressureSolver->setup( m_pressureMatrix );
+  m_pressureSolver->solve( pressureRhs, pressureSolution );
+  m_linearSolverResult = m_pressureSolver->result();
+
+  // Step 3: scatter the pressure updates, the component densities are advanced by the transport sub-steps
+
+  arrayView1d< real64 const > const localPressureSolution = pressureSolution.values();
+  arrayView1d< real64 > const localSolution = solution.open();
+  forAll< parallelHostPolicy >( numLocalCells, [=] ( localIndex const cell )
+  {
+    localSolution[cell * numDofPerCell] = localPressureSolution[cell];
+  } );
+  solution.close();
+}
+
 real64 CompositionalMultiphaseFVM::scalingForSystemSolution( DomainPartition const & domain,
                                                              DofManager const & dofManager,
                                                              arrayView1d< real64 const > const & localSolution )
@@ -504,6 +991,24 @@ void CompositionalMultiphaseFVM::applySystemSolution( DofManager const & dofMana
   } );
 }
 
+void CompositionalMultiphaseFVM::forSystemSolutionFields( DomainPartition & domain,
+                                                          std::function< void ( dataRepository::WrapperBase & ) > const & func )
+{
+  std::map< string, string_array > fieldNames;
+  fieldNames["elems"].emplace_back( string( extrinsicMeshData::flow::deltaPressure::key() ) );
+  fieldNames["elems"].emplace_back( string( extrinsicMeshData::flow::deltaGlobalCompDensity::key() ) );
+  forFieldsOnMeshTargets( domain, fieldNames, func );
+}
+
+void CompositionalMultiphaseFVM::forPrimaryVariableFields( DomainPartition & domain,
+                                                           std::function< void ( ObjectManagerBase &, dataRepository::WrapperBase & ) > const & func )
+{
+  std::map< string, string_array > fieldNames;
+  fieldNames["elems"].emplace_back( string( extrinsicMeshData::flow::pressure::key() ) );
+  fieldNames["elems"].emplace_back( string( extrinsicMeshData::flow::globalCompDensity::key() ) );
+  forFieldsOnMeshTargets( domain, fieldNames, func );
+}
+
 void CompositionalMultiphaseFVM::updatePhaseMobility( ObjectManagerBase & dataGroup ) const
 {
   GEOSX_MARK_FUNCTION;
@@ -37,6 +37,17 @@ class CompositionalMultiphaseFVM : public CompositionalMultiphaseBase
 //END_SPHINX_INCLUDE_00
 public:
 
+  /**
+   * @enum SolutionScheme
+   *
+   * The options for the coupling of the pressure and the transport of the components
+   */
+  enum class SolutionScheme : integer
+  {
+    FullyImplicit, ///< Pressure and component densities are solved simultaneously
+    IMPES          ///< Implicit pressure, followed by explicit sub-steps for the component densities
+  };
+
   /**
    * @brief main constructor for Group Objects
    * @param name the name of this instantiation of Group in the repository
@@ -84,11 +95,25 @@ public:
   setupDofs( DomainPartition const & domain,
              DofManager & dofManager ) const override;
 
+  virtual void
+  setupSystem( DomainPartition & domain,
+               DofManager & dofManager,
+               CRSMatrix< real64, globalIndex > & localMatrix,
+               ParallelVector & rhs,
+               ParallelVector & solution,
+               bool const setSparsity = true ) override;
+
   virtual real64
   calculateResidualNorm( DomainPartition const & domain,
                          DofManager const & dofManager,
                          arrayView1d< real64 const > const & localRhs ) override;
 
+  virtual void
+  solveSystem( DofManager const & dofManager,
+               ParallelMatrix & matrix,
+               ParallelVector & rhs,
+               ParallelVector & solution ) override;
+
   virtual real64
   scalingForSystemSolution( DomainPartition const & domain,
                             DofManager const & dofManager,
@@ -106,6 +131,14 @@ public:
                        real64 const scalingFactor,
                        DomainPartition & domain ) override;
 
+  virtual void
+  forSystemSolutionFields( DomainPartition & domain,
+                           std::function< void ( dataRepository::WrapperBase & ) > const & func ) override;
+
+  virtual void
+  forPrimaryVariableFields( DomainPartition & domain,
+                            std::function< void ( ObjectManagerBase &, dataRepository::WrapperBase & ) > const & func ) override;
+
   virtual void
   implicitStepComplete( real64 const & time,
                         real64 const & dt,
@@ -114,6 +147,22 @@ public:
 
   /**@}*/
 
+  virtual void
+  applyBoundaryConditions( real64 const time_n,
+                           real64 const dt,
+                           DomainPartition & domain,
+                           DofManager const & dofManager,
+                           CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                           arrayView1d< real64 > const & localRhs ) override;
+
+  virtual bool
+  assembleResidual( real64 const time_n,
+                    real64 const dt,
+                    DomainPartition & domain,
+                    DofManager const & dofManager,
+                    CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                    arrayView1d< real64 > const & localRhs ) override;
+
   virtual void
   assembleFluxTerms( real64 const dt,
                      DomainPartition const & domain,
@@ -138,19 +187,102 @@ public:
    * @brief Compute the largest CFL number in the domain
    * @param dt the time step size
    * @param domain the domain containing the mesh and fields
+   * @return the largest phase or component CFL number
    */
-  void
+  real64
   computeCFLNumbers( real64 const & dt, DomainPartition & domain );
 
 
   virtual void initializePreSubGroups() override;
 
+  struct viewKeyStruct : CompositionalMultiphaseBase::viewKeyStruct
+  {
+    static constexpr char const * solutionSchemeString() { return "solutionScheme"; }
+    static constexpr char const * transportCFLString() { return "transportCFL"; }
+    static constexpr char const * maxTransportSubStepsString() { return "maxTransportSubSteps"; }
+    static constexpr char const * coloredAssemblyString() { return "coloredAssembly"; }
+  };
+
+protected:
+
+  virtual void postProcessInput() override;
+
 private:
 
-  // no data needed here, see CompositionalMultiphaseBase
+  /**
+   * @brief Compute the weights combining the equations of each cell into a pressure equation (IMPES scheme)
+   * @param domain the physical domain object
+   * @param dofManager degree-of-freedom manager associated with the linear system
+   * @param localMatrix the Jacobian of the fully implicit system, with the boundary conditions applied
+   */
+  void computePressureWeights( DomainPartition const & domain,
+                               DofManager const & dofManager,
+                               CRSMatrixView< real64 const, globalIndex const > const & localMatrix );
+
+  /**
+   * @brief Solve the pressure equations obtained by combining the equations of each cell (IMPES scheme)
+   * @param dofManager degree-of-freedom manager associated with the linear system
+   * @param rhs the right-hand side of the fully implicit system
+   * @param solution the solution of the fully implicit system, with zero component density updates
+   */
+  void solvePressureSystem( DofManager const & dofManager,
+                            ParallelVector const & rhs,
+                            ParallelVector & solution );
+
+  /**
+   * @brief Advance the component densities with explicit, CFL-limited sub-steps at the converged pressure (IMPES scheme)
+   * @param time_n the time at the beginning of the step
+   * @param dt the time step size
+   * @param domain the physical domain object
+   */
+  void explicitTransportStep( real64 const & time_n,
+                              real64 const & dt,
+                              DomainPartition & domain );
+
+
+  /**
+   * @brief launches the flux kernels on all the stencils
+   * @param dt time step
+   * @param domain the physical domain object
+   * @param dofManager degree-of-freedom manager associated with the linear system
+   * @param localMatrix the system matrix
+   * @param localRhs the system right-hand side vector
+   * @param residualOnly if true, the derivatives are skipped and the matrix is left untouched
+   */
+  void launchFluxAssembly( real64 const dt,
+                           DomainPartition const & domain,
+                           DofManager const & dofManager,
+                           CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                           arrayView1d< real64 > const & localRhs,
+                           bool const residualOnly ) const;
+
+  /// the coupling of the pressure and the transport of the components
+  SolutionScheme m_solutionScheme;
+
+  /// the CFL number of the explicit transport sub-steps
+  real64 m_transportCFL;
+
+  /// the maximum number of explicit transport sub-steps in a time step
+  integer m_maxTransportSubSteps;
+
+  /// flag to assemble the fluxes one color of connections at a time, without atomic operations
+  integer m_coloredAssembly;
+
+  /// the weights combining the equations of each cell into a pressure equation
+  array1d< real64 > m_pressureWeights;
+
+  /// the matrix of the pressure equations
+  ParallelMatrix m_pressureMatrix;
+
+  /// the linear solver of the pressure equations, kept alive across solves
+  std::unique_ptr< LinearSolverBase< LAInterface > > m_pressureSolver;
 
 };
 
+ENUM_STRINGS( CompositionalMultiphaseFVM::SolutionScheme,
+              "FullyImplicit",
+              "IMPES" );
+
 
 } // namespace geosx
 
@@ -30,6 +30,7 @@
 #include "constitutive/relativePermeability/RelativePermeabilityBase.hpp"
 #include "constitutive/relativePermeability/RelativePermeabilityExtrinsicData.hpp"
 #include "fieldSpecification/AquiferBoundaryCondition.hpp"
+#include "linearAlgebra/interfaces/dense/BatchedDenseLA.hpp"
 #include "finiteVolume/BoundaryStencil.hpp"
 #include "mesh/ElementRegionManager.hpp"
 #include "mesh/utilities/MeshMapUtilities.hpp"
@@ -37,6 +38,7 @@
 #include "physicsSolvers/fluidFlow/CompositionalMultiphaseBaseExtrinsicData.hpp"
 #include "physicsSolvers/fluidFlow/CompositionalMultiphaseBaseKernels.hpp"
 #include "physicsSolvers/fluidFlow/CompositionalMultiphaseUtilities.hpp"
+#include "physicsSolvers/fluidFlow/FluxKernelsHelper.hpp"
 #include "physicsSolvers/fluidFlow/StencilAccessors.hpp"
 
 namespace geosx
@@ -408,13 +410,17 @@ protected:
  * @tparam NUM_COMP number of fluid components
  * @tparam NUM_DOF number of degrees of freedom
  * @tparam STENCILWRAPPER the type of the stencil wrapper
+ * @tparam RESIDUAL_ONLY if true, only the flux residual is assembled (no derivatives, no matrix scatter)
  * @brief Define the interface for the assembly kernel in charge of flux terms
  */
-template< integer NUM_COMP, integer NUM_DOF, typename STENCILWRAPPER >
+template< integer NUM_COMP, integer NUM_DOF, typename STENCILWRAPPER, bool RESIDUAL_ONLY = false >
 class FaceBasedAssemblyKernel : public FaceBasedAssemblyKernelBase
 {
 public:
 
+  /// Compile time flag to skip the derivatives and the matrix scatter
+  static constexpr bool residualOnly = RESIDUAL_ONLY;
+
   /// Compile time value for the number of components
   static constexpr integer numComp = NUM_COMP;
 
@@ -447,6 +453,7 @@ public:
    * @param[in] dt time step size
    * @param[inout] localMatrix the local CRS matrix
    * @param[inout] localRhs the local right-hand side vector
+   * @param[in] connectionSlots the positions of the flux Jacobian entries in the local matrix (empty to search the columns)
    */
   FaceBasedAssemblyKernel( integer const numPhases,
                            globalIndex const rankOffset,
@@ -459,7 +466,8 @@ public:
                            PermeabilityAccessors const & permeabilityAccessors,
                            real64 const & dt,
                            CRSMatrixView< real64, globalIndex const > const & localMatrix,
-                           arrayView1d< real64 > const & localRhs )
+                           arrayView1d< real64 > const & localRhs,
+                           arrayView3d< localIndex const > const & connectionSlots = arrayView3d< localIndex const >() )
     : FaceBasedAssemblyKernelBase( numPhases,
                                    rankOffset,
                                    capPressureFlag,
@@ -474,7 +482,8 @@ public:
     m_stencilWrapper( stencilWrapper ),
     m_seri( stencilWrapper.getElementRegionIndices() ),
     m_sesri( stencilWrapper.getElementSubRegionIndices() ),
-    m_sei( stencilWrapper.getElementIndices() )
+    m_sei( stencilWrapper.getElementIndices() ),
+    m_connectionSlots( connectionSlots )
   {}
 
   /**
@@ -791,6 +800,11 @@ public:
         real64 const ycp = phaseCompFracSub[ic];
         stack.compFlux[ic] += phaseFlux * ycp;
 
+        if( residualOnly )
+        {
+          continue;
+        }
+
         // derivatives stemming from phase flux
         for( integer ke = 0; ke < stack.stencilSize; ++ke )
         {
@@ -830,6 +844,11 @@ public:
       stack.localFlux[ic]           =  m_dt * stack.compFlux[ic];
       stack.localFlux[numComp + ic] = -m_dt * stack.compFlux[ic];
 
+      if( residualOnly )
+      {
+        continue;
+      }
+
       for( integer ke = 0; ke < stack.stencilSize; ++ke )
       {
         localIndex const localDofIndexPres = ke * numDof;
@@ -855,9 +874,11 @@ public:
 
   /**
    * @brief Performs the complete phase for the kernel.
+   * @tparam ATOMIC_POLICY the atomic policy used to add to the residual/jacobian
    * @param[in] iconn the connection index
    * @param[inout] stack the stack variables
    */
+  template< typename ATOMIC_POLICY = parallelDeviceAtomic >
   GEOSX_HOST_DEVICE
   void complete( localIndex const iconn,
                  StackVariables & stack ) const
@@ -865,9 +886,12 @@ public:
     using namespace compositionalMultiphaseUtilities;
 
     // Apply equation/variable change transformation(s)
-    stackArray1d< real64, maxStencilSize * numDof > work( stack.stencilSize * numDof );
-    shiftBlockRowsAheadByOneAndReplaceFirstRowWithColumnSum( numComp, numDof*stack.stencilSize, stack.numFluxElems,
-                                                             stack.localFluxJacobian, work );
+    if( !residualOnly )
+    {
+      stackArray1d< real64, maxStencilSize * numDof > work( stack.stencilSize * numDof );
+      shiftBlockRowsAheadByOneAndReplaceFirstRowWithColumnSum( numComp, numDof*stack.stencilSize, stack.numFluxElems,
+                                                               stack.localFluxJacobian, work );
+    }
     shiftBlockElementsAheadByOneAndReplaceFirstElementWithSum( numComp, stack.numFluxElems,
                                                                stack.localFlux );
 
@@ -883,12 +907,27 @@ public:
 
         for( integer ic = 0; ic < numComp; ++ic )
         {
-          RAJA::atomicAdd( parallelDeviceAtomic{}, &m_localRhs[localRow + ic], stack.localFlux[i * numComp + ic] );
-          m_localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >
-            ( localRow + ic,
-            stack.dofColIndices.data(),
-            stack.localFluxJacobian[i * numComp + ic].dataIfContiguous(),
-            stack.stencilSize * numDof );
+          RAJA::atomicAdd( ATOMIC_POLICY{}, &m_localRhs[localRow + ic], stack.localFlux[i * numComp + ic] );
+          if( !residualOnly )
+          {
+            if( m_connectionSlots.size() > 0 )
+            {
+              fluxKernelsHelper::addToRowAtSlots< ATOMIC_POLICY >( m_localMatrix,
+                                                                   localRow + ic,
+                                                                   m_connectionSlots[iconn][i],
+                                                                   stack.stencilSize,
+                                                                   numDof,
+                                                                   stack.localFluxJacobian[i * numComp + ic].dataIfContiguous() );
+            }
+            else
+            {
+              m_localMatrix.addToRowBinarySearchUnsorted< ATOMIC_POLICY >
+                ( localRow + ic,
+                stack.dofColIndices.data(),
+                stack.localFluxJacobian[i * numComp + ic].dataIfContiguous(),
+                stack.stencilSize * numDof );
+            }
+          }
         }
       }
     }
@@ -919,6 +958,41 @@ public:
     } );
   }
 
+  /**
+   * @brief Performs the kernel launch one color at a time
+   * @tparam POLICY the policy used in the RAJA kernels
+   * @tparam KERNEL_TYPE the kernel type
+   * @param[in] colorOffsets the offsets of each color in @p connectionsByColor
+   * @param[in] connectionsByColor the connections sorted by color
+   * @param[inout] kernelComponent the kernel component providing access to setup/compute/complete functions and stack variables
+   *
+   * Two connections of the same color do not share a flux element, so they never write to the same
+   * rows of the residual/jacobian and the contributions are added without atomic operations.
+   */
+  template< typename POLICY, typename KERNEL_TYPE >
+  static void
+  launchColored( arrayView1d< localIndex const > const & colorOffsets,
+                 arrayView1d< localIndex const > const & connectionsByColor,
+                 KERNEL_TYPE const & kernelComponent )
+  {
+    GEOSX_MARK_FUNCTION;
+
+    for( localIndex color = 0; color < colorOffsets.size() - 1; ++color )
+    {
+      localIndex const firstConn = colorOffsets[color];
+      forAll< POLICY >( colorOffsets[color + 1] - firstConn, [=] GEOSX_HOST_DEVICE ( localIndex const k )
+      {
+        localIndex const iconn = connectionsByColor[firstConn + k];
+        typename KERNEL_TYPE::StackVariables stack( kernelComponent.stencilSize( iconn ),
+                                                    kernelComponent.numPointsInFlux( iconn ) );
+
+        kernelComponent.setup( iconn, stack );
+        kernelComponent.computeFlux( iconn, stack );
+        kernelComponent.template complete< serialAtomic >( iconn, stack );
+      } );
+    }
+  }
+
 private:
 
   // Stencil information
@@ -930,6 +1004,9 @@ private:
   typename STENCILWRAPPER::IndexContainerViewConstType const m_seri;
   typename STENCILWRAPPER::IndexContainerViewConstType const m_sesri;
   typename STENCILWRAPPER::IndexContainerViewConstType const m_sei;
+
+  /// Positions of the flux Jacobian entries in the rows of the local matrix (empty if not available)
+  arrayView3d< localIndex const > const m_connectionSlots;
 };
 
 /**
@@ -942,6 +1019,7 @@ public:
   /**
    * @brief Create a new kernel and launch
    * @tparam POLICY the policy used in the RAJA kernel
+   * @tparam RESIDUAL_ONLY if true, only the residual is assembled and the matrix is left untouched
    * @tparam STENCILWRAPPER the type of the stencil wrapper
    * @param[in] numComps the number of fluid components
    * @param[in] numPhases the number of fluid phases
@@ -954,8 +1032,11 @@ public:
    * @param[in] dt time step size
    * @param[inout] localMatrix the local CRS matrix
    * @param[inout] localRhs the local right-hand side vector
+   * @param[in] connectionSlots the positions of the flux Jacobian entries in the local matrix (empty to search the columns)
+   * @param[in] colorOffsets the offsets of each color in @p connectionsByColor (empty to launch without coloring)
+   * @param[in] connectionsByColor the connections sorted by color
    */
-  template< typename POLICY, typename STENCILWRAPPER >
+  template< typename POLICY, bool RESIDUAL_ONLY = false, typename STENCILWRAPPER >
   static void
   createAndLaunch( integer const numComps,
                    integer const numPhases,
@@ -967,7 +1048,10 @@ public:
                    STENCILWRAPPER const & stencilWrapper,
                    real64 const & dt,
                    CRSMatrixView< real64, globalIndex const > const & localMatrix,
-                   arrayView1d< real64 > const & localRhs )
+                   arrayView1d< real64 > const & localRhs,
+                   arrayView3d< localIndex const > const & connectionSlots = arrayView3d< localIndex const >(),
+                   arrayView1d< localIndex const > const & colorOffsets = arrayView1d< localIndex const >(),
+                   arrayView1d< localIndex const > const & connectionsByColor = arrayView1d< localIndex const >() )
   {
     compositionalMultiphaseBaseKernels::internal::kernelLaunchSelectorCompSwitch( numComps, [&] ( auto NC )
     {
@@ -978,7 +1062,7 @@ public:
         elemManager.constructArrayViewAccessor< globalIndex, 1 >( dofKey );
       dofNumberAccessor.setName( solverName + "/accessors/" + dofKey );
 
-      using KERNEL_TYPE = FaceBasedAssemblyKernel< NUM_COMP, NUM_DOF, STENCILWRAPPER >;
+      using KERNEL_TYPE = FaceBasedAssemblyKernel< NUM_COMP, NUM_DOF, STENCILWRAPPER, RESIDUAL_ONLY >;
       typename KERNEL_TYPE::CompFlowAccessors compFlowAccessors( elemManager, solverName );
       typename KERNEL_TYPE::MultiFluidAccessors multiFluidAccessors( elemManager, solverName );
       typename KERNEL_TYPE::CapPressureAccessors capPressureAccessors( elemManager, solverName );
@@ -986,8 +1070,15 @@ public:
 
       KERNEL_TYPE kernel( numPhases, rankOffset, capPressureFlag, stencilWrapper, dofNumberAccessor,
                           compFlowAccessors, multiFluidAccessors, capPressureAccessors, permeabilityAccessors,
-                          dt, localMatrix, localRhs );
-      KERNEL_TYPE::template launch< POLICY >( stencilWrapper.size(), kernel );
+                          dt, localMatrix, localRhs, connectionSlots );
+      if( colorOffsets.size() > 0 )
+      {
+        KERNEL_TYPE::template launchColored< POLICY >( colorOffsets, connectionsByColor, kernel );
+      }
+      else
+      {
+        KERNEL_TYPE::template launch< POLICY >( stencilWrapper.size(), kernel );
+      }
     } );
   }
 };
@@ -1128,6 +1219,231 @@ struct CFLKernel
 
 };
 
+/******************************** IMPESKernel ********************************/
+
+/**
+ * @brief Functions of the implicit pressure, explicit transport (IMPES) scheme
+ */
+struct IMPESKernel
+{
+
+  /// Pressure below which the pressure residual is not normalized
+  static constexpr real64 minPresForNormalization = 1.0;
+
+  /**
+   * @brief Compute the weights that combine the equations of each cell into a pressure equation
+   * @tparam NUM_COMP number of fluid components
+   * @tparam POLICY execution policy
+   * @param rankOffset offset of the local rows
+   * @param dofNumber the dof numbers of the cells
+   * @param ghostRank the ghost ranks of the cells
+   * @param localMatrix the Jacobian of the fully implicit system
+   * @param pressureWeights the weights of the local rows
+   *
+   * The weights w of a cell solve D^T w = e_0, where D is the diagonal block of the cell in the Jacobian,
+   * so that the combined equation has a unit derivative with respect to the pressure of the cell and
+   * no derivative with respect to its component densities (quasi-IMPES decoupling).
+   */
+  template< integer NUM_COMP, typename POLICY >
+  static void
+  computePressureWeights( globalIndex const rankOffset,
+                          arrayView1d< globalIndex const > const & dofNumber,
+                          arrayView1d< integer const > const & ghostRank,
+                          CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+                          arrayView1d< real64 > const & pressureWeights )
+  {
+    integer constexpr NDOF = NUM_COMP + 1;
+
+    forAll< POLICY >( dofNumber.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+    {
+      if( ghostRank[ei] >= 0 )
+      {
+        return;
+      }
+
+      localIndex const localRow = dofNumber[ei] - rankOffset;
+
+      real64 blockTranspose[NDOF][NDOF]{};
+      for( integer idof = 0; idof < NDOF; ++idof )
+      {
+        arraySlice1d< globalIndex const > const columns = localMatrix.getColumns( localRow + idof );
+        arraySlice1d< real64 const > const values = localMatrix.getEntries( localRow + idof );
+        for( localIndex k = 0; k < columns.size(); ++k )
+        {
+          globalIndex const jdof = columns[k] - dofNumber[ei];
+          if( jdof >= 0 && jdof < NDOF )
+          {
+            blockTranspose[jdof][idof] = values[k];
+          }
+        }
+      }
+
+      real64 weights[NDOF]{};
+      weights[0] = 1.0;
+      if( !BatchedDenseLA::solve< NDOF >( blockTranspose, weights ) )
+      {
+        // singular block: fall back to the first equation
+        LvArray::tensorOps::fill< NDOF >( weights, 0.0 );
+        weights[0] = 1.0;
+      }
+
+      for( integer idof = 0; idof < NDOF; ++idof )
+      {
+        pressureWeights[localRow + idof] = weights[idof];
+      }
+    } );
+  }
+
+  /**
+   * @brief Compute the pressure weights, dispatching on the number of components
+   * @tparam POLICY execution policy
+   * @param numComps number of fluid components
+   * @param rankOffset offset of the local rows
+   * @param dofNumber the dof numbers of the cells
+   * @param ghostRank the ghost ranks of the cells
+   * @param localMatrix the Jacobian of the fully implicit system
+   * @param pressureWeights the weights of the local rows
+   */
+  template< typename POLICY >
+  static void
+  launchPressureWeights( integer const numComps,
+                         globalIndex const rankOffset,
+                         arrayView1d< globalIndex const > const & dofNumber,
+                         arrayView1d< integer const > const & ghostRank,
+                         CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+                         arrayView1d< real64 > const & pressureWeights )
+  {
+    compositionalMultiphaseBaseKernels::internal::kernelLaunchSelectorCompSwitch( numComps, [&] ( auto NC )
+    {
+      integer constexpr NUM_COMP = NC();
+      computePressureWeights< NUM_COMP, POLICY >( rankOffset, dofNumber, ghostRank, localMatrix, pressureWeights );
+    } );
+  }
+
+  /**
+   * @brief Compute the squared norm of the residual of the pressure equations, relative to the cell pressures
+   * @tparam POLICY execution policy
+   * @tparam REDUCE_POLICY reduction policy
+   * @param numComponents number of fluid components
+   * @param localResidual the residual of the fully implicit system
+   * @param rankOffset offset of the local rows
+   * @param dofNumber the dof numbers of the cells
+   * @param ghostRank the ghost ranks of the cells
+   * @param pressureWeights the weights of the local rows
+   * @param pres the pressure at the beginning of the step
+   * @param dPres the pressure increment
+   * @param localResidualNorm the squared norm, incremented on return
+   */
+  template< typename POLICY, typename REDUCE_POLICY >
+  static void
+  pressureResidualNorm( integer const numComponents,
+                        arrayView1d< real64 const > const & localResidual,
+                        globalIndex const rankOffset,
+                        arrayView1d< globalIndex const > const & dofNumber,
+                        arrayView1d< integer const > const & ghostRank,
+                        arrayView1d< real64 const > const & pressureWeights,
+                        arrayView1d< real64 const > const & pres,
+                        arrayView1d< real64 const > const & dPres,
+                        real64 & localResidualNorm )
+  {
+    RAJA::ReduceSum< REDUCE_POLICY, real64 > localSum( 0.0 );
+
+    forAll< POLICY >( dofNumber.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+    {
+      if( ghostRank[ei] < 0 )
+      {
+        localIndex const localRow = dofNumber[ei] - rankOffset;
+        real64 residual = 0.0;
+        for( integer idof = 0; idof < numComponents + 1; ++idof )
+        {
+          residual += pressureWeights[localRow + idof] * localResidual[localRow + idof];
+        }
+        real64 const val = residual / LvArray::math::max( LvArray::math::abs( pres[ei] + dPres[ei] ), minPresForNormalization );
+        localSum += val * val;
+      }
+    } );
+    localResidualNorm += localSum.get();
+  }
+
+  /**
+   * @brief Express the component masses at the beginning of the step in the pore volume at the end of the step
+   * @tparam POLICY execution policy
+   * @param numComponents number of fluid components
+   * @param ghostRank the ghost ranks of the cells
+   * @param porosityOld the porosity at the beginning of the step
+   * @param porosity the porosity at the end of the step
+   * @param compDens the component densities at the beginning of the step
+   * @param dCompDens the component density increments
+   */
+  template< typename POLICY >
+  static void
+  startTransport( integer const numComponents,
+                  arrayView1d< integer const > const & ghostRank,
+                  arrayView2d< real64 const > const & porosityOld,
+                  arrayView2d< real64 const > const & porosity,
+                  arrayView2d< real64 const, compflow::USD_COMP > const & compDens,
+                  arrayView2d< real64, compflow::USD_COMP > const & dCompDens )
+  {
+    forAll< POLICY >( ghostRank.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+    {
+      if( ghostRank[ei] < 0 )
+      {
+        real64 const poreVolumeRatio = porosityOld[ei][0] / porosity[ei][0];
+        for( integer ic = 0; ic < numComponents; ++ic )
+        {
+          dCompDens[ei][ic] = compDens[ei][ic] * ( poreVolumeRatio - 1.0 );
+        }
+      }
+    } );
+  }
+
+  /**
+   * @brief Advance the component densities over an explicit transport sub-step
+   * @tparam POLICY execution policy
+   * @param numComponents number of fluid components
+   * @param localFlux the flux terms of the sub-step, assembled in the residual of the fully implicit system
+   *
+   * The residual of the fully implicit system holds the total mass equation first, followed by the
+   * equations of all the components but the last one (see FaceBasedAssemblyKernel::complete).
+   * The flux of the last component is recovered as the total flux minus the flux of the other components.
+   * @param rankOffset offset of the local rows
+   * @param dofNumber the dof numbers of the cells
+   * @param ghostRank the ghost ranks of the cells
+   * @param volume the cell volumes
+   * @param porosity the porosity at the end of the step
+   * @param dCompDens the component density increments
+   */
+  template< typename POLICY >
+  static void
+  transportUpdate( integer const numComponents,
+                   arrayView1d< real64 const > const & localFlux,
+                   globalIndex const rankOffset,
+                   arrayView1d< globalIndex const > const & dofNumber,
+                   arrayView1d< integer const > const & ghostRank,
+                   arrayView1d< real64 const > const & volume,
+                   arrayView2d< real64 const > const & porosity,
+                   arrayView2d< real64, compflow::USD_COMP > const & dCompDens )
+  {
+    forAll< POLICY >( dofNumber.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+    {
+      if( ghostRank[ei] < 0 )
+      {
+        localIndex const localRow = dofNumber[ei] - rankOffset;
+        real64 const poreVolume = porosity[ei][0] * volume[ei];
+        real64 lastCompFlux = localFlux[localRow];
+        for( integer ic = 0; ic < numComponents - 1; ++ic )
+        {
+          real64 const compFlux = localFlux[localRow + ic + 1];
+          dCompDens[ei][ic] -= compFlux / poreVolume;
+          lastCompFlux -= compFlux;
+        }
+        dCompDens[ei][numComponents - 1] -= lastCompFlux / poreVolume;
+      }
+    } );
+  }
+
+};
+
 /******************************** AquiferBCKernel ********************************/
 
 /**
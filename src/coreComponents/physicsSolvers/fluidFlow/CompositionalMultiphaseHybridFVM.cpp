@@ -31,6 +31,7 @@
 #include "physicsSolvers/fluidFlow/CompositionalMultiphaseBaseKernels.hpp"
 #include "physicsSolvers/fluidFlow/CompositionalMultiphaseHybridFVMKernels.hpp"
 #include "physicsSolvers/fluidFlow/FlowSolverBaseExtrinsicData.hpp"
+#include "physicsSolvers/fluidFlow/HybridFVMHelperKernels.hpp"
 #include "physicsSolvers/fluidFlow/SinglePhaseHybridFVMKernels.hpp"
 
 /**
@@ -82,6 +83,20 @@ void CompositionalMultiphaseHybridFVM::registerDataOnMesh( Group & meshBodies )
     // auxiliary data for the buoyancy coefficient
     faceManager.registerExtrinsicData< extrinsicMeshData::flow::mimGravityCoefficient >( getName() );
   } );
+
+  // 3) Register the (optionally) stored transmissibility matrices, only allocated when used
+  forMeshTargets( meshBodies, [&] ( string const &,
+                                    MeshLevel & mesh,
+                                    arrayView1d< string const > const & regionNames )
+  {
+    mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames,
+                                                                        [&]( localIndex const,
+                                                                             CellElementSubRegion & subRegion )
+    {
+      subRegion.registerExtrinsicData< extrinsicMeshData::flow::transMatrix >( getName() );
+      subRegion.registerExtrinsicData< extrinsicMeshData::flow::transMatrixGrav >( getName() );
+    } );
+  } );
 }
 
 void CompositionalMultiphaseHybridFVM::initializePreSubGroups()
@@ -249,6 +264,9 @@ void CompositionalMultiphaseHybridFVM::implicitStepSetup( real64 const & time_n,
   // setup the elem-centered fields
   CompositionalMultiphaseBase::implicitStepSetup( time_n, dt, domain );
 
+  // store the transmissibility matrices if requested
+  updateStoredTransMatrices( domain, m_lengthTolerance, true );
+
   // setup the face fields
   forMeshTargets( domain.getMeshBodies(), [&] ( string const &,
                                                 MeshLevel & mesh,
@@ -458,6 +476,12 @@ void CompositionalMultiphaseHybridFVM::assembleFluxTerms( real64 const dt,
       PermeabilityBase const & permeabilityModel =
         getConstitutiveModel< PermeabilityBase >( subRegion, subRegion.getReference< string >( viewKeyStruct::permeabilityNamesString() ) );
 
+      // empty unless the transmissibility matrices have been stored in updateStoredTransMatrices
+      arrayView3d< real64 const > const storedTransMatrix =
+        subRegion.getExtrinsicData< extrinsicMeshData::flow::transMatrix >();
+      arrayView3d< real64 const > const storedTransMatrixGrav =
+        subRegion.getExtrinsicData< extrinsicMeshData::flow::transMatrixGrav >();
+
       mimeticInnerProductReducedDispatch( mimeticInnerProductBase,
                                           [&] ( auto const mimeticInnerProduct )
       {
@@ -480,6 +504,8 @@ void CompositionalMultiphaseHybridFVM::assembleFluxTerms( real64 const dt,
                                          faceGravCoef,
                                          mimFaceGravCoef,
                                          transMultiplier,
+                                         storedTransMatrix,
+                                         storedTransMatrixGrav,
                                          compFlowAccessors.get( extrinsicMeshData::flow::phaseMobility{} ),
                                          compFlowAccessors.get( extrinsicMeshData::flow::dPhaseMobility_dPressure{} ),
                                          compFlowAccessors.get( extrinsicMeshData::flow::dPhaseMobility_dGlobalCompDensity{} ),
@@ -916,6 +942,26 @@ void CompositionalMultiphaseHybridFVM::applySystemSolution( DofManager const & d
   } );
 }
 
+void CompositionalMultiphaseHybridFVM::forSystemSolutionFields( DomainPartition & domain,
+                                                                std::function< void ( dataRepository::WrapperBase & ) > const & func )
+{
+  std::map< string, string_array > fieldNames;
+  fieldNames["face"].emplace_back( string( extrinsicMeshData::flow::deltaFacePressure::key() ) );
+  fieldNames["elems"].emplace_back( string( extrinsicMeshData::flow::deltaPressure::key() ) );
+  fieldNames["elems"].emplace_back( string( extrinsicMeshData::flow::deltaGlobalCompDensity::key() ) );
+  forFieldsOnMeshTargets( domain, fieldNames, func );
+}
+
+void CompositionalMultiphaseHybridFVM::forPrimaryVariableFields( DomainPartition & domain,
+                                                                 std::function< void ( ObjectManagerBase &, dataRepository::WrapperBase & ) > const & func )
+{
+  std::map< string, string_array > fieldNames;
+  fieldNames["face"].emplace_back( string( extrinsicMeshData::flow::facePressure::key() ) );
+  fieldNames["elems"].emplace_back( string( extrinsicMeshData::flow::pressure::key() ) );
+  fieldNames["elems"].emplace_back( string( extrinsicMeshData::flow::globalCompDensity::key() ) );
+  forFieldsOnMeshTargets( domain, fieldNames, func );
+}
+
 
 void CompositionalMultiphaseHybridFVM::resetStateToBeginningOfStep( DomainPartition & domain )
 {
@@ -1506,6 +1506,8 @@ FluxKernel::
           arrayView1d< real64 const > const & faceGravCoef,
           arrayView1d< real64 const > const & mimFaceGravCoef,
           arrayView1d< real64 const > const & transMultiplier,
+          arrayView3d< real64 const > const & storedTransMatrix,
+          arrayView3d< real64 const > const & storedTransMatrixGrav,
           ElementViewConst< arrayView2d< real64 const, compflow::USD_PHASE > > const & phaseMob,
           ElementViewConst< arrayView2d< real64 const, compflow::USD_PHASE > > const & dPhaseMob_dPres,
           ElementViewConst< arrayView3d< real64 const, compflow::USD_PHASE_DC > > const & dPhaseMob_dCompDens,
@@ -1553,6 +1555,9 @@ FluxKernel::
   arrayView1d< real64 const > const & elemGravCoef =
     subRegion.getReference< array1d< real64 > >( extrinsicMeshData::flow::gravityCoefficient::key() );
 
+  // the transmissibility matrices are only stored when the permeability does not depend on the state
+  bool const useStoredTransMatrix = storedTransMatrix.size( 1 ) == NF && storedTransMatrixGrav.size( 1 ) == NF;
+
   // assemble the residual and Jacobian element by element
   // in this loop we assemble both equation types: mass conservation in the elements and constraints at the faces
   forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOSX_DEVICE ( localIndex const ei )
@@ -1562,32 +1567,38 @@ FluxKernel::
     stackArray2d< real64, NF *NF > transMatrix( NF, NF );
     stackArray2d< real64, NF *NF > transMatrixGrav( NF, NF );
 
-    real64 const perm[ 3 ] = { elemPerm[ei][0][0], elemPerm[ei][0][1], elemPerm[ei][0][2] };
-
-    // recompute the local transmissibility matrix at each iteration
-    // we can decide later to precompute transMatrix if needed
-    IP_TYPE::template compute< NF >( nodePosition,
-                                     transMultiplier,
-                                     faceToNodes,
-                                     elemToFaces[ei],
-                                     elemCenter[ei],
-                                     elemVolume[ei],
-                                     perm,
-                                     lengthTolerance,
-                                     transMatrix );
-
-    // currently the gravity term in the transport scheme is treated as in MRST, that is, always with TPFA
-    // this is why below we have to recompute the TPFA transmissibility in addition to the transmissibility matrix above
-    // TODO: treat the gravity term with a consistent inner product
-    mimeticInnerProduct::TPFAInnerProduct::compute< NF >( nodePosition,
-                                                          transMultiplier,
-                                                          faceToNodes,
-                                                          elemToFaces[ei],
-                                                          elemCenter[ei],
-                                                          elemVolume[ei],
-                                                          perm,
-                                                          lengthTolerance,
-                                                          transMatrixGrav );
+    if( !useStoredTransMatrix )
+    {
+      real64 const perm[ 3 ] = { elemPerm[ei][0][0], elemPerm[ei][0][1], elemPerm[ei][0][2] };
+
+      // recompute the local transmissibility matrix at each iteration
+      IP_TYPE::template compute< NF >( nodePosition,
+                                       transMultiplier,
+                                       faceToNodes,
+                                       elemToFaces[ei],
+                                       elemCenter[ei],
+                                       elemVolume[ei],
+                                       perm,
+                                       lengthTolerance,
+                                       transMatrix );
+
+      // currently the gravity term in the transport scheme is treated as in MRST, that is, always with TPFA
+      // this is why below we have to recompute the TPFA transmissibility in addition to the transmissibility matrix above
+      // TODO: treat the gravity term with a consistent inner product
+      mimeticInnerProduct::TPFAInnerProduct::compute< NF >( nodePosition,
+                                                            transMultiplier,
+                                                            faceToNodes,
+                                                            elemToFaces[ei],
+                                                            elemCenter[ei],
+                                                            elemVolume[ei],
+                                                            perm,
+                                                            lengthTolerance,
+                                                            transMatrixGrav );
+    }
+    arraySlice2d< real64 const > const elemTransMatrix =
+      useStoredTransMatrix ? storedTransMatrix[ei] : transMatrix.toSliceConst();
+    arraySlice2d< real64 const > const elemTransMatrixGrav =
+      useStoredTransMatrix ? storedTransMatrixGrav[ei] : transMatrixGrav.toSliceConst();
 
     // perform flux assembly in this element
     compositionalMultiphaseHybridFVMKernels::AssemblerKernel::compute< NF, NC, NP >( er, esr, ei,
@@ -1622,8 +1633,8 @@ FluxKernel::
                                                                                      elemGhostRank[ei],
                                                                                      rankOffset,
                                                                                      dt,
-                                                                                     transMatrix,
-                                                                                     transMatrixGrav,
+                                                                                     elemTransMatrix,
+                                                                                     elemTransMatrixGrav,
                                                                                      localMatrix,
                                                                                      localRhs );
   } );
@@ -1649,6 +1660,8 @@ FluxKernel::
                                    arrayView1d< real64 const > const & faceGravCoef, \
                                    arrayView1d< real64 const > const & mimFaceGravCoef, \
                                    arrayView1d< real64 const > const & transMultiplier, \
+                                   arrayView3d< real64 const > const & storedTransMatrix, \
+                                   arrayView3d< real64 const > const & storedTransMatrixGrav, \
                                    ElementViewConst< arrayView2d< real64 const, compflow::USD_PHASE > > const & phaseMob, \
                                    ElementViewConst< arrayView2d< real64 const, compflow::USD_PHASE > > const & dPhaseMob_dPres, \
                                    ElementViewConst< arrayView3d< real64 const, compflow::USD_PHASE_DC > > const & dPhaseMob_dCompDens, \
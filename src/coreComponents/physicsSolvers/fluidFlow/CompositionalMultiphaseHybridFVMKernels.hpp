@@ -628,6 +628,8 @@ struct FluxKernel
    * @param[in] elemPres the pressure at this element's center
    * @param[in] dElemPres the accumulated pressure updates at this element's center
    * @param[in] elemGravDepth the depth at this element's center
+   * @param[in] storedTransMatrix the stored transmissibility matrices (empty if they are recomputed here)
+   * @param[in] storedTransMatrixGrav the stored TPFA transmissibility matrices used for gravity (empty if they are recomputed here)
    * @param[in] phaseDens the phase densities in the domain (non-local)
    * @param[in] dPhaseDens_dPres the derivatives of the phase densities in the domain wrt pressure (non-local)
    * @param[in] dPhaseDens_dCompFrac the derivatives of the phase densities in the domain wrt component fraction (non-local)
@@ -663,6 +665,8 @@ struct FluxKernel
           arrayView1d< real64 const > const & faceGravCoef,
           arrayView1d< real64 const > const & mimFaceGravCoef,
           arrayView1d< real64 const > const & transMultiplier,
+          arrayView3d< real64 const > const & storedTransMatrix,
+          arrayView3d< real64 const > const & storedTransMatrixGrav,
           ElementViewConst< arrayView2d< real64 const, compflow::USD_PHASE > > const & phaseMob,
           ElementViewConst< arrayView2d< real64 const, compflow::USD_PHASE > > const & dPhaseMob_dPres,
           ElementViewConst< arrayView3d< real64 const, compflow::USD_PHASE_DC > > const & dPhaseMob_dCompDens,
@@ -19,6 +19,7 @@
 #include "FlowSolverBase.hpp"
 
 #include "constitutive/ConstitutivePassThru.hpp"
+#include "constitutive/permeability/PermeabilityBase.hpp"
 #include "constitutive/permeability/PermeabilityExtrinsicData.hpp"
 #include "discretizationMethods/NumericalMethodsManager.hpp"
 #include "fieldSpecification/AquiferBoundaryCondition.hpp"
@@ -26,9 +27,14 @@
 #include "fieldSpecification/FieldSpecificationManager.hpp"
 #include "finiteVolume/FiniteVolumeManager.hpp"
 #include "finiteVolume/FluxApproximationBase.hpp"
+#include "finiteVolume/HybridMimeticDiscretization.hpp"
+#include "finiteVolume/MimeticInnerProductDispatch.hpp"
 #include "mesh/DomainPartition.hpp"
+#include "mesh/utilities/MeshMapUtilities.hpp"
 #include "physicsSolvers/fluidFlow/FluxKernelsHelper.hpp"
 #include "physicsSolvers/fluidFlow/FlowSolverBaseExtrinsicData.hpp"
+#include "physicsSolvers/fluidFlow/HybridFVMHelperKernels.hpp"
+#include "physicsSolvers/fluidFlow/SinglePhaseHybridFVMKernels.hpp"
 
 namespace geosx
 {
@@ -80,7 +86,9 @@ FlowSolverBase::FlowSolverBase( string const & name,
   m_poroElasticFlag( 0 ),
   m_coupledWellsFlag( 0 ),
   m_numDofPerCell( 0 ),
-  m_fluxEstimate()
+  m_fluxEstimate(),
+  m_connectionSlotsPatternVersion( -1 ),
+  m_connectionSlotsNumRows( -1 )
 {
   this->registerWrapper( viewKeyStruct::discretizationString(), &m_discretizationName ).
     setInputFlag( InputFlags::REQUIRED ).
@@ -482,4 +490,309 @@ void FlowSolverBase::saveAquiferConvergedState( real64 const & time,
 }
 
 
+void FlowSolverBase::computeConnectionSlots( DomainPartition const & domain,
+                                             string const & dofKey,
+                                             globalIndex const rankOffset,
+                                             CRSMatrixView< real64 const, globalIndex const > const & localMatrix )
+{
+  GEOSX_MARK_FUNCTION;
+
+  m_connectionSlots.clear();
+  m_connectionSlotsPatternVersion = m_sparsityPatternVersion;
+  m_connectionSlotsNumRows = localMatrix.numRows();
+
+  NumericalMethodsManager const & numericalMethodManager = domain.getNumericalMethodManager();
+  FiniteVolumeManager const & fvManager = numericalMethodManager.getFiniteVolumeManager();
+  if( !fvManager.hasGroup< FluxApproximationBase >( m_discretizationName ) )
+  {
+    return;
+  }
+  FluxApproximationBase const & fluxApprox = fvManager.getFluxApproximation( m_discretizationName );
+
+  forMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                MeshLevel const & mesh,
+                                                arrayView1d< string const > const & )
+  {
+    ElementRegionManager const & elemManager = mesh.getElemManager();
+
+    ElementRegionManager::ElementViewAccessor< arrayView1d< globalIndex const > > const dofNumberAccessor =
+      elemManager.constructArrayViewAccessor< globalIndex, 1 >( dofKey );
+    ElementRegionManager::ElementViewAccessor< arrayView1d< integer const > > const ghostRankAccessor =
+      elemManager.constructArrayViewAccessor< integer, 1 >( ObjectManagerBase::viewKeyStruct::ghostRankString() );
+
+    fluxApprox.forAllStencils( mesh, [&] ( auto const & stencil )
+    {
+      using STENCILWRAPPER = typename TYPEOFREF( stencil ) ::StencilWrapper;
+      STENCILWRAPPER const stencilWrapper = stencil.createStencilWrapper();
+
+      array3d< localIndex > & slots = m_connectionSlots[ &stencil ];
+      slots.resize( stencilWrapper.size(), STENCILWRAPPER::NUM_POINT_IN_FLUX, STENCILWRAPPER::MAX_STENCIL_SIZE );
+
+      localIndex const numMissing =
+        fluxKernelsHelper::computeConnectionSlots< parallelDevicePolicy<> >( stencilWrapper,
+                                                                            m_numDofPerCell,
+                                                                            rankOffset,
+                                                                            dofNumberAccessor.toNestedViewConst(),
+                                                                            ghostRankAccessor.toNestedViewConst(),
+                                                                            localMatrix,
+                                                                            slots.toView() );
+      if( numMissing > 0 )
+      {
+        // the sparsity pattern does not have the expected block structure, fall back to the binary searches
+        GEOSX_LOG_LEVEL_RANK_0( 1, getName() << ": " << numMissing << " flux Jacobian entries do not match the block sparsity pattern, "
+                                              << "the connection slots are disabled for this stencil" );
+        m_connectionSlots.erase( &stencil );
+      }
+    } );
+  } );
+}
+
+arrayView3d< localIndex const > FlowSolverBase::getConnectionSlots( void const * const stencil,
+                                                                    CRSMatrixView< real64, globalIndex const > const & localMatrix ) const
+{
+  auto const it = m_connectionSlots.find( stencil );
+  // the slots are only valid for the pattern they were computed with, and not for the matrix of a coupled solver
+  if( it == m_connectionSlots.end()
+      || m_connectionSlotsPatternVersion != m_sparsityPatternVersion
+      || localMatrix.numRows() != m_connectionSlotsNumRows )
+  {
+    return arrayView3d< localIndex const >();
+  }
+  return it->second.toViewConst();
+}
+
+void FlowSolverBase::updateCachedTransmissibilities( DomainPartition & domain ) const
+{
+  GEOSX_MARK_FUNCTION;
+
+  NumericalMethodsManager const & numericalMethodManager = domain.getNumericalMethodManager();
+  FiniteVolumeManager const & fvManager = numericalMethodManager.getFiniteVolumeManager();
+  if( !fvManager.hasGroup< FluxApproximationBase >( m_discretizationName ) )
+  {
+    return;
+  }
+  FluxApproximationBase const & fluxApprox = fvManager.getFluxApproximation( m_discretizationName );
+
+  forMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                MeshLevel & mesh,
+                                                arrayView1d< string const > const & )
+  {
+    ElementRegionManager const & elemManager = mesh.getElemManager();
+
+    // the stencils may connect the target regions to other regions, so all the permeability models must be constant
+    bool isStateDependent = false;
+    elemManager.forElementSubRegions( [&]( ElementSubRegionBase const & subRegion )
+    {
+      subRegion.getConstitutiveModels().forSubGroups< PermeabilityBase >( [&]( PermeabilityBase const & permeabilityModel )
+      {
+        isStateDependent = isStateDependent || permeabilityModel.isStateDependent();
+      } );
+    } );
+
+    ElementRegionManager::ElementViewAccessor< arrayView3d< real64 const > > const permeability =
+      elemManager.constructMaterialExtrinsicAccessor< PermeabilityBase, extrinsicMeshData::permeability::permeability >();
+    ElementRegionManager::ElementViewAccessor< arrayView3d< real64 const > > const dPerm_dPressure =
+      elemManager.constructMaterialExtrinsicAccessor< PermeabilityBase, extrinsicMeshData::permeability::dPerm_dPressure >();
+
+    fluxApprox.forStencils< CellElementStencilTPFA,
+                            SurfaceElementStencil,
+                            EmbeddedSurfaceToCellStencil >( mesh, [&] ( auto & stencil )
+    {
+      if( isStateDependent )
+      {
+        stencil.clearCachedWeights();
+      }
+      else if( !stencil.hasCachedWeights() )
+      {
+        stencil.template cacheWeights< parallelDevicePolicy<> >( permeability.toNestedViewConst(),
+                                                                 dPerm_dPressure.toNestedViewConst() );
+      }
+    } );
+  } );
+}
+
+void FlowSolverBase::updateStoredTransMatrices( DomainPartition & domain,
+                                                real64 const lengthTolerance,
+                                                bool const storeGravityMatrices ) const
+{
+  GEOSX_MARK_FUNCTION;
+
+  NumericalMethodsManager const & numericalMethodManager = domain.getNumericalMethodManager();
+  FiniteVolumeManager const & fvManager = numericalMethodManager.getFiniteVolumeManager();
+  HybridMimeticDiscretization const & hmDiscretization = fvManager.getHybridMimeticDiscretization( m_discretizationName );
+  MimeticInnerProductBase const & mimeticInnerProductBase =
+    hmDiscretization.getReference< MimeticInnerProductBase >( HybridMimeticDiscretization::viewKeyStruct::innerProductString() );
+
+  forMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                MeshLevel & mesh,
+                                                arrayView1d< string const > const & regionNames )
+  {
+    NodeManager const & nodeManager = mesh.getNodeManager();
+    FaceManager const & faceManager = mesh.getFaceManager();
+
+    arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodePosition = nodeManager.referencePosition();
+    arrayView1d< real64 const > const & transMultiplier =
+      faceManager.getReference< array1d< real64 > >( viewKeyStruct::transMultiplierString() );
+    ArrayOfArraysView< localIndex const > const & faceToNodes = faceManager.nodeList().toViewConst();
+
+    mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames,
+                                                                        [&]( localIndex const,
+                                                                             CellElementSubRegion & subRegion )
+    {
+      PermeabilityBase const & permeabilityModel =
+        getConstitutiveModel< PermeabilityBase >( subRegion, subRegion.getReference< string >( viewKeyStruct::permeabilityNamesString() ) );
+
+      array3d< real64 > & transMatrix =
+        subRegion.getReference< array3d< real64 > >( extrinsicMeshData::flow::transMatrix::key() );
+      // the gravity matrices are only registered by the solvers that request them
+      array3d< real64 > * const transMatrixGrav = storeGravityMatrices
+                                                  ? &subRegion.getReference< array3d< real64 > >( extrinsicMeshData::flow::transMatrixGrav::key() )
+                                                  : nullptr;
+      localIndex const numFacesPerElem = subRegion.numFacesPerElement();
+
+      // a state-dependent permeability requires recomputing the matrices in each flux assembly
+      if( !hmDiscretization.precomputeTransmissibility() || permeabilityModel.isStateDependent() )
+      {
+        transMatrix.resizeDimension< 1, 2 >( 0, 0 );
+        if( transMatrixGrav != nullptr )
+        {
+          transMatrixGrav->resizeDimension< 1, 2 >( 0, 0 );
+        }
+        return;
+      }
+
+      // otherwise the matrices only have to be computed once
+      if( transMatrix.size( 1 ) == numFacesPerElem &&
+          ( transMatrixGrav == nullptr || transMatrixGrav->size( 1 ) == numFacesPerElem ) )
+      {
+        return;
+      }
+      transMatrix.resizeDimension< 1, 2 >( numFacesPerElem, numFacesPerElem );
+      if( transMatrixGrav != nullptr )
+      {
+        transMatrixGrav->resizeDimension< 1, 2 >( numFacesPerElem, numFacesPerElem );
+      }
+
+      arrayView2d< localIndex const > const elemToFaces = subRegion.faceList().toViewConst();
+      arrayView2d< real64 const > const elemCenter = subRegion.getElementCenter();
+      arrayView1d< real64 const > const elemVolume = subRegion.getElementVolume();
+      arrayView3d< real64 const > const elemPerm = permeabilityModel.permeability();
+
+      mimeticInnerProductDispatch( mimeticInnerProductBase,
+                                   [&] ( auto const mimeticInnerProduct )
+      {
+        using IP_TYPE = TYPEOFREF( mimeticInnerProduct );
+
+        singlePhaseHybridFVMKernels::KernelLaunchSelector< IP_TYPE,
+                                                           hybridFVMKernels::TransMatrixKernel >( numFacesPerElem,
+                                                                                                  nodePosition,
+                                                                                                  transMultiplier,
+                                                                                                  faceToNodes,
+                                                                                                  elemToFaces,
+                                                                                                  elemCenter,
+                                                                                                  elemVolume,
+                                                                                                  elemPerm,
+                                                                                                  lengthTolerance,
+                                                                                                  transMatrix.toView() );
+      } );
+
+      if( transMatrixGrav != nullptr )
+      {
+        // the gravity term of the compositional flux is always treated with TPFA
+        singlePhaseHybridFVMKernels::KernelLaunchSelector< mimeticInnerProduct::TPFAInnerProduct,
+                                                           hybridFVMKernels::TransMatrixKernel >( numFacesPerElem,
+                                                                                                  nodePosition,
+                                                                                                  transMultiplier,
+                                                                                                  faceToNodes,
+                                                                                                  elemToFaces,
+                                                                                                  elemCenter,
+                                                                                                  elemVolume,
+                                                                                                  elemPerm,
+                                                                                                  lengthTolerance,
+                                                                                                  transMatrixGrav->toView() );
+      }
+    } );
+  } );
+}
+
+void FlowSolverBase::computeConnectionColoring( DomainPartition const & domain )
+{
+  GEOSX_MARK_FUNCTION;
+
+  NumericalMethodsManager const & numericalMethodManager = domain.getNumericalMethodManager();
+  FiniteVolumeManager const & fvManager = numericalMethodManager.getFiniteVolumeManager();
+  if( !fvManager.hasGroup< FluxApproximationBase >( m_discretizationName ) )
+  {
+    return;
+  }
+  FluxApproximationBase const & fluxApprox = fvManager.getFluxApproximation( m_discretizationName );
+
+  forMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                MeshLevel const & mesh,
+                                                arrayView1d< string const > const & )
+  {
+    ElementRegionManager const & elemManager = mesh.getElemManager();
+
+    // flat numbering of the elements of all the subregions
+    std::vector< std::vector< localIndex > > elemOffsets( elemManager.numRegions() );
+    localIndex numElems = 0;
+    for( localIndex er = 0; er < elemManager.numRegions(); ++er )
+    {
+      ElementRegionBase const & region = elemManager.getRegion( er );
+      elemOffsets[er].resize( region.numSubRegions() );
+      for( localIndex esr = 0; esr < region.numSubRegions(); ++esr )
+      {
+        elemOffsets[er][esr] = numElems;
+        numElems += region.getSubRegion( esr ).size();
+      }
+    }
+
+    fluxApprox.forAllStencils( mesh, [&] ( auto const & stencil )
+    {
+      using STENCILWRAPPER = typename TYPEOFREF( stencil ) ::StencilWrapper;
+      STENCILWRAPPER const stencilWrapper = stencil.createStencilWrapper();
+
+      ConnectionColoring & coloring = m_connectionColoring[ &stencil ];
+      if( coloring.numConnections == stencilWrapper.size() )
+      {
+        // the stencil has not changed since the last coloring (successful or not)
+        return;
+      }
+
+      typename STENCILWRAPPER::IndexContainerViewConstType const & seri = stencilWrapper.getElementRegionIndices();
+      typename STENCILWRAPPER::IndexContainerViewConstType const & sesri = stencilWrapper.getElementSubRegionIndices();
+      typename STENCILWRAPPER::IndexContainerViewConstType const & sei = stencilWrapper.getElementIndices();
+
+      integer const numColors =
+        meshMapUtilities::colorObjects( stencilWrapper.size(),
+                                        numElems,
+                                        [&]( localIndex const iconn, auto && elemLambda )
+      {
+        for( localIndex i = 0; i < stencilWrapper.numPointsInFlux( iconn ); ++i )
+        {
+          elemLambda( elemOffsets[seri( iconn, i )][sesri( iconn, i )] + sei( iconn, i ) );
+        }
+      },
+                                        coloring.colorOffsets,
+                                        coloring.connectionsByColor );
+      coloring.numConnections = stencilWrapper.size();
+      coloring.valid = numColors >= 0;
+      if( !coloring.valid )
+      {
+        GEOSX_LOG_LEVEL_RANK_0( 1, getName() << ": the connections of a stencil need more than 64 colors, "
+                                              << "they are assembled without coloring" );
+        coloring.colorOffsets.clear();
+        coloring.connectionsByColor.clear();
+      }
+    } );
+  } );
+}
+
+FlowSolverBase::ConnectionColoring const * FlowSolverBase::getConnectionColoring( void const * const stencil ) const
+{
+  auto const it = m_connectionColoring.find( stencil );
+  return ( it == m_connectionColoring.end() || !it->second.valid ) ? nullptr : &it->second;
+}
+
+
 } // namespace geosx
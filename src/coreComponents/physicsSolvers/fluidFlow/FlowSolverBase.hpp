@@ -122,6 +122,88 @@ protected:
 
   virtual void setConstitutiveNamesCallSuper( ElementSubRegionBase & subRegion ) const override;
 
+  /**
+   * @brief Precompute, for each connection of the flux stencils, the positions of the flux Jacobian entries in the local matrix
+   * @param[in] domain the domain partition
+   * @param[in] dofKey the key of the element degrees of freedom
+   * @param[in] rankOffset the offset of my MPI rank
+   * @param[in] localMatrix the local CRS matrix, with its final sparsity pattern
+   *
+   * This must be called every time the sparsity pattern of @p localMatrix is set, so that the flux
+   * kernels can scatter their Jacobian directly into the CRS arrays instead of searching the columns.
+   * The slots are tied to the current sparsity pattern version of the solver.
+   */
+  void computeConnectionSlots( DomainPartition const & domain,
+                               string const & dofKey,
+                               globalIndex const rankOffset,
+                               CRSMatrixView< real64 const, globalIndex const > const & localMatrix );
+
+  /**
+   * @brief Get the precomputed connection slots of a stencil
+   * @param[in] stencil the stencil
+   * @param[in] localMatrix the local CRS matrix in which the fluxes are assembled
+   * @return a view on the slots (connection, flux element, stencil point), empty if they have not been
+   *         computed for this stencil, if the sparsity pattern has been rebuilt since, or if @p localMatrix
+   *         is not the matrix of this solver
+   */
+  arrayView3d< localIndex const > getConnectionSlots( void const * const stencil,
+                                                      CRSMatrixView< real64, globalIndex const > const & localMatrix ) const;
+
+  /**
+   * @brief Cache the transmissibilities of the flux stencils when the permeability does not change
+   * @param[in] domain the domain partition
+   *
+   * If no permeability model of the mesh depends on the state, the transmissibilities and their derivatives
+   * are computed once and reused by the flux kernels until the stencils change. Otherwise, the caches are
+   * dropped and the transmissibilities are recomputed in every flux evaluation.
+   */
+  void updateCachedTransmissibilities( DomainPartition & domain ) const;
+
+  /**
+   * @brief Compute and store the one-sided transmissibility matrices of the hybrid FVM discretization when requested
+   * @param[in] domain the domain partition
+   * @param[in] lengthTolerance the tolerance used in the transmissibility calculations
+   * @param[in] storeGravityMatrices whether to also store the TPFA matrices used for the gravity term
+   *
+   * The matrices are computed once if the HybridMimeticDiscretization precomputes the transmissibilities and the
+   * permeability does not depend on the state. Otherwise, they are dropped and recomputed in each flux assembly.
+   */
+  void updateStoredTransMatrices( DomainPartition & domain,
+                                  real64 const lengthTolerance,
+                                  bool const storeGravityMatrices ) const;
+
+  /**
+   * @brief Connections of a stencil grouped by color
+   */
+  struct ConnectionColoring
+  {
+    /// Offsets of each color in connectionsByColor
+    array1d< localIndex > colorOffsets;
+    /// Connections sorted by color, two connections of the same color do not share a flux element
+    array1d< localIndex > connectionsByColor;
+    /// Number of connections of the stencil when the coloring was computed
+    localIndex numConnections = -1;
+    /// Whether the coloring succeeded (false if the stencil needs too many colors)
+    bool valid = false;
+  };
+
+  /**
+   * @brief Color the connections of the flux stencils, so that two connections of the same color never write to the same element
+   * @param[in] domain the domain partition
+   *
+   * Connections of the same color can be assembled concurrently without atomic operations.
+   * The coloring of a stencil, or the failure to color it, is kept as long as its number of connections does not change.
+   * A stencil that would need more than 64 colors is left uncolored.
+   */
+  void computeConnectionColoring( DomainPartition const & domain );
+
+  /**
+   * @brief Get the coloring of the connections of a stencil
+   * @param[in] stencil the stencil
+   * @return a pointer to the coloring, nullptr if it has not been computed or has failed for this stencil
+   */
+  ConnectionColoring const * getConnectionColoring( void const * const stencil ) const;
+
   /// flag to determine whether or not coupled with solid solver
   integer m_poroElasticFlag;
 
@@ -133,6 +215,18 @@ protected:
 
   real64 m_fluxEstimate;
 
+  /// Positions of the flux Jacobian entries in the rows of the local matrix, for each stencil
+  std::map< void const *, array3d< localIndex > > m_connectionSlots;
+
+  /// Version of the sparsity pattern for which the connection slots have been computed
+  integer m_connectionSlotsPatternVersion;
+
+  /// Number of rows of the local matrix for which the connection slots have been computed
+  localIndex m_connectionSlotsNumRows;
+
+  /// Coloring of the connections, for each stencil
+  std::map< void const *, ConnectionColoring > m_connectionColoring;
+
 
 private:
   virtual void setConstitutiveNames( ElementSubRegionBase & subRegion ) const override;
@@ -112,6 +112,22 @@ EXTRINSIC_MESH_DATA_TRAIT( mimGravityCoefficient,
                            WRITE_AND_READ,
                            "Mimetic gravity coefficient" );
 
+EXTRINSIC_MESH_DATA_TRAIT( transMatrix,
+                           "transMatrix",
+                           array3d< real64 >,
+                           0,
+                           NOPLOT,
+                           NO_WRITE,
+                           "Stored one-sided transmissibility matrix of the hybrid FVM" );
+
+EXTRINSIC_MESH_DATA_TRAIT( transMatrixGrav,
+                           "transMatrixGrav",
+                           array3d< real64 >,
+                           0,
+                           NOPLOT,
+                           NO_WRITE,
+                           "Stored one-sided TPFA transmissibility matrix used for the gravity term of the hybrid FVM" );
+
 }
 
 }
@@ -24,6 +24,7 @@
 #include "finiteVolume/BoundaryStencil.hpp"
 #include "linearAlgebra/interfaces/InterfaceTypes.hpp"
 #include "mesh/ElementRegionManager.hpp"
+#include "mesh/utilities/MeshMapUtilities.hpp"
 
 namespace geosx
 {
@@ -125,6 +126,114 @@ void computeSinglePhaseFlux( localIndex const ( &seri )[2],
   }
 }
 
+/******************************** Connection slots ********************************/
+
+/**
+ * @brief Compute, for each connection of a stencil, the positions of the flux Jacobian entries in the rows of the local matrix.
+ * @tparam POLICY the policy used in the RAJA kernel
+ * @tparam STENCILWRAPPER the type of the stencil wrapper
+ * @param[in] stencilWrapper the stencil wrapper
+ * @param[in] numDofPerElem the number of degrees of freedom (rows and columns) per element
+ * @param[in] rankOffset the offset of my MPI rank
+ * @param[in] dofNumber the dof numbers of the elements
+ * @param[in] ghostRank the ghost ranks of the elements
+ * @param[in] localMatrix the local CRS matrix, with its final sparsity pattern
+ * @param[out] slots the position, in the rows of the flux element i, of the first column of the stencil point j (-1 for ghost elements)
+ * @return the number of flux Jacobian entries not found at the expected position in the sparsity pattern
+ *
+ * The dof columns of an element are contiguous in the (sorted) rows, and all the rows of an element share
+ * the same pattern, so a single position per (connection, flux element, stencil point) is enough.
+ * This is checked here for every row and column, and the slots must not be used if the returned value is not zero.
+ */
+template< typename POLICY, typename STENCILWRAPPER >
+localIndex computeConnectionSlots( STENCILWRAPPER const & stencilWrapper,
+                                   integer const numDofPerElem,
+                                   globalIndex const rankOffset,
+                                   ElementViewConst< arrayView1d< globalIndex const > > const & dofNumber,
+                                   ElementViewConst< arrayView1d< integer const > > const & ghostRank,
+                                   CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+                                   arrayView3d< localIndex > const & slots )
+{
+  typename STENCILWRAPPER::IndexContainerViewConstType const & seri = stencilWrapper.getElementRegionIndices();
+  typename STENCILWRAPPER::IndexContainerViewConstType const & sesri = stencilWrapper.getElementSubRegionIndices();
+  typename STENCILWRAPPER::IndexContainerViewConstType const & sei = stencilWrapper.getElementIndices();
+
+  RAJA::ReduceSum< ReducePolicy< POLICY >, localIndex > numMissing( 0 );
+
+  forAll< POLICY >( stencilWrapper.size(), [=] GEOSX_HOST_DEVICE ( localIndex const iconn )
+  {
+    localIndex const stencilSize = meshMapUtilities::size1( sei, iconn );
+    localIndex const numFluxElems = stencilWrapper.numPointsInFlux( iconn );
+
+    for( localIndex i = 0; i < numFluxElems; ++i )
+    {
+      if( ghostRank[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )] >= 0 )
+      {
+        for( localIndex j = 0; j < stencilSize; ++j )
+        {
+          slots[iconn][i][j] = -1;
+        }
+        continue;
+      }
+
+      localIndex const localRow =
+        LvArray::integerConversion< localIndex >( dofNumber[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )] - rankOffset );
+
+      for( localIndex j = 0; j < stencilSize; ++j )
+      {
+        globalIndex const dofCol = dofNumber[seri( iconn, j )][sesri( iconn, j )][sei( iconn, j )];
+        arraySlice1d< globalIndex const > const columns = localMatrix.getColumns( localRow );
+        localIndex const pos = LvArray::sortedArrayManipulation::find( columns.dataIfContiguous(), columns.size(), dofCol );
+        slots[iconn][i][j] = pos;
+
+        for( integer idof = 0; idof < numDofPerElem; ++idof )
+        {
+          arraySlice1d< globalIndex const > const rowColumns = localMatrix.getColumns( localRow + idof );
+          for( integer jdof = 0; jdof < numDofPerElem; ++jdof )
+          {
+            if( pos + jdof >= rowColumns.size() || rowColumns[pos + jdof] != dofCol + jdof )
+            {
+              numMissing += 1;
+            }
+          }
+        }
+      }
+    }
+  } );
+
+  return numMissing.get();
+}
+
+/**
+ * @brief Add the flux Jacobian values of one row to the local matrix through precomputed connection slots.
+ * @tparam POLICY the atomic policy
+ * @param[in] localMatrix the local CRS matrix
+ * @param[in] localRow the local row index
+ * @param[in] slots the positions in the row of the first column of each stencil point
+ * @param[in] stencilSize the number of points in the stencil
+ * @param[in] numDofPerElem the number of degrees of freedom per element
+ * @param[in] values the values to add, ordered as (stencil point, dof)
+ */
+template< typename POLICY >
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+void addToRowAtSlots( CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                      localIndex const localRow,
+                      arraySlice1d< localIndex const > const & slots,
+                      localIndex const stencilSize,
+                      integer const numDofPerElem,
+                      real64 const * const values )
+{
+  arraySlice1d< real64 > const entries = localMatrix.getEntries( localRow );
+  for( localIndex j = 0; j < stencilSize; ++j )
+  {
+    for( integer jdof = 0; jdof < numDofPerElem; ++jdof )
+    {
+      RAJA::atomicAdd( POLICY{}, &entries[slots[j] + jdof], values[j * numDofPerElem + jdof] );
+    }
+  }
+}
+
 /******************************** AquiferBCKernel ********************************/
 
 /**
@@ -20,6 +20,7 @@
 #define GEOSX_PHYSICSSOLVERS_FLUIDFLOW_HYBRIDFVMUPWINDINGHELPERKERNELS_HPP
 
 #include "common/DataTypes.hpp"
+#include "common/GEOS_RAJA_Interface.hpp"
 #include "linearAlgebra/interfaces/InterfaceTypes.hpp"
 #include "mesh/MeshLevel.hpp"
 
@@ -85,6 +86,55 @@ struct CellConnectivity
 
 };
 
+/******************************** TransMatrixKernel ********************************/
+
+struct TransMatrixKernel
+{
+
+  /**
+   * @brief In each element, compute the one-sided transmissibility matrix and store it
+   * @tparam IP_TYPE the type of inner product
+   * @tparam NF the number of faces per element
+   * @param[in] nodePosition the position of the nodes
+   * @param[in] transMultiplier the transmissibility multipliers at the mesh faces
+   * @param[in] faceToNodes the map from faces to nodes
+   * @param[in] elemToFaces the map from elements to faces
+   * @param[in] elemCenter the center of the elements
+   * @param[in] elemVolume the volume of the elements
+   * @param[in] elemPerm the permeability in the elements
+   * @param[in] lengthTolerance the tolerance used in the transmissibility calculations
+   * @param[out] transMatrix the stored transmissibility matrices
+   */
+  template< typename IP_TYPE, localIndex NF >
+  static void
+  launch( arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodePosition,
+          arrayView1d< real64 const > const & transMultiplier,
+          ArrayOfArraysView< localIndex const > const & faceToNodes,
+          arrayView2d< localIndex const > const & elemToFaces,
+          arrayView2d< real64 const > const & elemCenter,
+          arrayView1d< real64 const > const & elemVolume,
+          arrayView3d< real64 const > const & elemPerm,
+          real64 const lengthTolerance,
+          arrayView3d< real64 > const & transMatrix )
+  {
+    forAll< parallelDevicePolicy<> >( elemToFaces.size( 0 ), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+    {
+      real64 const perm[ 3 ] = { elemPerm[ei][0][0], elemPerm[ei][0][1], elemPerm[ei][0][2] };
+
+      IP_TYPE::template compute< NF >( nodePosition,
+                                       transMultiplier,
+                                       faceToNodes,
+                                       elemToFaces[ei],
+                                       elemCenter[ei],
+                                       elemVolume[ei],
+                                       perm,
+                                       lengthTolerance,
+                                       transMatrix[ei] );
+    } );
+  }
+
+};
+
 
 } // namespace hybridFVMUpwindingKernels
 
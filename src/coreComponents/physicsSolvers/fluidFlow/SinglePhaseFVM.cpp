@@ -103,6 +103,14 @@ void SinglePhaseFVM< BASE >::setupSystem( DomainPartition & domain,
                      solution,
                      setSparsity );
 
+  // the sparsity pattern is fixed until the next call, precompute where the fluxes go in the matrix
+  this->computeConnectionSlots( domain,
+                                dofManager.getKey( extrinsicMeshData::flow::pressure::key() ),
+                                dofManager.rankOffset(),
+                                localMatrix.toViewConst() );
+
+  // reuse the transmissibilities across the Newton iterations if the permeability is constant
+  this->updateCachedTransmissibilities( domain );
 }
 
 template< typename BASE >
@@ -186,6 +194,24 @@ void SinglePhaseFVM< BASE >::applySystemSolution( DofManager const & dofManager,
   } );
 }
 
+template< typename BASE >
+void SinglePhaseFVM< BASE >::forSystemSolutionFields( DomainPartition & domain,
+                                                      std::function< void ( dataRepository::WrapperBase & ) > const & func )
+{
+  std::map< string, string_array > fieldNames;
+  fieldNames["elems"].emplace_back( string( extrinsicMeshData::flow::deltaPressure::key() ) );
+  forFieldsOnMeshTargets( domain, fieldNames, func );
+}
+
+template< typename BASE >
+void SinglePhaseFVM< BASE >::forPrimaryVariableFields( DomainPartition & domain,
+                                                       std::function< void ( ObjectManagerBase &, dataRepository::WrapperBase & ) > const & func )
+{
+  std::map< string, string_array > fieldNames;
+  fieldNames["elems"].emplace_back( string( extrinsicMeshData::flow::pressure::key() ) );
+  forFieldsOnMeshTargets( domain, fieldNames, func );
+}
+
 template<>
 void SinglePhaseFVM< SinglePhaseBase >::assembleFluxTerms( real64 const GEOSX_UNUSED_PARAM ( time_n ),
                                                            real64 const dt,
@@ -236,7 +262,8 @@ void SinglePhaseFVM< SinglePhaseBase >::assembleFluxTerms( real64 const GEOSX_UN
                           permAccessors.get< extrinsicMeshData::permeability::permeability >(),
                           permAccessors.get< extrinsicMeshData::permeability::dPerm_dPressure >(),
                           localMatrix,
-                          localRhs );
+                          localRhs,
+                          this->getConnectionSlots( &stencil, localMatrix ) );
     } );
   } );
 
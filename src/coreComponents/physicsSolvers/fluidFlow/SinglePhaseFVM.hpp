@@ -155,6 +155,14 @@ public:
                        arrayView1d< real64 const > const & localSolution,
                        real64 const scalingFactor,
                        DomainPartition & domain ) override;
+
+  virtual void
+  forSystemSolutionFields( DomainPartition & domain,
+                           std::function< void ( dataRepository::WrapperBase & ) > const & func ) override;
+
+  virtual void
+  forPrimaryVariableFields( DomainPartition & domain,
+                            std::function< void ( ObjectManagerBase &, dataRepository::WrapperBase & ) > const & func ) override;
   virtual void
   assembleFluxTerms( real64 const time_n,
                      real64 const dt,
@@ -109,6 +109,7 @@ struct FluxKernel
    * @param[in] dPerm_dPres The derivative of permeability wrt pressure in each element
    * @param[out] localMatrix The linear system matrix
    * @param[out] localRhs The linear system residual
+   * @param[in] connectionSlots The positions of the flux Jacobian entries in the local matrix (empty to search the columns)
    */
   template< typename STENCILWRAPPER_TYPE >
   static void
@@ -127,7 +128,8 @@ struct FluxKernel
           ElementViewConst< arrayView3d< real64 const > > const & permeability,
           ElementViewConst< arrayView3d< real64 const > > const & dPerm_dPres,
           CRSMatrixView< real64, globalIndex const > const & localMatrix,
-          arrayView1d< real64 > const & localRhs )
+          arrayView1d< real64 > const & localRhs,
+          arrayView3d< localIndex const > const & connectionSlots = arrayView3d< localIndex const >() )
   {
     typename STENCILWRAPPER_TYPE::IndexContainerViewConstType const & seri = stencilWrapper.getElementRegionIndices();
     typename STENCILWRAPPER_TYPE::IndexContainerViewConstType const & sesri = stencilWrapper.getElementSubRegionIndices();
@@ -139,7 +141,8 @@ struct FluxKernel
     forAll< parallelDevicePolicy<> >( stencilWrapper.size(), [stencilWrapper, dt, rankOffset, dofNumber, ghostRank,
                                                               pres, dPres, gravCoef, dens, dDens_dPres, mob,
                                                               dMob_dPres, permeability, dPerm_dPres,
-                                                              seri, sesri, sei, localMatrix, localRhs] GEOSX_HOST_DEVICE ( localIndex const iconn )
+                                                              seri, sesri, sei, localMatrix, localRhs,
+                                                              connectionSlots] GEOSX_HOST_DEVICE ( localIndex const iconn )
     {
       localIndex const stencilSize = stencilWrapper.stencilSize( iconn );
       localIndex const numFluxElems = stencilWrapper.numPointsInFlux( iconn );
@@ -196,10 +199,22 @@ struct FluxKernel
           GEOSX_ASSERT_GT( localMatrix.numRows(), localRow );
 
           RAJA::atomicAdd( parallelDeviceAtomic{}, &localRhs[localRow], localFlux[i] );
-          localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >( localRow,
-                                                                            dofColIndices.data(),
-                                                                            localFluxJacobian[i].dataIfContiguous(),
-                                                                            stencilSize );
+          if( connectionSlots.size() > 0 )
+          {
+            addToRowAtSlots< parallelDeviceAtomic >( localMatrix,
+                                                     localRow,
+                                                     connectionSlots[iconn][i],
+                                                     stencilSize,
+                                                     1,
+                                                     localFluxJacobian[i].dataIfContiguous() );
+          }
+          else
+          {
+            localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >( localRow,
+                                                                              dofColIndices.data(),
+                                                                              localFluxJacobian[i].dataIfContiguous(),
+                                                                              stencilSize );
+          }
 
         }
       }
@@ -27,6 +27,8 @@
 #include "finiteVolume/MimeticInnerProductDispatch.hpp"
 #include "mainInterface/ProblemManager.hpp"
 #include "mesh/mpiCommunications/CommunicationTools.hpp"
+#include "physicsSolvers/fluidFlow/FlowSolverBaseExtrinsicData.hpp"
+#include "physicsSolvers/fluidFlow/HybridFVMHelperKernels.hpp"
 #include "physicsSolvers/fluidFlow/SinglePhaseBaseExtrinsicData.hpp"
 #include "physicsSolvers/fluidFlow/StencilAccessors.hpp"
 
@@ -71,6 +73,19 @@ void SinglePhaseHybridFVM::registerDataOnMesh( Group & meshBodies )
     // primary variables: face pressures changes
     faceManager.registerExtrinsicData< extrinsicMeshData::flow::deltaFacePressure >( getName() );
   } );
+
+  // 3) Register the (optionally) stored transmissibility matrices, only allocated when used
+  forMeshTargets( meshBodies, [&] ( string const &,
+                                    MeshLevel & mesh,
+                                    arrayView1d< string const > const & regionNames )
+  {
+    mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames,
+                                                                        [&]( localIndex const,
+                                                                             CellElementSubRegion & subRegion )
+    {
+      subRegion.registerExtrinsicData< extrinsicMeshData::flow::transMatrix >( getName() );
+    } );
+  } );
 }
 
 void SinglePhaseHybridFVM::initializePreSubGroups()
@@ -160,6 +175,11 @@ void SinglePhaseHybridFVM::implicitStepSetup( real64 const & time_n,
   // setup the cell-centered fields
   SinglePhaseBase::implicitStepSetup( time_n, dt, domain );
 
+  // store the transmissibility matrices if requested
+  updateStoredTransMatrices( domain,
+                             domain.getMeshBody( 0 ).getGlobalLengthScale() * m_areaRelTol,
+                             false );
+
   // setup the face fields
   forMeshTargets( domain.getMeshBodies(), [&] ( string const &,
                                                 MeshLevel & mesh,
@@ -322,6 +342,10 @@ void SinglePhaseHybridFVM::assembleFluxTerms( real64 const GEOSX_UNUSED_PARAM( t
       PermeabilityBase const & permeabilityModel =
         getConstitutiveModel< PermeabilityBase >( subRegion, permName );
 
+      // empty unless the transmissibility matrices have been stored in updateStoredTransMatrices
+      arrayView3d< real64 const > const storedTransMatrix =
+        subRegion.getExtrinsicData< extrinsicMeshData::flow::transMatrix >();
+
       mimeticInnerProductDispatch( mimeticInnerProductBase,
                                    [&] ( auto const mimeticInnerProduct )
       {
@@ -345,6 +369,7 @@ void SinglePhaseHybridFVM::assembleFluxTerms( real64 const GEOSX_UNUSED_PARAM( t
                                                      dFacePres,
                                                      faceGravCoef,
                                                      transMultiplier,
+                                                     storedTransMatrix,
                                                      flowAccessors.get( extrinsicMeshData::flow::mobility{} ),
                                                      flowAccessors.get( extrinsicMeshData::flow::dMobility_dPressure{} ),
                                                      elemDofNumber.toNestedViewConst(),
@@ -655,6 +680,24 @@ void SinglePhaseHybridFVM::applySystemSolution( DofManager const & dofManager,
   } );
 }
 
+void SinglePhaseHybridFVM::forSystemSolutionFields( DomainPartition & domain,
+                                                    std::function< void ( dataRepository::WrapperBase & ) > const & func )
+{
+  std::map< string, string_array > fieldNames;
+  fieldNames["face"].emplace_back( string( extrinsicMeshData::flow::deltaFacePressure::key() ) );
+  fieldNames["elems"].emplace_back( string( extrinsicMeshData::flow::deltaPressure::key() ) );
+  forFieldsOnMeshTargets( domain, fieldNames, func );
+}
+
+void SinglePhaseHybridFVM::forPrimaryVariableFields( DomainPartition & domain,
+                                                     std::function< void ( ObjectManagerBase &, dataRepository::WrapperBase & ) > const & func )
+{
+  std::map< string, string_array > fieldNames;
+  fieldNames["face"].emplace_back( string( extrinsicMeshData::flow::facePressure::key() ) );
+  fieldNames["elems"].emplace_back( string( extrinsicMeshData::flow::pressure::key() ) );
+  forFieldsOnMeshTargets( domain, fieldNames, func );
+}
+
 
 void SinglePhaseHybridFVM::resetStateToBeginningOfStep( DomainPartition & domain )
 {
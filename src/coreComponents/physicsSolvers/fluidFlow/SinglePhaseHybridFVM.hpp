@@ -115,6 +115,14 @@ public:
                        real64 const scalingFactor,
                        DomainPartition & domain ) override;
 
+  virtual void
+  forSystemSolutionFields( DomainPartition & domain,
+                           std::function< void ( dataRepository::WrapperBase & ) > const & func ) override;
+
+  virtual void
+  forPrimaryVariableFields( DomainPartition & domain,
+                            std::function< void ( ObjectManagerBase &, dataRepository::WrapperBase & ) > const & func ) override;
+
   virtual void
   resetStateToBeginningOfStep( DomainPartition & domain ) override;
 
@@ -509,6 +509,7 @@ struct FluxKernel
    * @param[in] dFacePres the accumulated pressure updates at the mesh face
    * @param[in] faceGravCoef the depth at the mesh faces
    * @param[in] transMultiplier the transmissibility multiplier at the mesh faces
+   * @param[in] storedTransMatrix the stored transmissibility matrices (empty if they are recomputed here)
    * @param[in] mob the mobilities in the domain (non-local)
    * @param[in] dMob_dp the derivatives of the mobilities in the domain wrt cell-centered pressure (non-local)
    * @param[in] elemDofNumber the dof numbers of the cells in the domain (non-local)
@@ -536,6 +537,7 @@ struct FluxKernel
           arrayView1d< real64 const > const & dFacePres,
           arrayView1d< real64 const > const & faceGravCoef,
           arrayView1d< real64 const > const & transMultiplier,
+          arrayView3d< real64 const > const & storedTransMatrix,
           ElementViewConst< arrayView1d< real64 const > > const & mob,
           ElementViewConst< arrayView1d< real64 const > > const & dMob_dp,
           ElementViewConst< arrayView1d< globalIndex const > > const & elemDofNumber,
@@ -575,6 +577,9 @@ struct FluxKernel
     arrayView2d< real64 const > const elemDens = fluid.density();
     arrayView2d< real64 const > const dElemDens_dp = fluid.dDensity_dPressure();
 
+    // the transmissibility matrices are only stored when the permeability does not depend on the state
+    bool const useStoredTransMatrix = storedTransMatrix.size( 1 ) == NF;
+
     // assemble the residual and Jacobian element by element
     // in this loop we assemble both equation types: mass conservation in the elements and constraints at the faces
     using KERNEL_POLICY = parallelDevicePolicy< 32 >;
@@ -584,19 +589,23 @@ struct FluxKernel
       // transmissibility matrix
       stackArray2d< real64, NF *NF > transMatrix( NF, NF );
 
-      real64 const perm[ 3 ] = { elemPerm[ei][0][0], elemPerm[ei][0][1], elemPerm[ei][0][2] };
-
-      // recompute the local transmissibility matrix at each iteration
-      // we can decide later to precompute transMatrix if needed
-      IP_TYPE::template compute< NF >( nodePosition,
-                                       transMultiplier,
-                                       faceToNodes,
-                                       elemToFaces[ei],
-                                       elemCenter[ei],
-                                       elemVolume[ei],
-                                       perm,
-                                       lengthTolerance,
-                                       transMatrix );
+      if( !useStoredTransMatrix )
+      {
+        real64 const perm[ 3 ] = { elemPerm[ei][0][0], elemPerm[ei][0][1], elemPerm[ei][0][2] };
+
+        // recompute the local transmissibility matrix at each iteration
+        IP_TYPE::template compute< NF >( nodePosition,
+                                         transMultiplier,
+                                         faceToNodes,
+                                         elemToFaces[ei],
+                                         elemCenter[ei],
+                                         elemVolume[ei],
+                                         perm,
+                                         lengthTolerance,
+                                         transMatrix );
+      }
+      arraySlice2d< real64 const > const elemTransMatrix =
+        useStoredTransMatrix ? storedTransMatrix[ei] : transMatrix.toSliceConst();
 
       // perform flux assembly in this element
       singlePhaseHybridFVMKernels::AssemblerKernel::compute< NF >( er, esr, ei,
@@ -621,7 +630,7 @@ struct FluxKernel
                                                                    elemGhostRank[ei],
                                                                    rankOffset,
                                                                    dt,
-                                                                   transMatrix,
+                                                                   elemTransMatrix,
                                                                    localMatrix,
                                                                    localRhs );
 
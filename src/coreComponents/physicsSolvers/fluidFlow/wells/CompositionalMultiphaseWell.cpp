@@ -1464,6 +1464,16 @@ CompositionalMultiphaseWell::applySystemSolution( DofManager const & dofManager,
                                                        true );
 }
 
+void CompositionalMultiphaseWell::forSystemSolutionFields( DomainPartition & domain,
+                                                           std::function< void ( dataRepository::WrapperBase & ) > const & func )
+{
+  std::map< string, string_array > fieldNames;
+  fieldNames["elems"].emplace_back( string( extrinsicMeshData::well::deltaPressure::key() ) );
+  fieldNames["elems"].emplace_back( string( extrinsicMeshData::well::deltaGlobalCompDensity::key() ) );
+  fieldNames["elems"].emplace_back( string( extrinsicMeshData::well::deltaMixtureConnectionRate::key() ) );
+  forFieldsOnMeshTargets( domain, fieldNames, func );
+}
+
 void CompositionalMultiphaseWell::chopNegativeDensities( DomainPartition & domain )
 {
   integer const numComp = m_numComponents;
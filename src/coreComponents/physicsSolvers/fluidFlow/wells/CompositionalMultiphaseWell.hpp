@@ -110,6 +110,10 @@ public:
                        real64 const scalingFactor,
                        DomainPartition & domain ) override;
 
+  virtual void
+  forSystemSolutionFields( DomainPartition & domain,
+                           std::function< void ( dataRepository::WrapperBase & ) > const & func ) override;
+
   virtual void
   resetStateToBeginningOfStep( DomainPartition & domain ) override;
 
@@ -819,6 +819,15 @@ SinglePhaseWell::applySystemSolution( DofManager const & dofManager,
   updateState( domain );
 }
 
+void SinglePhaseWell::forSystemSolutionFields( DomainPartition & domain,
+                                               std::function< void ( dataRepository::WrapperBase & ) > const & func )
+{
+  std::map< string, string_array > fieldNames;
+  fieldNames["elems"].emplace_back( string( extrinsicMeshData::well::deltaPressure::key() ) );
+  fieldNames["elems"].emplace_back( string( extrinsicMeshData::well::deltaConnectionRate::key() ) );
+  forFieldsOnMeshTargets( domain, fieldNames, func );
+}
+
 void SinglePhaseWell::resetStateToBeginningOfStep( DomainPartition & domain )
 {
 
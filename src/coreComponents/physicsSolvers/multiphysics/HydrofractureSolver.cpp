@@ -518,7 +518,7 @@ void HydrofractureSolver::setupSystem( DomainPartition & domain,
   // Add the nonzeros from coupling
   addFluxApertureCouplingSparsityPattern( domain, dofManager, pattern.toView() );
 
-  localMatrix.assimilate< parallelDevicePolicy<> >( std::move( pattern ) );
+  assimilateSparsityPattern( localMatrix, std::move( pattern ) );
   localMatrix.setName( this->getName() + "/matrix" );
 
   rhs.setName( this->getName() + "/rhs" );
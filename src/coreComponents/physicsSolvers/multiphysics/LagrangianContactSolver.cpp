@@ -755,7 +755,7 @@ real64 LagrangianContactSolver::nonlinearImplicitStep( real64 const & time_n,
         }
 
         // Compose parallel LA matrix/rhs out of local LA matrix/rhs
-        m_matrix.create( m_localMatrix.toViewConst(), m_dofManager.numLocalDofs(), MPI_COMM_GEOSX );
+        composeParallelMatrix();
 
         // Output the linear system matrix/rhs for debugging purposes
         debugOutputSystem( time_n, cycleNumber, newtonIter, m_matrix, m_rhs );
@@ -893,6 +893,8 @@ real64 LagrangianContactSolver::nonlinearImplicitStep( real64 const & time_n,
     GEOSX_LOG_RANK_0( "Number of active set iterations: " << m_activeSetIter );
   }
 
+  releaseDirectSolverFactorization();
+
   // return the achieved timestep
   return stepDt;
 }
@@ -2222,6 +2224,18 @@ void LagrangianContactSolver::applySystemSolution( DofManager const & dofManager
   computeFaceDisplacementJump( domain );
 }
 
+void LagrangianContactSolver::forSystemSolutionFields( DomainPartition & domain,
+                                                       std::function< void ( dataRepository::WrapperBase & ) > const & func )
+{
+  m_solidSolver->forSystemSolutionFields( domain, func );
+
+  std::map< string, string_array > fieldNames;
+  fieldNames["elems"].emplace_back( string( viewKeyStruct::tractionString() ) );
+  fieldNames["elems"].emplace_back( string( viewKeyStruct::deltaTractionString() ) );
+  fieldNames["elems"].emplace_back( string( viewKeyStruct::dispJumpString() ) );
+  forFieldsOnMeshTargets( domain, fieldNames, func );
+}
+
 void LagrangianContactSolver::initializeFractureState( MeshLevel & mesh,
                                                        string const & fieldName ) const
 {
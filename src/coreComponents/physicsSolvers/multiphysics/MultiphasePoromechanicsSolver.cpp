@@ -332,6 +332,13 @@ void MultiphasePoromechanicsSolver::applySystemSolution( DofManager const & dofM
   m_flowSolver->applySystemSolution( dofManager, localSolution, -scalingFactor, domain );
 }
 
+void MultiphasePoromechanicsSolver::forSystemSolutionFields( DomainPartition & domain,
+                                                             std::function< void ( dataRepository::WrapperBase & ) > const & func )
+{
+  m_solidSolver->forSystemSolutionFields( domain, func );
+  m_flowSolver->forSystemSolutionFields( domain, func );
+}
+
 void MultiphasePoromechanicsSolver::updateState( DomainPartition & domain )
 {
   forMeshTargets( domain.getMeshBodies(), [&] ( string const &,
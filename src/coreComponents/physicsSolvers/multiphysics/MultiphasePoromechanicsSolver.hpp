@@ -94,6 +94,12 @@ public:
                        real64 const scalingFactor,
                        DomainPartition & domain ) override;
 
+  virtual void
+  forSystemSolutionFields( DomainPartition & domain,
+                           std::function< void ( dataRepository::WrapperBase & ) > const & func ) override;
+
+  virtual real64 systemSolutionSign() const override { return -1.0; }
+
   virtual void
   implicitStepComplete( real64 const & time_n,
                         real64 const & dt,
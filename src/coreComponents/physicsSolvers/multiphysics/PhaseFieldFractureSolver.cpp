@@ -227,6 +227,7 @@ real64 PhaseFieldFractureSolver::splitOperatorStep( real64 const & time_n,
       damageSolver.resetStateToBeginningOfStep( domain );
       solidSolver.resetStateToBeginningOfStep( domain );
       resetStateToBeginningOfStep( domain );
+      accelerateDamage( domain, true );
     }
 
     GEOSX_LOG_LEVEL_RANK_0( 1, "\tIteration: " << iter+1 << ", MechanicsSolver: " );
@@ -263,6 +264,7 @@ real64 PhaseFieldFractureSolver::splitOperatorStep( real64 const & time_n,
                                                             cycleNumber,
                                                             domain );
 
+    accelerateDamage( domain, false );
     mapDamageToQuadrature( domain );
 
     //std::cout << "Here: " << dtReturnTemporary << std::endl;
@@ -293,6 +295,55 @@ real64 PhaseFieldFractureSolver::splitOperatorStep( real64 const & time_n,
   return dtReturn;
 }
 
+void PhaseFieldFractureSolver::accelerateDamage( DomainPartition & domain, bool const restart )
+{
+  NonlinearSolverParameters const & solverParams = getNonlinearSolverParameters();
+  if( solverParams.m_couplingAcceleration == NonlinearSolverParameters::CouplingAcceleration::None )
+  {
+    return;
+  }
+
+  PhaseFieldDamageFEM const &
+  damageSolver = this->getParent().getGroup< PhaseFieldDamageFEM >( m_damageSolverName );
+
+  string const & damageFieldName = damageSolver.getFieldName();
+
+  forMeshTargets( domain.getMeshBodies(), [&] ( string const & meshBodyName,
+                                                MeshLevel & mesh,
+                                                arrayView1d< string const > const & )
+  {
+    NodeManager & nodeManager = mesh.getNodeManager();
+    arrayView1d< real64 > const nodalDamage = nodeManager.getReference< array1d< real64 > >( damageFieldName );
+
+    if( restart )
+    {
+      m_damageAccelerators.erase( meshBodyName );
+      m_damageAccelerators.emplace( meshBodyName, FixedPointAccelerator( solverParams ) ).first->second.reset( nodalDamage.toViewConst() );
+
+      array1d< real64 > & damageAtStepStart = m_damageAtStepStart[meshBodyName];
+      damageAtStepStart.resize( nodalDamage.size() );
+      arrayView1d< real64 > const damageAtStepStartView = damageAtStepStart.toView();
+      forAll< parallelHostPolicy >( nodalDamage.size(), [=] ( localIndex const a )
+      {
+        damageAtStepStartView[a] = nodalDamage[a];
+      } );
+    }
+    else
+    {
+      // Ghost values are updated consistently since all ranks use the same mixing coefficients
+      m_damageAccelerators.at( meshBodyName ).accelerate( nodalDamage, nodeManager.ghostRank().toViewConst() );
+
+      // The extrapolated iterate may leave the admissible range: damage is bounded by 1
+      // and irreversible, i.e. it cannot decrease below its value at the beginning of the step
+      arrayView1d< real64 const > const damageAtStepStart = m_damageAtStepStart.at( meshBodyName ).toViewConst();
+      forAll< parallelHostPolicy >( nodalDamage.size(), [=] ( localIndex const a )
+      {
+        nodalDamage[a] = LvArray::math::min( 1.0, LvArray::math::max( damageAtStepStart[a], nodalDamage[a] ) );
+      } );
+    }
+  } );
+}
+
 void PhaseFieldFractureSolver::mapDamageToQuadrature( DomainPartition & domain )
 {
 
@@ -21,6 +21,7 @@
 #define GEOSX_PHYSICSSOLVERS_MULTIPHYSICS_PhaseFieldFractureSOLVER_HPP_
 
 #include "codingUtilities/EnumStrings.hpp"
+#include "physicsSolvers/FixedPointAccelerator.hpp"
 #include "physicsSolvers/SolverBase.hpp"
 
 namespace geosx
@@ -70,6 +71,13 @@ public:
 
   void mapDamageToQuadrature( DomainPartition & domain );
 
+  /**
+   * @brief Accelerate the staggered iterations on the nodal damage field.
+   * @param domain the domain partition
+   * @param restart if true, start a new coupling loop from the current damage field
+   */
+  void accelerateDamage( DomainPartition & domain, bool const restart );
+
   enum class CouplingTypeOption : integer
   {
     FixedStress,
@@ -100,6 +108,12 @@ private:
   CouplingTypeOption m_couplingTypeOption;
   integer m_subcyclingOption;
 
+  /// Accelerators of the staggered iterations, one per mesh body
+  std::map< string, FixedPointAccelerator > m_damageAccelerators;
+
+  /// Nodal damage at the beginning of the step, one per mesh body (lower bound of accelerated iterates)
+  std::map< string, array1d< real64 > > m_damageAtStepStart;
+
 };
 
 ENUM_STRINGS( PhaseFieldFractureSolver::CouplingTypeOption,
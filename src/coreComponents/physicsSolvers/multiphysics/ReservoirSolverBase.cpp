@@ -250,7 +250,7 @@ void ReservoirSolverBase::setupSystem( DomainPartition & domain,
   addCouplingSparsityPattern( domain, dofManager, pattern.toView() );
 
   // Finally, steal the pattern into a CRS matrix
-  localMatrix.assimilate< parallelDevicePolicy<> >( std::move( pattern ) );
+  assimilateSparsityPattern( localMatrix, std::move( pattern ) );
   localMatrix.setName( this->getName() + "/localMatrix" );
 
   rhs.setName( this->getName() + "/rhs" );
@@ -378,6 +378,13 @@ void ReservoirSolverBase::applySystemSolution( DofManager const & dofManager,
   m_wellSolver->applySystemSolution( dofManager, localSolution, scalingFactor, domain );
 }
 
+void ReservoirSolverBase::forSystemSolutionFields( DomainPartition & domain,
+                                                   std::function< void ( dataRepository::WrapperBase & ) > const & func )
+{
+  m_flowSolver->forSystemSolutionFields( domain, func );
+  m_wellSolver->forSystemSolutionFields( domain, func );
+}
+
 void ReservoirSolverBase::updateState( DomainPartition & domain )
 {
   m_flowSolver->updateState( domain );
@@ -344,6 +344,13 @@ void SinglePhasePoromechanicsSolver::applySystemSolution( DofManager const & dof
   m_flowSolver->applySystemSolution( dofManager, localSolution, -scalingFactor, domain );
 }
 
+void SinglePhasePoromechanicsSolver::forSystemSolutionFields( DomainPartition & domain,
+                                                              std::function< void ( dataRepository::WrapperBase & ) > const & func )
+{
+  m_solidSolver->forSystemSolutionFields( domain, func );
+  m_flowSolver->forSystemSolutionFields( domain, func );
+}
+
 void SinglePhasePoromechanicsSolver::updateState( DomainPartition & domain )
 {
   forMeshTargets( domain.getMeshBodies(), [&] ( string const &,
@@ -26,7 +26,7 @@
 #include "constitutive/fluid/SingleFluidBase.hpp"
 #include "finiteElement/Kinematics.h"
 #include "linearAlgebra/interfaces/dense/BlasLapackLA.hpp"
-#include "linearAlgebra/solvers/BlockPreconditioner.hpp"
+#include "linearAlgebra/solvers/MultiBlockPreconditioner.hpp"
 #include "linearAlgebra/solvers/SeparateComponentPreconditioner.hpp"
 #include "mesh/DomainPartition.hpp"
 #include "discretizationMethods/NumericalMethodsManager.hpp"
@@ -140,6 +140,11 @@ void SinglePhasePoromechanicsSolverEmbeddedFractures::setupSystem( DomainPartiti
 
   GEOSX_UNUSED_VAR( setSparsity );
 
+  if( m_precond )
+  {
+    m_precond->clear();
+  }
+
   dofManager.setDomain( domain );
   setupDofs( domain, dofManager );
   dofManager.reorderByRank();
@@ -174,13 +179,47 @@ void SinglePhasePoromechanicsSolverEmbeddedFractures::setupSystem( DomainPartiti
 
   // Finally, steal the pattern into a CRS matrix
   localMatrix.setName( this->getName() + "/localMatrix" );
-  localMatrix.assimilate< parallelDevicePolicy<> >( std::move( pattern ) );
+  assimilateSparsityPattern( localMatrix, std::move( pattern ) );
 
   rhs.setName( this->getName() + "/rhs" );
   rhs.create( dofManager.numLocalDofs(), MPI_COMM_GEOSX );
 
   solution.setName( this->getName() + "/solution" );
   solution.create( dofManager.numLocalDofs(), MPI_COMM_GEOSX );
+
+  if( !m_precond && m_linearSolverParameters.get().solverType != LinearSolverParameters::SolverType::direct )
+  {
+    createPreconditioner();
+  }
+}
+
+void SinglePhasePoromechanicsSolverEmbeddedFractures::createPreconditioner()
+{
+  if( m_linearSolverParameters.get().preconditionerType == LinearSolverParameters::PreconditionerType::block )
+  {
+    // Blocks are eliminated in order, so the pressure block gets the Schur complement of both mechanical blocks
+    auto precond = std::make_unique< MultiBlockPreconditioner< LAInterface > >( 3,
+                                                                                BlockShapeOption::UpperTriangular,
+                                                                                SchurComplementOption::RowsumDiagonalProbing,
+                                                                                BlockScalingOption::FrobeniusNorm );
+
+    auto mechPrecond = LAInterface::createPreconditioner( m_solidSolver->getLinearSolverParameters() );
+    precond->setupBlock( 0,
+                         { { keys::TotalDisplacement, { 3, true } } },
+                         std::make_unique< SeparateComponentPreconditioner< LAInterface > >( 3, std::move( mechPrecond ) ) );
+
+    auto jumpPrecond = LAInterface::createPreconditioner( m_fracturesSolver->getLinearSolverParameters() );
+    precond->setupBlock( 1,
+                         { { SolidMechanicsEmbeddedFractures::viewKeyStruct::dispJumpString(), { 3, true } } },
+                         std::move( jumpPrecond ) );
+
+    auto flowPrecond = LAInterface::createPreconditioner( m_flowSolver->getLinearSolverParameters() );
+    precond->setupBlock( 2,
+                         { { extrinsicMeshData::flow::pressure::key(), { 1, true } } },
+                         std::move( flowPrecond ) );
+
+    m_precond = std::move( precond );
+  }
 }
 
 void SinglePhasePoromechanicsSolverEmbeddedFractures::addCouplingNumNonzeros( DomainPartition & domain,
@@ -584,6 +623,13 @@ void SinglePhasePoromechanicsSolverEmbeddedFractures::applySystemSolution( DofMa
   m_flowSolver->applySystemSolution( dofManager, localSolution, -scalingFactor, domain );
 }
 
+void SinglePhasePoromechanicsSolverEmbeddedFractures::forSystemSolutionFields( DomainPartition & domain,
+                                                                               std::function< void ( dataRepository::WrapperBase & ) > const & func )
+{
+  m_fracturesSolver->forSystemSolutionFields( domain, func );
+  m_flowSolver->forSystemSolutionFields( domain, func );
+}
+
 void SinglePhasePoromechanicsSolverEmbeddedFractures::updateState( DomainPartition & domain )
 {
   /// 1. update the reservoir
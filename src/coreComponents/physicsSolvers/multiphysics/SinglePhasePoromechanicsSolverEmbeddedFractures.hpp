@@ -91,6 +91,10 @@ public:
                        real64 const scalingFactor,
                        DomainPartition & domain ) override;
 
+  virtual void
+  forSystemSolutionFields( DomainPartition & domain,
+                           std::function< void ( dataRepository::WrapperBase & ) > const & func ) override;
+
   virtual void
   implicitStepComplete( real64 const & time_n,
                         real64 const & dt,
@@ -148,6 +152,11 @@ protected:
 
 private:
 
+  /**
+   * @brief Create the three-block (displacement, displacement jump, pressure) preconditioner
+   */
+  void createPreconditioner();
+
   string m_fracturesSolverName;
 
   SolidMechanicsEmbeddedFractures * m_fracturesSolver;
@@ -152,6 +152,14 @@ void LaplaceBaseH1::applySystemSolution( DofManager const & dofManager,
                                                               true );
 }
 
+void LaplaceBaseH1::forSystemSolutionFields( DomainPartition & domain,
+                                             std::function< void ( dataRepository::WrapperBase & ) > const & func )
+{
+  std::map< string, string_array > fieldNames;
+  fieldNames["node"].emplace_back( m_fieldName );
+  forFieldsOnMeshTargets( domain, fieldNames, func );
+}
+
 void LaplaceBaseH1::updateState( DomainPartition & domain )
 {
   GEOSX_UNUSED_VAR( domain );
@@ -120,7 +120,7 @@ void LaplaceFEM::setupSystem( DomainPartition & domain,
                                                      sparsityPattern );
 
     sparsityPattern.compress();
-    localMatrix.assimilate< parallelDevicePolicy<> >( std::move( sparsityPattern ) );
+    assimilateSparsityPattern( localMatrix, std::move( sparsityPattern ) );
   } );
 }
 
@@ -438,6 +438,14 @@ void PhaseFieldDamageFEM::applySystemSolution( DofManager const & dofManager,
 
 }
 
+void PhaseFieldDamageFEM::forSystemSolutionFields( DomainPartition & domain,
+                                                   std::function< void ( dataRepository::WrapperBase & ) > const & func )
+{
+  std::map< string, string_array > fieldNames;
+  fieldNames["node"].emplace_back( m_fieldName );
+  forFieldsOnMeshTargets( domain, fieldNames, func );
+}
+
 void PhaseFieldDamageFEM::updateState( DomainPartition & domain )
 {
   GEOSX_UNUSED_VAR( domain );
@@ -100,6 +100,10 @@ public:
                                     real64 const scalingFactor,
                                     DomainPartition & domain ) override;
 
+  virtual void
+  forSystemSolutionFields( DomainPartition & domain,
+                           std::function< void ( dataRepository::WrapperBase & ) > const & func ) override;
+
   virtual void updateState( DomainPartition & domain ) override final;
 
   virtual void
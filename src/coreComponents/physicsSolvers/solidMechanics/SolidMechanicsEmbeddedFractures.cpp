@@ -253,7 +253,7 @@ void SolidMechanicsEmbeddedFractures::setupSystem( DomainPartition & domain,
   addCouplingSparsityPattern( domain, dofManager, pattern.toView() );
 
   // Finally, steal the pattern into a CRS matrix
-  localMatrix.assimilate< parallelDevicePolicy<> >( std::move( pattern ) );
+  assimilateSparsityPattern( localMatrix, std::move( pattern ) );
   localMatrix.setName( this->getName() + "/localMatrix" );
 
   rhs.setName( this->getName() + "/rhs" );
@@ -640,6 +640,17 @@ void SolidMechanicsEmbeddedFractures::applySystemSolution( DofManager const & do
   } );
 }
 
+void SolidMechanicsEmbeddedFractures::forSystemSolutionFields( DomainPartition & domain,
+                                                               std::function< void ( dataRepository::WrapperBase & ) > const & func )
+{
+  m_solidSolver->forSystemSolutionFields( domain, func );
+
+  std::map< string, string_array > fieldNames;
+  fieldNames["elems"].emplace_back( string( viewKeyStruct::dispJumpString() ) );
+  fieldNames["elems"].emplace_back( string( viewKeyStruct::deltaDispJumpString() ) );
+  forFieldsOnMeshTargets( domain, fieldNames, func );
+}
+
 void SolidMechanicsEmbeddedFractures::updateState( DomainPartition & domain )
 {
 
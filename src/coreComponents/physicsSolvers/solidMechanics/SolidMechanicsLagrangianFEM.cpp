@@ -25,7 +25,9 @@
 #include "codingUtilities/Utilities.hpp"
 #include "common/TimingMacros.hpp"
 #include "constitutive/ConstitutiveManager.hpp"
+#include "constitutive/ConstitutivePassThru.hpp"
 #include "constitutive/contact/ContactBase.hpp"
+#include "constitutive/solid/ElasticIsotropic.hpp"
 #include "finiteElement/FiniteElementDiscretizationManager.hpp"
 #include "finiteElement/Kinematics.h"
 #include "LvArray/src/output.hpp"
@@ -47,6 +49,30 @@ namespace geosx
 using namespace dataRepository;
 using namespace constitutive;
 
+namespace
+{
+
+/// Name of the subset of a node or element set that holds the entries at a local time step level
+string localTimeStepLevelSetName( string const & setName, integer const level )
+{
+  return GEOSX_FMT( "{}_level{}", setName, level );
+}
+
+/// Subset of a node or element set that holds the entries at a local time step level, registered on first use
+SortedArray< localIndex > & getLocalTimeStepLevelSet( Group & group, string const & setName, integer const level )
+{
+  string const levelSetName = localTimeStepLevelSetName( setName, level );
+  if( !group.hasWrapper( levelSetName ) )
+  {
+    group.registerWrapper< SortedArray< localIndex > >( levelSetName ).
+      setPlotLevel( PlotLevel::NOPLOT ).
+      setRestartFlags( RestartFlags::NO_WRITE );
+  }
+  return group.getReference< SortedArray< localIndex > >( levelSetName );
+}
+
+}
+
 SolidMechanicsLagrangianFEM::SolidMechanicsLagrangianFEM( const string & name,
                                                           Group * const parent ):
   SolverBase( name, parent ),
@@ -59,7 +85,12 @@ SolidMechanicsLagrangianFEM::SolidMechanicsLagrangianFEM( const string & name,
   m_maxForce( 0.0 ),
   m_maxNumResolves( 10 ),
   m_strainTheory( 0 ),
-  m_iComm( CommunicationTools::getInstance().getCommID() )
+  m_iComm( CommunicationTools::getInstance().getCommID() ),
+  m_localTimeStepping( 0 ),
+  m_maxLocalTimeStepLevel( 6 ),
+  m_coloredAssembly( 0 ),
+  m_localTimeStepDt( -1.0 ),
+  m_finestLocalTimeStepLevel( 0 )
 {
 
   registerWrapper( viewKeyStruct::newmarkGammaString(), &m_newmarkGamma ).
@@ -116,6 +147,26 @@ SolidMechanicsLagrangianFEM::SolidMechanicsLagrangianFEM( const string & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "Name of contact relation to enforce constraints on fracture boundary." );
 
+  registerWrapper( viewKeyStruct::localTimeSteppingString(), &m_localTimeStepping ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Flag to enable local time stepping in the explicit dynamic time integration option. "
+                    "Each node is advanced with the time step divided by the smallest power of two that satisfies "
+                    "the stability limit of its attached elements, so that small or stiff elements do not "
+                    "restrict the time step of the whole mesh. Only available with infinitesimal strain." );
+
+  registerWrapper( viewKeyStruct::maxLocalTimeStepLevelString(), &m_maxLocalTimeStepLevel ).
+    setApplyDefaultValue( 6 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Maximum number of times the time step may be halved by the local time stepping." );
+
+  registerWrapper( viewKeyStruct::coloredAssemblyString(), &m_coloredAssembly ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Flag to assemble the implicit system one element color at a time, where elements of the same color "
+                    "share no node, so that threads never write to the same matrix row concurrently. "
+                    "Falls back to the default launch if the mesh needs more than 64 colors." );
+
   registerWrapper( viewKeyStruct::maxForceString(), &m_maxForce ).
     setInputFlag( InputFlags::FALSE ).
     setDescription( "The maximum force contribution in the problem domain." );
@@ -130,6 +181,15 @@ void SolidMechanicsLagrangianFEM::postProcessInput()
   linParams.isSymmetric = true;
   linParams.dofsPerNode = 3;
   linParams.amg.separateComponents = true;
+
+  GEOSX_ERROR_IF( m_localTimeStepping != 0 && m_strainTheory != 0,
+                  getName() << ": local time stepping is only available with infinitesimal strain" );
+  GEOSX_ERROR_IF( m_localTimeStepping != 0 && m_timeIntegrationOption != TimeIntegrationOption::ExplicitDynamic,
+                  getName() << ": local time stepping is only available with the explicit dynamic time integration option" );
+  GEOSX_ERROR_IF_LT_MSG( m_maxLocalTimeStepLevel, 0,
+                         getName() << ": the maximum local time step level must be non-negative" );
+  GEOSX_ERROR_IF_GT_MSG( m_maxLocalTimeStepLevel, 20,
+                         getName() << ": the maximum local time step level must not exceed 20" );
 }
 
 SolidMechanicsLagrangianFEM::~SolidMechanicsLagrangianFEM()
@@ -203,6 +263,15 @@ void SolidMechanicsLagrangianFEM::registerDataOnMesh( Group & meshBodies )
       setDescription( "An array that holds the contact force." ).
       reference().resizeDimension< 1 >( 3 );
 
+    if( m_localTimeStepping )
+    {
+      nodes.registerWrapper< array1d< integer > >( viewKeyStruct::localTimeStepLevelString() ).
+        setPlotLevel( PlotLevel::LEVEL_1 ).
+        setRegisteringObjects( this->getName()).
+        setDescription( "An array that holds the local time step level of the nodes. "
+                        "A node at level l is advanced with the time step divided by 2^l." );
+    }
+
     Group & nodeSets = nodes.sets();
     nodeSets.registerWrapper< SortedArray< localIndex > >( viewKeyStruct::sendOrReceiveNodesString() ).
       setPlotLevel( PlotLevel::NOPLOT ).
@@ -229,6 +298,14 @@ void SolidMechanicsLagrangianFEM::registerDataOnMesh( Group & meshBodies )
         setPlotLevel( PlotLevel::NOPLOT ).
         setRestartFlags( RestartFlags::NO_WRITE );
 
+      if( m_localTimeStepping )
+      {
+        subRegion.registerWrapper< array1d< real64 > >( viewKeyStruct::stableTimeStepString() ).
+          setPlotLevel( PlotLevel::LEVEL_1 ).
+          setRegisteringObjects( this->getName()).
+          setDescription( "An array that holds the critical time step of the elements." );
+      }
+
     } );
   } );
 }
@@ -440,6 +517,11 @@ void SolidMechanicsLagrangianFEM::initializePostInitialConditionsPreSubGroups()
         elemsNotAttachedToSendOrReceiveNodes.insert( tmpElemsNotAttachedToSendOrReceiveNodes.begin(),
                                                      tmpElemsNotAttachedToSendOrReceiveNodes.end() );
 
+        if( m_localTimeStepping )
+        {
+          computeStableTimeStep( nodes, elementSubRegion );
+        }
+
         m_sendOrReceiveNodes.insert( tmpSendOrReceiveNodes.begin(),
                                      tmpSendOrReceiveNodes.end() );
         m_nonSendOrReceiveNodes.insert( tmpNonSendOrReceiveNodes.begin(),
@@ -454,6 +536,160 @@ void SolidMechanicsLagrangianFEM::initializePostInitialConditionsPreSubGroups()
   } );
 }
 
+void SolidMechanicsLagrangianFEM::computeStableTimeStep( NodeManager const & nodeManager,
+                                                         CellElementSubRegion & elementSubRegion ) const
+{
+  string const & solidMaterialName = elementSubRegion.getReference< string >( viewKeyStruct::solidMaterialNamesString() );
+  SolidBase const & solid = getConstitutiveModel< SolidBase >( elementSubRegion, solidMaterialName );
+
+  GEOSX_ERROR_IF( !solid.hasWrapper( ElasticIsotropic::viewKeyStruct::bulkModulusString() ) ||
+                  !solid.hasWrapper( ElasticIsotropic::viewKeyStruct::shearModulusString() ),
+                  getName() << ": local time stepping requires a solid model with isotropic elastic moduli, "
+                               "which " << solid.getName() << " does not provide" );
+
+  arrayView1d< real64 const > const bulkModulus =
+    solid.getReference< array1d< real64 > >( ElasticIsotropic::viewKeyStruct::bulkModulusString() );
+  arrayView1d< real64 const > const shearModulus =
+    solid.getReference< array1d< real64 > >( ElasticIsotropic::viewKeyStruct::shearModulusString() );
+  arrayView2d< real64 const > const rho =
+    solid.getReference< array2d< real64 > >( SolidBase::viewKeyStruct::densityString() );
+
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X = nodeManager.referencePosition();
+  arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemsToNodes = elementSubRegion.nodeList();
+  arrayView1d< real64 > const stableDt =
+    elementSubRegion.getReference< array1d< real64 > >( viewKeyStruct::stableTimeStepString() );
+
+  real64 const cflFactor = m_cflFactor;
+  localIndex const numNodesPerElem = elementSubRegion.numNodesPerElement();
+
+  forAll< serialPolicy >( elementSubRegion.size(), [=] ( localIndex const k )
+  {
+    // the shortest distance between two nodes bounds the characteristic length of the element
+    real64 minLengthSquared = LvArray::NumericLimits< real64 >::max;
+    for( localIndex a = 0; a < numNodesPerElem; ++a )
+    {
+      for( localIndex b = a + 1; b < numNodesPerElem; ++b )
+      {
+        real64 dX[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( X[ elemsToNodes( k, b ) ] );
+        LvArray::tensorOps::subtract< 3 >( dX, X[ elemsToNodes( k, a ) ] );
+        minLengthSquared = LvArray::math::min( minLengthSquared, LvArray::tensorOps::l2NormSquared< 3 >( dX ) );
+      }
+    }
+
+    // dilatational wave speed
+    real64 const waveSpeed = LvArray::math::sqrt( ( bulkModulus[k] + 4.0 / 3.0 * shearModulus[k] ) / rho[k][0] );
+    stableDt[k] = cflFactor * LvArray::math::sqrt( minLengthSquared ) / waveSpeed;
+  } );
+}
+
+integer SolidMechanicsLagrangianFEM::assignLocalTimeStepLevels( real64 const dt,
+                                                                 DomainPartition & domain,
+                                                                 MeshLevel & mesh,
+                                                                 arrayView1d< string const > const & regionNames ) const
+{
+  GEOSX_MARK_FUNCTION;
+
+  NodeManager & nodes = mesh.getNodeManager();
+  Group & nodeSets = nodes.sets();
+  ElementRegionManager & elementRegionManager = mesh.getElemManager();
+
+  arrayView1d< integer > const nodeLevel = nodes.getReference< array1d< integer > >( viewKeyStruct::localTimeStepLevelString() );
+  nodeLevel.move( LvArray::MemorySpace::host, true );
+  nodeLevel.setValues< serialPolicy >( 0 );
+
+  integer const maxLevel = m_maxLocalTimeStepLevel;
+  integer unstable = 0;
+
+  // each node is advanced at the finest level required by the stability limit of its attached elements
+  elementRegionManager.forElementSubRegions< CellElementSubRegion >( regionNames,
+                                                                     [&]( localIndex const,
+                                                                          CellElementSubRegion & subRegion )
+  {
+    arrayView1d< real64 const > const stableDt = subRegion.getReference< array1d< real64 > >( viewKeyStruct::stableTimeStepString() );
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemsToNodes = subRegion.nodeList();
+
+    for( localIndex k = 0; k < subRegion.size(); ++k )
+    {
+      integer level = 0;
+      while( level < maxLevel && dt > stableDt[k] * ( 1 << level ) )
+      {
+        ++level;
+      }
+      if( dt > stableDt[k] * ( 1 << level ) )
+      {
+        unstable = 1;
+      }
+
+      for( localIndex a = 0; a < elemsToNodes.size( 1 ); ++a )
+      {
+        localIndex const nodeIndex = elemsToNodes( k, a );
+        nodeLevel[nodeIndex] = LvArray::math::max( nodeLevel[nodeIndex], level );
+      }
+    }
+  } );
+
+  GEOSX_ERROR_IF( MpiWrapper::max( unstable ) > 0,
+                  getName() << ": the time step " << dt << " exceeds the stability limit of some elements even after "
+                            << maxLevel << " halvings. Increase " << viewKeyStruct::maxLocalTimeStepLevelString()
+                            << " or reduce the time step." );
+
+  // ghost nodes take the level of their owner, which sees all the attached elements
+  std::map< string, string_array > fieldNames;
+  fieldNames["node"].emplace_back( viewKeyStruct::localTimeStepLevelString() );
+  CommunicationTools::getInstance().synchronizeFields( fieldNames, mesh, domain.getNeighbors(), false );
+
+  // each element is evaluated at the rate of its finest node
+  elementRegionManager.forElementSubRegions< CellElementSubRegion >( regionNames,
+                                                                     [&]( localIndex const,
+                                                                          CellElementSubRegion & subRegion )
+  {
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemsToNodes = subRegion.nodeList();
+
+    for( string const setName : { viewKeyStruct::elemsAttachedToSendOrReceiveNodesString(),
+                                  viewKeyStruct::elemsNotAttachedToSendOrReceiveNodesString() } )
+    {
+      std::vector< std::vector< localIndex > > levelElems( maxLevel + 1 );
+      for( localIndex const k : subRegion.getReference< SortedArray< localIndex > >( setName ) )
+      {
+        integer elemLevel = 0;
+        for( localIndex a = 0; a < elemsToNodes.size( 1 ); ++a )
+        {
+          elemLevel = LvArray::math::max( elemLevel, nodeLevel[ elemsToNodes( k, a ) ] );
+        }
+        levelElems[elemLevel].push_back( k );
+      }
+
+      for( integer level = 0; level <= maxLevel; ++level )
+      {
+        SortedArray< localIndex > & levelSet = getLocalTimeStepLevelSet( subRegion, setName, level );
+        levelSet.clear();
+        levelSet.insert( levelElems[level].begin(), levelElems[level].end() );
+      }
+    }
+  } );
+
+  integer finestLevel = 0;
+  for( string const setName : { viewKeyStruct::sendOrReceiveNodesString(),
+                                viewKeyStruct::nonSendOrReceiveNodesString() } )
+  {
+    std::vector< std::vector< localIndex > > levelNodes( maxLevel + 1 );
+    for( localIndex const a : nodeSets.getReference< SortedArray< localIndex > >( setName ) )
+    {
+      levelNodes[nodeLevel[a]].push_back( a );
+      finestLevel = LvArray::math::max( finestLevel, nodeLevel[a] );
+    }
+
+    for( integer level = 0; level <= maxLevel; ++level )
+    {
+      SortedArray< localIndex > & levelSet = getLocalTimeStepLevelSet( nodeSets, setName, level );
+      levelSet.clear();
+      levelSet.insert( levelNodes[level].begin(), levelNodes[level].end() );
+    }
+  }
+
+  return MpiWrapper::max( finestLevel );
+}
+
 
 
 real64 SolidMechanicsLagrangianFEM::solverStep( real64 const & time_n,
@@ -473,6 +709,9 @@ real64 SolidMechanicsLagrangianFEM::solverStep( real64 const & time_n,
     if( surfaceGenerator!=nullptr )
     {
       surfaceGenerator->solverStep( time_n, dt, cycleNumber, domain );
+
+      // the topology may have changed, so the local time step levels must be reassigned
+      m_localTimeStepDt = -1.0;
     }
   }
   else if( m_timeIntegrationOption == TimeIntegrationOption::ImplicitDynamic ||
@@ -525,6 +764,12 @@ real64 SolidMechanicsLagrangianFEM::explicitStep( real64 const & time_n,
 {
   GEOSX_MARK_FUNCTION;
 
+  if( m_localTimeStepping )
+  {
+    explicitLocalTimeStep( time_n, dt, domain );
+    return dt;
+  }
+
   #define USE_PHYSICS_LOOP
 
   forMeshTargets( domain.getMeshBodies(), [&] ( string const &,
@@ -646,6 +891,236 @@ real64 SolidMechanicsLagrangianFEM::explicitStep( real64 const & time_n,
   return dt;
 }
 
+void SolidMechanicsLagrangianFEM::explicitLocalTimeStep( real64 const & time_n,
+                                                         real64 const & dt,
+                                                         DomainPartition & domain )
+{
+  GEOSX_MARK_FUNCTION;
+
+  if( !isEqual( dt, m_localTimeStepDt ) )
+  {
+    m_finestLocalTimeStepLevel = 0;
+    forMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                  MeshLevel & mesh,
+                                                  arrayView1d< string const > const & regionNames )
+    {
+      m_finestLocalTimeStepLevel = LvArray::math::max( m_finestLocalTimeStepLevel,
+                                                       assignLocalTimeStepLevels( dt, domain, mesh, regionNames ) );
+    } );
+    m_localTimeStepDt = dt;
+
+    GEOSX_LOG_LEVEL_RANK_0( 1, getName() << ": local time stepping with " << ( 1 << m_finestLocalTimeStepLevel )
+                                         << " sub-steps of size " << dt / ( 1 << m_finestLocalTimeStepLevel ) );
+  }
+
+  integer const finestLevel = m_finestLocalTimeStepLevel;
+  integer const numSubSteps = 1 << finestLevel;
+  real64 const subDt = dt / numSubSteps;
+
+  // coarsest level whose steps begin or end at sub-step boundary p, the level l stepping every 2^(finestLevel-l) sub-steps
+  auto const coarsestActiveLevel = [finestLevel]( integer const p )
+  {
+    integer level = finestLevel;
+    while( level > 0 && ( p >> ( finestLevel - level ) ) % 2 == 0 )
+    {
+      --level;
+    }
+    return level;
+  };
+
+  forMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                MeshLevel & mesh,
+                                                arrayView1d< string const > const & regionNames )
+  {
+    NodeManager & nodes = mesh.getNodeManager();
+    ElementRegionManager & elementRegionManager = mesh.getElemManager();
+    Group & nodeSets = nodes.sets();
+
+    FieldSpecificationManager & fsManager = FieldSpecificationManager::getInstance();
+
+    arrayView1d< real64 const > const & mass = nodes.getReference< array1d< real64 > >( keys::Mass );
+    arrayView2d< real64, nodes::VELOCITY_USD > const & vel = nodes.velocity();
+
+    arrayView2d< real64, nodes::TOTAL_DISPLACEMENT_USD > const & u = nodes.totalDisplacement();
+    arrayView2d< real64, nodes::INCR_DISPLACEMENT_USD > const & uhat = nodes.incrementalDisplacement();
+    arrayView2d< real64, nodes::ACCELERATION_USD > const & acc = nodes.acceleration();
+
+    // holds the displacement before the boundary conditions of a level are applied
+    arrayView2d< real64 > const & uPrevious = nodes.getReference< array2d< real64 > >( viewKeyStruct::vTildeString() );
+    arrayView1d< integer const > const & nodeLevel =
+      nodes.getReference< array1d< integer > >( viewKeyStruct::localTimeStepLevelString() );
+
+    std::vector< SortedArrayView< localIndex const > > sendOrReceiveNodes;
+    std::vector< SortedArrayView< localIndex const > > nonSendOrReceiveNodes;
+    for( integer level = 0; level <= finestLevel; ++level )
+    {
+      sendOrReceiveNodes.emplace_back( getLocalTimeStepLevelSet( nodeSets, viewKeyStruct::sendOrReceiveNodesString(), level ).toViewConst() );
+      nonSendOrReceiveNodes.emplace_back( getLocalTimeStepLevelSet( nodeSets, viewKeyStruct::nonSendOrReceiveNodesString(), level ).toViewConst() );
+    }
+
+    std::map< string, string_array > fieldNames;
+    fieldNames["node"].emplace_back( keys::Velocity );
+    fieldNames["node"].emplace_back( keys::Acceleration );
+
+    m_iComm.resize( domain.getNeighbors().size() );
+    CommunicationTools::getInstance().synchronizePackSendRecvSizes( fieldNames, mesh, domain.getNeighbors(), m_iComm, true );
+
+    for( integer subStep = 0; subStep < numSubSteps; ++subStep )
+    {
+      real64 const time = time_n + subStep * subDt;
+      integer const startLevel = coarsestActiveLevel( subStep );
+      integer const endLevel = coarsestActiveLevel( subStep + 1 );
+
+      // save previous constitutive state data, only for the elements of the levels evaluated in this sub-step
+      elementRegionManager.forElementSubRegions< CellElementSubRegion >( regionNames,
+                                                                         [&]( localIndex const,
+                                                                              CellElementSubRegion & subRegion )
+      {
+        string const & solidMaterialName = subRegion.template getReference< string >( viewKeyStruct::solidMaterialNamesString() );
+        SolidBase & constitutiveRelation = getConstitutiveModel< SolidBase >( subRegion, solidMaterialName );
+        localIndex const numQuad = constitutiveRelation.numQuad();
+
+        constitutive::ConstitutivePassThru< SolidBase >::execute( constitutiveRelation, [&]( auto & castedSolid )
+        {
+          auto const solidUpdates = castedSolid.createKernelUpdates();
+
+          for( integer level = endLevel; level <= finestLevel; ++level )
+          {
+            for( string const setName : { viewKeyStruct::elemsAttachedToSendOrReceiveNodesString(),
+                                          viewKeyStruct::elemsNotAttachedToSendOrReceiveNodesString() } )
+            {
+              SortedArrayView< localIndex const > const elems =
+                getLocalTimeStepLevelSet( subRegion, setName, level ).toViewConst();
+
+              forAll< parallelDevicePolicy<> >( elems.size(), [=] GEOSX_HOST_DEVICE ( localIndex const i )
+              {
+                for( localIndex q = 0; q < numQuad; ++q )
+                {
+                  solidUpdates.saveConvergedState( elems[i], q );
+                }
+              } );
+            }
+          }
+        } );
+      } );
+
+      fsManager.applyFieldValue< parallelDevicePolicy< 1024 > >( time, domain, "nodeManager", keys::Acceleration );
+
+      // the nodes of the levels starting a step are kicked and drift, the others keep drifting with their
+      // half-step velocity so that the finer elements see their displacement linearly interpolated in time
+      for( integer level = startLevel; level <= finestLevel; ++level )
+      {
+        real64 const levelDt = dt / ( 1 << level );
+        solidMechanicsLagrangianFEMKernels::velocityUpdate( acc, vel, levelDt / 2, sendOrReceiveNodes[level] );
+        solidMechanicsLagrangianFEMKernels::velocityUpdate( acc, vel, levelDt / 2, nonSendOrReceiveNodes[level] );
+      }
+
+      fsManager.applyFieldValue< parallelDevicePolicy< 1024 > >( time, domain, "nodeManager", keys::Velocity );
+
+      for( integer level = startLevel; level <= finestLevel; ++level )
+      {
+        real64 const levelDt = dt / ( 1 << level );
+        solidMechanicsLagrangianFEMKernels::displacementUpdate( vel, uhat, u, levelDt, sendOrReceiveNodes[level] );
+        solidMechanicsLagrangianFEMKernels::displacementUpdate( vel, uhat, u, levelDt, nonSendOrReceiveNodes[level] );
+      }
+
+      for( integer level = startLevel; level <= finestLevel; ++level )
+      {
+        real64 const levelDt = dt / ( 1 << level );
+        fsManager.applyFieldValue( time + levelDt,
+                                   domain, "nodeManager",
+                                   NodeManager::viewKeyStruct::totalDisplacementString(),
+                                   [&]( FieldSpecificationBase const & bc,
+                                        SortedArrayView< localIndex const > const & targetSet )
+        {
+          integer const component = bc.getComponent();
+          GEOSX_ERROR_IF_LT_MSG( component, 0, "Component index required for displacement BC " << bc.getName() );
+
+          forAll< parallelDevicePolicy< 1024 > >( targetSet.size(),
+                                                  [=] GEOSX_DEVICE ( localIndex const i )
+          {
+            localIndex const a = targetSet[ i ];
+            uPrevious( a, component ) = u( a, component );
+          } );
+        },
+                                   [&]( FieldSpecificationBase const & bc,
+                                        SortedArrayView< localIndex const > const & targetSet )
+        {
+          integer const component = bc.getComponent();
+          GEOSX_ERROR_IF_LT_MSG( component, 0, "Component index required for displacement BC " << bc.getName() );
+
+          forAll< parallelDevicePolicy< 1024 > >( targetSet.size(),
+                                                  [=] GEOSX_DEVICE ( localIndex const i )
+          {
+            localIndex const a = targetSet[ i ];
+            if( nodeLevel[ a ] == level )
+            {
+              uhat( a, component ) = u( a, component ) - uPrevious( a, component );
+              vel( a, component )  = uhat( a, component ) / levelDt;
+            }
+            else
+            {
+              u( a, component ) = uPrevious( a, component );
+            }
+          } );
+        } );
+      }
+
+      // the nodes of the levels ending a step collect the forces of all their elements, which are evaluated
+      // with the step of their level; the forces also collected by the other nodes are discarded at their own end
+      for( integer level = endLevel; level <= finestLevel; ++level )
+      {
+        solidMechanicsLagrangianFEMKernels::forceReset( acc, sendOrReceiveNodes[level] );
+        solidMechanicsLagrangianFEMKernels::forceReset( acc, nonSendOrReceiveNodes[level] );
+      }
+
+      for( integer level = endLevel; level <= finestLevel; ++level )
+      {
+        explicitKernelDispatch( mesh,
+                                regionNames,
+                                this->getDiscretizationName(),
+                                dt / ( 1 << level ),
+                                localTimeStepLevelSetName( viewKeyStruct::elemsAttachedToSendOrReceiveNodesString(), level ) );
+      }
+
+      for( integer level = endLevel; level <= finestLevel; ++level )
+      {
+        real64 const levelDt = dt / ( 1 << level );
+        solidMechanicsLagrangianFEMKernels::velocityUpdate( acc, mass, vel, levelDt / 2, sendOrReceiveNodes[level] );
+      }
+
+      fsManager.applyFieldValue< parallelDevicePolicy< 1024 > >( time, domain, "nodeManager", keys::Velocity );
+
+      parallelDeviceEvents packEvents;
+      CommunicationTools::getInstance().asyncPack( fieldNames, mesh, domain.getNeighbors(), m_iComm, true, packEvents );
+
+      waitAllDeviceEvents( packEvents );
+
+      CommunicationTools::getInstance().asyncSendRecv( domain.getNeighbors(), m_iComm, true, packEvents );
+
+      for( integer level = endLevel; level <= finestLevel; ++level )
+      {
+        explicitKernelDispatch( mesh,
+                                regionNames,
+                                this->getDiscretizationName(),
+                                dt / ( 1 << level ),
+                                localTimeStepLevelSetName( viewKeyStruct::elemsNotAttachedToSendOrReceiveNodesString(), level ) );
+      }
+
+      for( integer level = endLevel; level <= finestLevel; ++level )
+      {
+        real64 const levelDt = dt / ( 1 << level );
+        solidMechanicsLagrangianFEMKernels::velocityUpdate( acc, mass, vel, levelDt / 2, nonSendOrReceiveNodes[level] );
+      }
+      fsManager.applyFieldValue< parallelDevicePolicy< 1024 > >( time, domain, "nodeManager", keys::Velocity );
+
+      // this includes  a device sync after launching all the unpacking kernels
+      parallelDeviceEvents unpackEvents;
+      CommunicationTools::getInstance().finalizeUnpack( mesh, domain.getNeighbors(), m_iComm, true, unpackEvents );
+    }
+  } );
+}
+
 
 
 void SolidMechanicsLagrangianFEM::applyDisplacementBCImplicit( real64 const time,
@@ -962,7 +1437,7 @@ void SolidMechanicsLagrangianFEM::setupSystem( DomainPartition & domain,
   } );
 
   sparsityPattern.compress();
-  localMatrix.assimilate< parallelDevicePolicy<> >( std::move( sparsityPattern ) );
+  assimilateSparsityPattern( localMatrix, std::move( sparsityPattern ) );
 
 
 }
@@ -1012,6 +1487,31 @@ void SolidMechanicsLagrangianFEM::assembleSystem( real64 const GEOSX_UNUSED_PARA
   }
 }
 
+bool SolidMechanicsLagrangianFEM::assembleResidual( real64 const time_n,
+                                                   real64 const dt,
+                                                   DomainPartition & domain,
+                                                   DofManager const & dofManager,
+                                                   CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                                                   arrayView1d< real64 > const & localRhs )
+{
+  GEOSX_MARK_FUNCTION;
+
+  // Only the quasi-static kernel has a residual-only specialization
+  if( m_timeIntegrationOption != TimeIntegrationOption::QuasiStatic )
+  {
+    return SolverBase::assembleResidual( time_n, dt, domain, dofManager, localMatrix, localRhs );
+  }
+
+  localRhs.zero();
+
+  assemblyLaunch< constitutive::SolidBase,
+                  solidMechanicsLagrangianFEMKernels::QuasiStaticResidualFactory >( domain,
+                                                                                    dofManager,
+                                                                                    localMatrix,
+                                                                                    localRhs );
+  return false;
+}
+
 void
 SolidMechanicsLagrangianFEM::
   applyBoundaryConditions( real64 const time_n,
@@ -1171,6 +1671,15 @@ SolidMechanicsLagrangianFEM::applySystemSolution( DofManager const & dofManager,
                                                        true );
 }
 
+void SolidMechanicsLagrangianFEM::forSystemSolutionFields( DomainPartition & domain,
+                                                           std::function< void ( dataRepository::WrapperBase & ) > const & func )
+{
+  std::map< string, string_array > fieldNames;
+  fieldNames["node"].emplace_back( keys::IncrementalDisplacement );
+  fieldNames["node"].emplace_back( keys::TotalDisplacement );
+  forFieldsOnMeshTargets( domain, fieldNames, func );
+}
+
 void SolidMechanicsLagrangianFEM::solveSystem( DofManager const & dofManager,
                                                ParallelMatrix & matrix,
                                                ParallelVector & rhs,
@@ -102,6 +102,19 @@ public:
                        integer const cycleNumber,
                        DomainPartition & domain ) override;
 
+  /**
+   * @brief Advance the explicit central-difference scheme over one step with local time stepping.
+   * @param time_n the time at the beginning of the step
+   * @param dt the (coarsest) step size
+   * @param domain the domain partition
+   *
+   * Each node is advanced with the step dt/2^l of the finest level l required by the stable time step
+   * of its attached elements, and each element is evaluated at the rate of its finest node.
+   */
+  void explicitLocalTimeStep( real64 const & time_n,
+                              real64 const & dt,
+                              DomainPartition & domain );
+
   virtual void
   implicitStepSetup( real64 const & time_n,
                      real64 const & dt,
@@ -127,6 +140,14 @@ public:
                   CRSMatrixView< real64, globalIndex const > const & localMatrix,
                   arrayView1d< real64 > const & localRhs ) override;
 
+  virtual bool
+  assembleResidual( real64 const time,
+                    real64 const dt,
+                    DomainPartition & domain,
+                    DofManager const & dofManager,
+                    CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                    arrayView1d< real64 > const & localRhs ) override;
+
   virtual void
   solveSystem( DofManager const & dofManager,
                ParallelMatrix & matrix,
@@ -139,6 +160,12 @@ public:
                        real64 const scalingFactor,
                        DomainPartition & domain ) override;
 
+  virtual void
+  forSystemSolutionFields( DomainPartition & domain,
+                           std::function< void ( dataRepository::WrapperBase & ) > const & func ) override;
+
+  virtual real64 systemSolutionSign() const override { return -1.0; }
+
   virtual void updateState( DomainPartition & domain ) override final
   {
     // There should be nothing to update
@@ -240,6 +267,12 @@ public:
     static constexpr char const * elemsAttachedToSendOrReceiveNodesString() { return "elemsAttachedToSendOrReceiveNodes"; }
     static constexpr char const * elemsNotAttachedToSendOrReceiveNodesString() { return "elemsNotAttachedToSendOrReceiveNodes"; }
 
+    static constexpr char const * localTimeSteppingString() { return "localTimeStepping"; }
+    static constexpr char const * maxLocalTimeStepLevelString() { return "maxLocalTimeStepLevel"; }
+    static constexpr char const * coloredAssemblyString() { return "coloredAssembly"; }
+    static constexpr char const * stableTimeStepString() { return "stableTimeStep"; }
+    static constexpr char const * localTimeStepLevelString() { return "localTimeStepLevel"; }
+
     static constexpr char const * sendOrReceiveNodesString() { return "sendOrReceiveNodes";}
     static constexpr char const * nonSendOrReceiveNodesString() { return "nonSendOrReceiveNodes";}
     static constexpr char const * targetNodesString() { return "targetNodes";}
@@ -285,6 +318,27 @@ protected:
 
   virtual void setConstitutiveNamesCallSuper( ElementSubRegionBase & subRegion ) const override;
 
+  /**
+   * @brief Compute the critical time step of each element for the local time stepping.
+   * @param nodeManager the node manager
+   * @param elementSubRegion the element subregion
+   */
+  void computeStableTimeStep( NodeManager const & nodeManager,
+                              CellElementSubRegion & elementSubRegion ) const;
+
+  /**
+   * @brief Assign the nodes and elements to the local time step levels of a step size.
+   * @param dt the (coarsest) step size
+   * @param domain the domain partition
+   * @param mesh the mesh level
+   * @param regionNames the target regions
+   * @return the finest level in use across all ranks
+   */
+  integer assignLocalTimeStepLevels( real64 const dt,
+                                     DomainPartition & domain,
+                                     MeshLevel & mesh,
+                                     arrayView1d< string const > const & regionNames ) const;
+
   real64 m_newmarkGamma;
   real64 m_newmarkBeta;
   real64 m_massDamping;
@@ -297,6 +351,21 @@ protected:
   string m_contactRelationName;
   MPI_iCommData m_iComm;
 
+  /// Flag to advance the explicit scheme with element-wise local time steps
+  integer m_localTimeStepping;
+
+  /// Maximum number of halvings of the step size used by the local time stepping
+  integer m_maxLocalTimeStepLevel;
+
+  /// Flag to assemble the implicit system one element color at a time
+  integer m_coloredAssembly;
+
+  /// Step size for which the local time step levels were last assigned
+  real64 m_localTimeStepDt;
+
+  /// Finest local time step level in use
+  integer m_finestLocalTimeStepLevel;
+
   /// Rigid body modes
   array1d< ParallelVector > m_rigidBodyModes;
 
@@ -351,7 +420,8 @@ void SolidMechanicsLagrangianFEM::assemblyLaunch( DomainPartition & domain,
                                                                          regionNames,
                                                                          this->getDiscretizationName(),
                                                                          viewKeyStruct::solidMaterialNamesString(),
-                                                                         kernelWrapper );
+                                                                         kernelWrapper,
+                                                                         m_coloredAssembly != 0 );
   } );
 
 
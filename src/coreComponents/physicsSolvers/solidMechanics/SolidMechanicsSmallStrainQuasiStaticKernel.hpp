@@ -33,6 +33,7 @@ namespace solidMechanicsLagrangianFEMKernels
  *                            @p SUBREGION_TYPE.
  * @tparam UNUSED An unused parameter since we are assuming that the test and
  *                trial space have the same number of support points.
+ * @tparam RESIDUAL_ONLY If true, only the nodal forces are assembled.
  *
  * ### QuasiStatic Description
  * Implements the KernelBase interface functions required for solving the
@@ -52,13 +53,15 @@ namespace solidMechanicsLagrangianFEMKernels
  */
 template< typename SUBREGION_TYPE,
           typename CONSTITUTIVE_TYPE,
-          typename FE_TYPE >
-class QuasiStatic :
+          typename FE_TYPE,
+          bool RESIDUAL_ONLY = false >
+class QuasiStaticKernel :
   public finiteElement::ImplicitKernelBase< SUBREGION_TYPE,
                                             CONSTITUTIVE_TYPE,
                                             FE_TYPE,
                                             3,
-                                            3 >
+                                            3,
+                                            RESIDUAL_ONLY >
 {
 public:
   /// Alias for the base class;
@@ -66,7 +69,8 @@ public:
                                                   CONSTITUTIVE_TYPE,
                                                   FE_TYPE,
                                                   3,
-                                                  3 >;
+                                                  3,
+                                                  RESIDUAL_ONLY >;
 
   /// Number of nodes per element...which is equal to the
   /// numTestSupportPointPerElem and numTrialSupportPointPerElem by definition.
@@ -80,6 +84,7 @@ public:
   using Base::m_elemsToNodes;
   using Base::m_constitutiveUpdate;
   using Base::m_finiteElementSpace;
+  using Base::residualOnly;
 
 
   /**
@@ -87,18 +92,18 @@ public:
    * @copydoc geosx::finiteElement::ImplicitKernelBase::ImplicitKernelBase
    * @param inputGravityVector The gravity vector.
    */
-  QuasiStatic( NodeManager const & nodeManager,
-               EdgeManager const & edgeManager,
-               FaceManager const & faceManager,
-               localIndex const targetRegionIndex,
-               SUBREGION_TYPE const & elementSubRegion,
-               FE_TYPE const & finiteElementSpace,
-               CONSTITUTIVE_TYPE & inputConstitutiveType,
-               arrayView1d< globalIndex const > const inputDofNumber,
-               globalIndex const rankOffset,
-               CRSMatrixView< real64, globalIndex const > const inputMatrix,
-               arrayView1d< real64 > const inputRhs,
-               real64 const (&inputGravityVector)[3] ):
+  QuasiStaticKernel( NodeManager const & nodeManager,
+                     EdgeManager const & edgeManager,
+                     FaceManager const & faceManager,
+                     localIndex const targetRegionIndex,
+                     SUBREGION_TYPE const & elementSubRegion,
+                     FE_TYPE const & finiteElementSpace,
+                     CONSTITUTIVE_TYPE & inputConstitutiveType,
+                     arrayView1d< globalIndex const > const inputDofNumber,
+                     globalIndex const rankOffset,
+                     CRSMatrixView< real64, globalIndex const > const inputMatrix,
+                     arrayView1d< real64 > const inputRhs,
+                     real64 const (&inputGravityVector)[3] ):
     Base( nodeManager,
           edgeManager,
           faceManager,
@@ -270,7 +275,10 @@ public:
                                      N,
                                      gravityForce,
                                      reinterpret_cast< real64 (&)[numNodesPerElem][3] >(stack.localResidual) );
-    stiffness.template upperBTDB< numNodesPerElem >( dNdX, -detJ, stack.localJacobian );
+    if( !residualOnly )
+    {
+      stiffness.template upperBTDB< numNodesPerElem >( dNdX, -detJ, stack.localJacobian );
+    }
   }
 
   /**
@@ -285,7 +293,10 @@ public:
     real64 maxForce = 0;
 
     // TODO: Does this work if BTDB is non-symmetric?
-    CONSTITUTIVE_TYPE::KernelWrapper::DiscretizationOps::template fillLowerBTDB< numNodesPerElem >( stack.localJacobian );
+    if( !residualOnly )
+    {
+      CONSTITUTIVE_TYPE::KernelWrapper::DiscretizationOps::template fillLowerBTDB< numNodesPerElem >( stack.localJacobian );
+    }
 
     for( int localNode = 0; localNode < numNodesPerElem; ++localNode )
     {
@@ -294,10 +305,13 @@ public:
         localIndex const dof =
           LvArray::integerConversion< localIndex >( stack.localRowDofIndex[ numDofPerTestSupportPoint * localNode + dim ] - m_dofRankOffset );
         if( dof < 0 || dof >= m_matrix.numRows() ) continue;
-        m_matrix.template addToRowBinarySearchUnsorted< parallelDeviceAtomic >( dof,
-                                                                                stack.localRowDofIndex,
-                                                                                stack.localJacobian[ numDofPerTestSupportPoint * localNode + dim ],
-                                                                                numNodesPerElem * numDofPerTrialSupportPoint );
+        if( !residualOnly )
+        {
+          m_matrix.template addToRowBinarySearchUnsorted< parallelDeviceAtomic >( dof,
+                                                                                  stack.localRowDofIndex,
+                                                                                  stack.localJacobian[ numDofPerTestSupportPoint * localNode + dim ],
+                                                                                  numNodesPerElem * numDofPerTrialSupportPoint );
+        }
 
         RAJA::atomicAdd< parallelDeviceAtomic >( &m_rhs[ dof ], stack.localResidual[ numDofPerTestSupportPoint * localNode + dim ] );
         maxForce = fmax( maxForce, fabs( stack.localResidual[ numDofPerTestSupportPoint * localNode + dim ] ) );
@@ -328,6 +342,14 @@ protected:
 
 };
 
+/// The quasi-static kernel assembling both the residual and the Jacobian.
+template< typename SUBREGION_TYPE, typename CONSTITUTIVE_TYPE, typename FE_TYPE >
+using QuasiStatic = QuasiStaticKernel< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE, false >;
+
+/// The quasi-static kernel assembling the residual only.
+template< typename SUBREGION_TYPE, typename CONSTITUTIVE_TYPE, typename FE_TYPE >
+using QuasiStaticResidual = QuasiStaticKernel< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE, true >;
+
 /// The factory used to construct a QuasiStatic kernel.
 using QuasiStaticFactory = finiteElement::KernelFactory< QuasiStatic,
                                                          arrayView1d< globalIndex const > const,
@@ -336,6 +358,14 @@ using QuasiStaticFactory = finiteElement::KernelFactory< QuasiStatic,
                                                          arrayView1d< real64 > const,
                                                          real64 const (&)[3] >;
 
+/// The factory used to construct a residual-only QuasiStatic kernel.
+using QuasiStaticResidualFactory = finiteElement::KernelFactory< QuasiStaticResidual,
+                                                                 arrayView1d< globalIndex const > const,
+                                                                 globalIndex,
+                                                                 CRSMatrixView< real64, globalIndex const > const,
+                                                                 arrayView1d< real64 > const,
+                                                                 real64 const (&)[3] >;
+
 } // namespace solidMechanicsLagrangianFEMKernels
 
 } // namespace geosx
@@ -12,7 +12,9 @@
  * ------------------------------------------------------------------------------------------------------------
  */
 
+#include "common/MpiWrapper.hpp"
 #include "constitutive/fluid/MultiFluidBase.hpp"
+#include "finiteVolume/CellElementStencilTPFA.hpp"
 #include "finiteVolume/FiniteVolumeManager.hpp"
 #include "finiteVolume/FluxApproximationBase.hpp"
 #include "mainInterface/initialization.hpp"
@@ -710,6 +712,312 @@ TEST_F( CompositionalMultiphaseFlowTest, jacobianNumericalCheck_flux )
   } );
 }
 
+TEST_F( CompositionalMultiphaseFlowTest, residualOnlyAssembly )
+{
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+  DofManager const & dofManager = solver->getDofManager();
+
+  CRSMatrix< real64, globalIndex > const & jacobian = solver->getLocalMatrix();
+  array1d< real64 > residual( jacobian.numRows() );
+
+  // assemble the residual and the jacobian
+  jacobian.zero();
+  solver->assembleSystem( time, dt, domain, dofManager, jacobian.toViewConstSizes(), residual.toView() );
+
+  jacobian.move( LvArray::MemorySpace::host );
+  residual.move( LvArray::MemorySpace::host, false );
+  CRSMatrix< real64, globalIndex > const jacobianOrig( jacobian );
+  array1d< real64 > const residualOrig( residual );
+
+  // assemble the residual only, the matrix must be left untouched
+  residual.zero();
+  bool const jacobianAssembled = solver->assembleResidual( time, dt, domain, dofManager,
+                                                           jacobian.toViewConstSizes(), residual.toView() );
+  EXPECT_FALSE( jacobianAssembled );
+
+  residual.move( LvArray::MemorySpace::host, false );
+  for( localIndex i = 0; i < residual.size(); ++i )
+  {
+    checkRelativeError( residual[i], residualOrig[i], 1e-12, 1e-15 );
+  }
+  compareLocalMatrices( jacobian.toViewConst(), jacobianOrig.toViewConst() );
+}
+
+TEST_F( CompositionalMultiphaseFlowTest, coloredAssembly )
+{
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+
+  CRSMatrix< real64, globalIndex > & jacobian = solver->getLocalMatrix();
+  array1d< real64 > residual( jacobian.numRows() );
+
+  // default assembly, with atomic updates
+  jacobian.zero();
+  solver->assembleSystem( time, dt, domain, solver->getDofManager(), jacobian.toViewConstSizes(), residual.toView() );
+
+  jacobian.move( LvArray::MemorySpace::host );
+  residual.move( LvArray::MemorySpace::host, false );
+  CRSMatrix< real64, globalIndex > const jacobianDefault( jacobian );
+  array1d< real64 > const residualDefault( residual );
+
+  // colored assembly, the connections are colored when the system is set up
+  solver->getReference< integer >( CompositionalMultiphaseFVM::viewKeyStruct::coloredAssemblyString() ) = 1;
+  solver->setupSystem( domain,
+                       solver->getDofManager(),
+                       solver->getLocalMatrix(),
+                       solver->getSystemRhs(),
+                       solver->getSystemSolution() );
+
+  residual.zero();
+  jacobian.zero();
+  solver->assembleSystem( time, dt, domain, solver->getDofManager(), jacobian.toViewConstSizes(), residual.toView() );
+
+  // only the order of the additions differs
+  jacobian.move( LvArray::MemorySpace::host );
+  residual.move( LvArray::MemorySpace::host, false );
+  for( localIndex i = 0; i < residual.size(); ++i )
+  {
+    checkRelativeError( residual[i], residualDefault[i], 1e-12, 1e-15 );
+  }
+  compareLocalMatrices( jacobian.toViewConst(), jacobianDefault.toViewConst(), 1e-12 );
+}
+
+TEST_F( CompositionalMultiphaseFlowTest, cachedTransmissibilities )
+{
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+  MeshLevel & mesh = domain.getMeshBody( 0 ).getMeshLevel( 0 );
+  FluxApproximationBase const & fluxApprox =
+    domain.getNumericalMethodManager().getFiniteVolumeManager().getFluxApproximation( "fluidTPFA" );
+  CellElementStencilTPFA & stencil =
+    fluxApprox.getStencil< CellElementStencilTPFA >( mesh, FluxApproximationBase::viewKeyStruct::cellStencilString() );
+
+  // the permeability is constant, so the transmissibilities have been cached when the system was set up
+  ASSERT_GT( stencil.size(), 0 );
+  ASSERT_TRUE( stencil.hasCachedWeights() );
+
+  CRSMatrix< real64, globalIndex > & jacobian = solver->getLocalMatrix();
+  array1d< real64 > residual( jacobian.numRows() );
+
+  jacobian.zero();
+  solver->assembleFluxTerms( dt, domain, solver->getDofManager(), jacobian.toViewConstSizes(), residual.toView() );
+
+  jacobian.move( LvArray::MemorySpace::host );
+  residual.move( LvArray::MemorySpace::host, false );
+  CRSMatrix< real64, globalIndex > const jacobianCached( jacobian );
+  array1d< real64 > const residualCached( residual );
+
+  // the same flux terms with the transmissibilities computed on the fly
+  stencil.clearCachedWeights();
+  residual.zero();
+  jacobian.zero();
+  solver->assembleFluxTerms( dt, domain, solver->getDofManager(), jacobian.toViewConstSizes(), residual.toView() );
+
+  jacobian.move( LvArray::MemorySpace::host );
+  residual.move( LvArray::MemorySpace::host, false );
+  for( localIndex i = 0; i < residual.size(); ++i )
+  {
+    checkRelativeError( residual[i], residualCached[i], 1e-14, 1e-15 );
+  }
+  compareLocalMatrices( jacobian.toViewConst(), jacobianCached.toViewConst(), 1e-14 );
+
+  // any modification of the stencil drops the cache until the next setup
+  auto const resetCache = [&]()
+  {
+    solver->setupSystem( domain,
+                         solver->getDofManager(),
+                         solver->getLocalMatrix(),
+                         solver->getSystemRhs(),
+                         solver->getSystemSolution() );
+    ASSERT_TRUE( stencil.hasCachedWeights() );
+  };
+
+  resetCache();
+  FaceManager const & faceManager = mesh.getFaceManager();
+  arrayView2d< localIndex const > const faceToElem = faceManager.elementList().toViewConst();
+  for( localIndex kf = 0; kf < faceManager.size(); ++kf )
+  {
+    // zero the first interior face, which is a connection of the stencil
+    if( faceToElem( kf, 0 ) >= 0 && faceToElem( kf, 1 ) >= 0 )
+    {
+      EXPECT_TRUE( stencil.zero( kf ) );
+      break;
+    }
+  }
+  EXPECT_FALSE( stencil.hasCachedWeights() );
+
+  resetCache();
+  localIndex const elementRegionIndices[2] = { stencil.getElementRegionIndices()( 0, 0 ), stencil.getElementRegionIndices()( 0, 1 ) };
+  localIndex const elementSubRegionIndices[2] = { stencil.getElementSubRegionIndices()( 0, 0 ), stencil.getElementSubRegionIndices()( 0, 1 ) };
+  localIndex const elementIndices[2] = { stencil.getElementIndices()( 0, 0 ), stencil.getElementIndices()( 0, 1 ) };
+  real64 const weights[2] = { 1.0, -1.0 };
+  stencil.add( 2, elementRegionIndices, elementSubRegionIndices, elementIndices, weights, faceManager.size() );
+  EXPECT_FALSE( stencil.hasCachedWeights() );
+}
+
+TEST_F( CompositionalMultiphaseFlowTest, stateChangeTimeStepControl )
+{
+  NonlinearSolverParameters & params = solver->getNonlinearSolverParameters();
+  real64 nextDt = 0.0;
+
+  // easy Newton convergence: the Newton rule doubles the step, and is only an upper bound for the state change rule
+  params.m_numNewtonIterations = 0;
+  params.m_timeStepControl = NonlinearSolverParameters::TimeStepControl::StateChange;
+
+  // no state change recorded yet: the Newton rule applies
+  solver->setNextDt( dt, nextDt );
+  EXPECT_DOUBLE_EQ( nextDt, 2.0 * dt );
+
+  // the step is reduced when the state change exceeds its target
+  solver->recordStateChange( 2.0 );
+  solver->setNextDt( dt, nextDt );
+  EXPECT_DOUBLE_EQ( nextDt, 0.6 * dt );
+
+  // the step is kept when the state change meets its target
+  solver->recordStateChange( 1.0 );
+  solver->setNextDt( dt, nextDt );
+  EXPECT_DOUBLE_EQ( nextDt, dt );
+
+  // the increase is bounded by the Newton rule
+  solver->recordStateChange( 0.1 );
+  solver->setNextDt( dt, nextDt );
+  EXPECT_DOUBLE_EQ( nextDt, 2.0 * dt );
+
+  // the decrease is bounded by a factor 10
+  solver->recordStateChange( 100.0 );
+  solver->setNextDt( dt, nextDt );
+  EXPECT_DOUBLE_EQ( nextDt, 0.1 * dt );
+
+  // difficult Newton convergence halves the step, whatever the state change
+  params.m_numNewtonIterations = params.dtCutIterLimit() + 1;
+  solver->recordStateChange( 0.1 );
+  solver->setNextDt( dt, nextDt );
+  EXPECT_DOUBLE_EQ( nextDt, 0.5 * dt );
+
+  // the bounds on the change of the step are input parameters
+  params.m_numNewtonIterations = 0;
+  params.m_timeStepMaxChangeFactor = 1.5;
+  solver->recordStateChange( 0.1 );
+  solver->setNextDt( dt, nextDt );
+  EXPECT_DOUBLE_EQ( nextDt, 1.5 * dt );
+
+  // so is the weight of the target: the step is scaled by ( 1 + w ) / ( r + w )
+  params.m_timeStepTargetWeight = 1.0;
+  solver->recordStateChange( 2.0 );
+  solver->setNextDt( dt, nextDt );
+  EXPECT_DOUBLE_EQ( nextDt, 2.0 / 3.0 * dt );
+
+  // the recorded state changes are ignored by the Newton iterations control
+  params.m_timeStepControl = NonlinearSolverParameters::TimeStepControl::NewtonIterations;
+  solver->recordStateChange( 100.0 );
+  solver->setNextDt( dt, nextDt );
+  EXPECT_DOUBLE_EQ( nextDt, 2.0 * dt );
+
+  // and so is the stability limit
+  solver->getReference< real64 >( SolverBase::viewKeyStruct::maxStableDtString() ) = 0.3 * dt;
+  solver->setNextDt( dt, nextDt );
+  EXPECT_DOUBLE_EQ( nextDt, 2.0 * dt );
+}
+
+TEST_F( CompositionalMultiphaseFlowTest, pidTimeStepControl )
+{
+  NonlinearSolverParameters & params = solver->getNonlinearSolverParameters();
+  params.m_numNewtonIterations = 0;
+  params.m_timeStepControl = NonlinearSolverParameters::TimeStepControl::PID;
+  real64 nextDt = 0.0;
+
+  // with a single recorded step, the proportional rule applies
+  solver->recordStateChange( 2.0 );
+  solver->setNextDt( dt, nextDt );
+  EXPECT_DOUBLE_EQ( nextDt, 0.6 * dt );
+
+  // with two recorded steps, the proportional and integral terms apply
+  solver->recordStateChange( 0.8 );
+  solver->setNextDt( dt, nextDt );
+  EXPECT_NEAR( nextDt, dt * std::pow( 2.0 / 0.8, 0.075 ) * std::pow( 1.0 / 0.8, 0.175 ), 1e-12 * dt );
+
+  // with three recorded steps, the derivative term applies as well
+  solver->recordStateChange( 1.25 );
+  solver->setNextDt( dt, nextDt );
+  EXPECT_NEAR( nextDt,
+               dt * std::pow( 0.8 / 1.25, 0.075 ) * std::pow( 1.0 / 1.25, 0.175 ) * std::pow( 0.8 * 0.8 / ( 1.25 * 2.0 ), 0.01 ),
+               1e-12 * dt );
+
+  // a state change constantly on target keeps the step
+  solver->recordStateChange( 1.0 );
+  solver->recordStateChange( 1.0 );
+  solver->recordStateChange( 1.0 );
+  solver->setNextDt( dt, nextDt );
+  EXPECT_NEAR( nextDt, dt, 1e-12 * dt );
+
+  // the gains are input parameters
+  params.m_timeStepProportionalGain = 0.1;
+  params.m_timeStepIntegralGain = 0.2;
+  params.m_timeStepDerivativeGain = 0.0;
+  solver->recordStateChange( 0.5 );
+  solver->setNextDt( dt, nextDt );
+  EXPECT_NEAR( nextDt, dt * std::pow( 1.0 / 0.5, 0.1 ) * std::pow( 1.0 / 0.5, 0.2 ), 1e-12 * dt );
+
+  // the stability limit caps the step
+  solver->getReference< real64 >( SolverBase::viewKeyStruct::maxStableDtString() ) = 0.3 * dt;
+  solver->setNextDt( dt, nextDt );
+  EXPECT_DOUBLE_EQ( nextDt, 0.3 * dt );
+}
+
+TEST( CompositionalMultiphaseFlowCFL, timeStepCappedByTargetCFL )
+{
+  // same problem, with a time step limited by the flow CFL number
+  string xmlInputCFL( xmlInput );
+  string const solverAttribute = "useMass=\"1\">";
+  xmlInputCFL.replace( xmlInputCFL.find( solverAttribute ), solverAttribute.size(), "useMass=\"1\"\n targetFlowCFL=\"0.5\">" );
+
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  setupProblemFromXML( state.getProblemManager(), xmlInputCFL.c_str() );
+  CompositionalMultiphaseFVM & solver =
+    state.getProblemManager().getPhysicsSolverManager().getGroup< CompositionalMultiphaseFVM >( "compflow" );
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+
+  real64 const time = 0.0;
+  real64 const dt = 1e4;
+  solver.setupSystem( domain,
+                      solver.getDofManager(),
+                      solver.getLocalMatrix(),
+                      solver.getSystemRhs(),
+                      solver.getSystemSolution() );
+  solver.implicitStepSetup( time, dt, domain );
+
+  // the CFL numbers of the step are computed when the step completes
+  solver.implicitStepComplete( time, dt, domain );
+
+  real64 maxCFLNumber = 0.0;
+  ElementSubRegionBase const & subRegion =
+    domain.getMeshBody( 0 ).getMeshLevel( 0 ).getElemManager().getRegion( "region" ).getSubRegion( "cb1" );
+  arrayView1d< real64 const > const phaseCFLNumber = subRegion.getExtrinsicData< extrinsicMeshData::flow::phaseCFLNumber >();
+  arrayView1d< real64 const > const compCFLNumber = subRegion.getExtrinsicData< extrinsicMeshData::flow::componentCFLNumber >();
+  phaseCFLNumber.move( LvArray::MemorySpace::host, false );
+  compCFLNumber.move( LvArray::MemorySpace::host, false );
+  for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+  {
+    maxCFLNumber = LvArray::math::max( maxCFLNumber, LvArray::math::max( phaseCFLNumber[ei], compCFLNumber[ei] ) );
+  }
+  maxCFLNumber = MpiWrapper::max( maxCFLNumber );
+  ASSERT_GT( maxCFLNumber, 0.0 );
+
+  // the CFL number scales linearly with the time step, so that the target is met by scaling the last step
+  real64 const maxStableDt = solver.getReference< real64 >( SolverBase::viewKeyStruct::maxStableDtString() );
+  checkRelativeError( maxStableDt, dt * 0.5 / maxCFLNumber, 1e-12 );
+
+  // the stability limit is ignored by the default Newton iterations control
+  NonlinearSolverParameters & params = solver.getNonlinearSolverParameters();
+  params.m_numNewtonIterations = 0;
+  real64 nextDt = 0.0;
+  solver.setNextDt( dt, nextDt );
+  EXPECT_DOUBLE_EQ( nextDt, 2.0 * dt );
+
+  // the stability limit caps the step selected from the state change (bounded by the doubling of the Newton rule)
+  params.m_timeStepControl = NonlinearSolverParameters::TimeStepControl::StateChange;
+  solver.setNextDt( dt, nextDt );
+  EXPECT_LE( nextDt, maxStableDt );
+}
+
 /*
  * Accumulation numerical test not passing due to some numerical catastrophic cancellation
  * happenning in the kernel for the particular set of initial conditions we're running.
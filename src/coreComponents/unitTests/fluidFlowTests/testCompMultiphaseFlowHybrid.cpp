@@ -14,6 +14,7 @@
 
 #include "constitutive/fluid/MultiFluidBase.hpp"
 #include "finiteVolume/FiniteVolumeManager.hpp"
+#include "finiteVolume/HybridMimeticDiscretization.hpp"
 #include "mainInterface/initialization.hpp"
 #include "discretizationMethods/NumericalMethodsManager.hpp"
 #include "mainInterface/ProblemManager.hpp"
@@ -387,6 +388,61 @@ TEST_F( CompositionalMultiphaseHybridFlowTest, jacobianNumericalCheck_flux )
 }
 
 
+TEST_F( CompositionalMultiphaseHybridFlowTest, storedTransMatrices )
+{
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+  HybridMimeticDiscretization & hmDiscretization =
+    domain.getNumericalMethodManager().getFiniteVolumeManager().getHybridMimeticDiscretization( "fluidHM" );
+  ElementSubRegionBase const & subRegion =
+    domain.getMeshBody( 0 ).getMeshLevel( 0 ).getElemManager().getRegion( "Region" ).getSubRegion( "cb1" );
+  array3d< real64 > const & transMatrix =
+    subRegion.getReference< array3d< real64 > >( extrinsicMeshData::flow::transMatrix::key() );
+  array3d< real64 > const & transMatrixGrav =
+    subRegion.getReference< array3d< real64 > >( extrinsicMeshData::flow::transMatrixGrav::key() );
+
+  CRSMatrix< real64, globalIndex > & jacobian = solver->getLocalMatrix();
+  array1d< real64 > residual( jacobian.numRows() );
+
+  // flux terms with the stored matrices, including the TPFA matrices of the gravity term
+  hmDiscretization.getReference< integer >( HybridMimeticDiscretization::viewKeyStruct::precomputeTransmissibilityString() ) = 1;
+  solver->implicitStepSetup( time, dt, domain );
+  ASSERT_GT( transMatrix.size( 1 ), 0 );
+  ASSERT_EQ( transMatrixGrav.size( 1 ), transMatrix.size( 1 ) );
+
+  jacobian.zero();
+  residual.zero();
+  solver->assembleFluxTerms( dt, domain, solver->getDofManager(), jacobian.toViewConstSizes(), residual.toView() );
+  jacobian.move( LvArray::MemorySpace::host );
+  residual.move( LvArray::MemorySpace::host, false );
+  CRSMatrix< real64, globalIndex > const jacobianStored( jacobian );
+  array1d< real64 > const residualStored( residual );
+
+  // flux terms with the matrices computed in the flux kernel
+  hmDiscretization.getReference< integer >( HybridMimeticDiscretization::viewKeyStruct::precomputeTransmissibilityString() ) = 0;
+  solver->implicitStepSetup( time, dt, domain );
+  ASSERT_EQ( transMatrix.size( 1 ), 0 );
+  ASSERT_EQ( transMatrixGrav.size( 1 ), 0 );
+
+  jacobian.zero();
+  residual.zero();
+  solver->assembleFluxTerms( dt, domain, solver->getDofManager(), jacobian.toViewConstSizes(), residual.toView() );
+  jacobian.move( LvArray::MemorySpace::host );
+  residual.move( LvArray::MemorySpace::host, false );
+
+  real64 maxResidual = 0.0;
+  for( localIndex i = 0; i < residual.size(); ++i )
+  {
+    maxResidual = LvArray::math::max( maxResidual, LvArray::math::abs( residual[i] ) );
+  }
+  ASSERT_GT( maxResidual, 0.0 );
+  for( localIndex i = 0; i < residual.size(); ++i )
+  {
+    checkRelativeError( residualStored[i], residual[i], 1e-12, 1e-12 * maxResidual );
+  }
+  compareLocalMatrices( jacobianStored.toViewConst(), jacobian.toViewConst(), 1e-12 );
+}
+
+
 int main( int argc, char * * argv )
 {
   ::testing::InitGoogleTest( &argc, argv );
@@ -0,0 +1,240 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "constitutive/solid/CoupledSolidBase.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/fluidFlow/CompositionalMultiphaseBaseExtrinsicData.hpp"
+#include "physicsSolvers/fluidFlow/CompositionalMultiphaseFVM.hpp"
+#include "physicsSolvers/fluidFlow/FlowSolverBaseExtrinsicData.hpp"
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+using namespace geosx;
+using namespace geosx::dataRepository;
+using namespace geosx::constitutive;
+using namespace geosx::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+char const * xmlInput =
+  "<Problem>\n"
+  "  <Solvers gravityVector=\"{ 0.0, 0.0, -9.81 }\">\n"
+  "    <CompositionalMultiphaseFVM name=\"compflow\"\n"
+  "                                 logLevel=\"0\"\n"
+  "                                 discretization=\"fluidTPFA\"\n"
+  "                                 targetRegions=\"{region}\"\n"
+  "                                 temperature=\"297.15\"\n"
+  "                                 useMass=\"1\"\n"
+  "                                 solutionScheme=\"IMPES\"\n"
+  "                                 transportCFL=\"0.5\"\n"
+  "                                 maxTransportSubSteps=\"100\">\n"
+  "                                 \n"
+  "      <NonlinearSolverParameters newtonTol=\"1.0e-6\"\n"
+  "                                 newtonMaxIter=\"10\"/>\n"
+  "      <LinearSolverParameters solverType=\"gmres\"\n"
+  "                              krylovTol=\"1.0e-10\"/>\n"
+  "    </CompositionalMultiphaseFVM>\n"
+  "  </Solvers>\n"
+  "  <Mesh>\n"
+  "    <InternalMesh name=\"mesh\"\n"
+  "                  elementTypes=\"{C3D8}\" \n"
+  "                  xCoords=\"{0, 3}\"\n"
+  "                  yCoords=\"{0, 1}\"\n"
+  "                  zCoords=\"{0, 1}\"\n"
+  "                  nx=\"{3}\"\n"
+  "                  ny=\"{1}\"\n"
+  "                  nz=\"{1}\"\n"
+  "                  cellBlockNames=\"{cb1}\"/>\n"
+  "  </Mesh>\n"
+  "  <NumericalMethods>\n"
+  "    <FiniteVolume>\n"
+  "      <TwoPointFluxApproximation name=\"fluidTPFA\"/>\n"
+  "    </FiniteVolume>\n"
+  "  </NumericalMethods>\n"
+  "  <ElementRegions>\n"
+  "    <CellElementRegion name=\"region\" cellBlocks=\"{cb1}\" materialList=\"{fluid, rock, relperm, cappressure}\" />\n"
+  "  </ElementRegions>\n"
+  "  <Constitutive>\n"
+  "    <CompositionalMultiphaseFluid name=\"fluid\"\n"
+  "                                  phaseNames=\"{oil, gas}\"\n"
+  "                                  equationsOfState=\"{PR, PR}\"\n"
+  "                                  componentNames=\"{N2, C10, C20, H2O}\"\n"
+  "                                  componentCriticalPressure=\"{34e5, 25.3e5, 14.6e5, 220.5e5}\"\n"
+  "                                  componentCriticalTemperature=\"{126.2, 622.0, 782.0, 647.0}\"\n"
+  "                                  componentAcentricFactor=\"{0.04, 0.443, 0.816, 0.344}\"\n"
+  "                                  componentMolarWeight=\"{28e-3, 134e-3, 275e-3, 18e-3}\"\n"
+  "                                  componentVolumeShift=\"{0, 0, 0, 0}\"\n"
+  "                                  componentBinaryCoeff=\"{ {0, 0, 0, 0},\n"
+  "                                                          {0, 0, 0, 0},\n"
+  "                                                          {0, 0, 0, 0},\n"
+  "                                                          {0, 0, 0, 0} }\"/>\n"
+  "    <CompressibleSolidConstantPermeability name=\"rock\"\n"
+  "        solidModelName=\"nullSolid\"\n"
+  "        porosityModelName=\"rockPorosity\"\n"
+  "        permeabilityModelName=\"rockPerm\"/>\n"
+  "   <NullModel name=\"nullSolid\"/> \n"
+  "   <PressurePorosity name=\"rockPorosity\"\n"
+  "                     defaultReferencePorosity=\"0.05\"\n"
+  "                     referencePressure = \"0.0\"\n"
+  "                     compressibility=\"1.0e-9\"/>\n"
+  "    <BrooksCoreyRelativePermeability name=\"relperm\"\n"
+  "                                     phaseNames=\"{oil, gas}\"\n"
+  "                                     phaseMinVolumeFraction=\"{0.1, 0.15}\"\n"
+  "                                     phaseRelPermExponent=\"{2.0, 2.0}\"\n"
+  "                                     phaseRelPermMaxValue=\"{0.8, 0.9}\"/>\n"
+  "    <BrooksCoreyCapillaryPressure name=\"cappressure\"\n"
+  "                                  phaseNames=\"{oil, gas}\"\n"
+  "                                  phaseMinVolumeFraction=\"{0.2, 0.05}\"\n"
+  "                                  phaseCapPressureExponentInv=\"{4.25, 3.5}\"\n"
+  "                                  phaseEntryPressure=\"{0., 1e8}\"\n"
+  "                                  capPressureEpsilon=\"0.0\"/> \n"
+  "  <ConstantPermeability name=\"rockPerm\"\n"
+  "                        permeabilityComponents=\"{2.0e-16, 2.0e-16, 2.0e-16}\"/> \n"
+  "  </Constitutive>\n"
+  "  <FieldSpecifications>\n"
+  "    <FieldSpecification name=\"initialPressure\"\n"
+  "               initialCondition=\"1\"\n"
+  "               setNames=\"{all}\"\n"
+  "               objectPath=\"ElementRegions/region/cb1\"\n"
+  "               fieldName=\"pressure\"\n"
+  "               functionName=\"initialPressureFunc\"\n"
+  "               scale=\"5e6\"/>\n"
+  "    <FieldSpecification name=\"initialComposition_N2\"\n"
+  "               initialCondition=\"1\"\n"
+  "               setNames=\"{all}\"\n"
+  "               objectPath=\"ElementRegions/region/cb1\"\n"
+  "               fieldName=\"globalCompFraction\"\n"
+  "               component=\"0\"\n"
+  "               scale=\"0.099\"/>\n"
+  "    <FieldSpecification name=\"initialComposition_C10\"\n"
+  "               initialCondition=\"1\"\n"
+  "               setNames=\"{all}\"\n"
+  "               objectPath=\"ElementRegions/region/cb1\"\n"
+  "               fieldName=\"globalCompFraction\"\n"
+  "               component=\"1\"\n"
+  "               scale=\"0.3\"/>\n"
+  "    <FieldSpecification name=\"initialComposition_C20\"\n"
+  "               initialCondition=\"1\"\n"
+  "               setNames=\"{all}\"\n"
+  "               objectPath=\"ElementRegions/region/cb1\"\n"
+  "               fieldName=\"globalCompFraction\"\n"
+  "               component=\"2\"\n"
+  "               scale=\"0.6\"/>\n"
+  "    <FieldSpecification name=\"initialComposition_H20\"\n"
+  "               initialCondition=\"1\"\n"
+  "               setNames=\"{all}\"\n"
+  "               objectPath=\"ElementRegions/region/cb1\"\n"
+  "               fieldName=\"globalCompFraction\"\n"
+  "               component=\"3\"\n"
+  "               scale=\"0.001\"/>\n"
+  "  </FieldSpecifications>\n"
+  "  <Functions>\n"
+  "    <TableFunction name=\"initialPressureFunc\"\n"
+  "                   inputVarNames=\"{elementCenter}\"\n"
+  "                   coordinates=\"{0.0, 3.0}\"\n"
+  "                   values=\"{1.0, 0.5}\"/>\n"
+  "  </Functions>"
+  "</Problem>";
+
+/**
+ * @brief Compute the mass of each component in the locally owned cells
+ * @param solver the flow solver
+ * @param domain the physical domain object
+ * @return the component masses, summed over all ranks
+ */
+array1d< real64 > computeComponentMasses( CompositionalMultiphaseFVM const & solver,
+                                          DomainPartition & domain )
+{
+  integer const numComp = solver.numFluidComponents();
+  array1d< real64 > compMass( numComp );
+
+  solver.forMeshTargets( domain.getMeshBodies(), [&]( string const &,
+                                                      MeshLevel & mesh,
+                                                      arrayView1d< string const > const & regionNames )
+  {
+    mesh.getElemManager().forElementSubRegions( regionNames,
+                                                [&]( localIndex const,
+                                                     ElementSubRegionBase & subRegion )
+    {
+      string const & solidName = subRegion.getReference< string >( CompositionalMultiphaseBase::viewKeyStruct::solidNamesString() );
+      CoupledSolidBase const & solid = subRegion.getConstitutiveModels().getGroup< CoupledSolidBase >( solidName );
+
+      arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+      arrayView1d< real64 const > const volume = subRegion.getElementVolume();
+      arrayView2d< real64 const > const porosity = solid.getPorosity();
+      arrayView2d< real64 const, compflow::USD_COMP > const compDens =
+        subRegion.getExtrinsicData< extrinsicMeshData::flow::globalCompDensity >();
+
+      ghostRank.move( LvArray::MemorySpace::host, false );
+      volume.move( LvArray::MemorySpace::host, false );
+      porosity.move( LvArray::MemorySpace::host, false );
+      compDens.move( LvArray::MemorySpace::host, false );
+
+      for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+      {
+        if( ghostRank[ei] < 0 )
+        {
+          for( integer ic = 0; ic < numComp; ++ic )
+          {
+            compMass[ic] += porosity[ei][0] * volume[ei] * compDens[ei][ic];
+          }
+        }
+      }
+    } );
+  } );
+
+  for( integer ic = 0; ic < numComp; ++ic )
+  {
+    compMass[ic] = MpiWrapper::sum( compMass[ic] );
+  }
+  return compMass;
+}
+
+TEST( CompositionalMultiphaseFlowIMPES, componentMassConservation )
+{
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  setupProblemFromXML( state.getProblemManager(), xmlInput );
+
+  CompositionalMultiphaseFVM & solver =
+    state.getProblemManager().getPhysicsSolverManager().getGroup< CompositionalMultiphaseFVM >( "compflow" );
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+
+  array1d< real64 > const compMassInitial = computeComponentMasses( solver, domain );
+
+  // the initial pressure gradient drives a flow through the closed domain
+  real64 const dt = 1e4;
+  real64 time = 0.0;
+  for( integer cycle = 0; cycle < 3; ++cycle )
+  {
+    time += solver.solverStep( time, dt, cycle, domain );
+  }
+
+  array1d< real64 > const compMass = computeComponentMasses( solver, domain );
+
+  // each component is conserved separately, including the last one which is not a row of the fully implicit system
+  for( integer ic = 0; ic < solver.numFluidComponents(); ++ic )
+  {
+    checkRelativeError( compMass[ic], compMassInitial[ic], 1e-10, 1e-20, "component mass " + std::to_string( ic ) );
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
@@ -0,0 +1,216 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "codingUtilities/UnitTestUtilities.hpp"
+#include "discretizationMethods/NumericalMethodsManager.hpp"
+#include "finiteVolume/FiniteVolumeManager.hpp"
+#include "finiteVolume/HybridMimeticDiscretization.hpp"
+#include "finiteVolume/MimeticInnerProductDispatch.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/fluidFlow/FlowSolverBaseExtrinsicData.hpp"
+#include "physicsSolvers/fluidFlow/SinglePhaseHybridFVM.hpp"
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+using namespace geosx;
+using namespace geosx::dataRepository;
+using namespace geosx::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+// A compressible single-phase flow with non-uniform cell and face pressures, so that all the fluxes are non-zero.
+// The inner product type is inserted in the HybridMimeticDiscretization.
+char const * xmlInputHead =
+  "<Problem>\n"
+  "  <Solvers gravityVector=\"{ 0.0, 0.0, -9.81 }\">\n"
+  "    <SinglePhaseHybridFVM name=\"flow\"\n"
+  "                          discretization=\"fluidHM\"\n"
+  "                          targetRegions=\"{region}\">\n"
+  "      <NonlinearSolverParameters newtonTol=\"1.0e-6\"\n"
+  "                                 newtonMaxIter=\"2\"/>\n"
+  "      <LinearSolverParameters solverType=\"direct\"/>\n"
+  "    </SinglePhaseHybridFVM>\n"
+  "  </Solvers>\n"
+  "  <Mesh>\n"
+  "    <InternalMesh name=\"mesh\"\n"
+  "                  elementTypes=\"{C3D8}\"\n"
+  "                  xCoords=\"{0, 1}\"\n"
+  "                  yCoords=\"{0, 2}\"\n"
+  "                  zCoords=\"{0, 10}\"\n"
+  "                  nx=\"{2}\"\n"
+  "                  ny=\"{2}\"\n"
+  "                  nz=\"{4}\"\n"
+  "                  cellBlockNames=\"{cb1}\"/>\n"
+  "  </Mesh>\n"
+  "  <NumericalMethods>\n"
+  "    <FiniteVolume>\n"
+  "      <HybridMimeticDiscretization name=\"fluidHM\"\n"
+  "                                   innerProductType=\"";
+
+char const * xmlInputTail =
+  "\"/>\n"
+  "    </FiniteVolume>\n"
+  "  </NumericalMethods>\n"
+  "  <ElementRegions>\n"
+  "    <CellElementRegion name=\"region\" cellBlocks=\"{cb1}\" materialList=\"{water, rock}\"/>\n"
+  "  </ElementRegions>\n"
+  "  <Constitutive>\n"
+  "    <CompressibleSinglePhaseFluid name=\"water\"\n"
+  "                                  defaultDensity=\"1000\"\n"
+  "                                  defaultViscosity=\"0.001\"\n"
+  "                                  referencePressure=\"0.0\"\n"
+  "                                  compressibility=\"5e-8\"\n"
+  "                                  viscosibility=\"5e-8\"/>\n"
+  "    <CompressibleSolidConstantPermeability name=\"rock\"\n"
+  "                                           solidModelName=\"nullSolid\"\n"
+  "                                           porosityModelName=\"rockPorosity\"\n"
+  "                                           permeabilityModelName=\"rockPerm\"/>\n"
+  "    <NullModel name=\"nullSolid\"/>\n"
+  "    <PressurePorosity name=\"rockPorosity\"\n"
+  "                      defaultReferencePorosity=\"0.05\"\n"
+  "                      referencePressure=\"0.0\"\n"
+  "                      compressibility=\"1.0e-9\"/>\n"
+  "    <ConstantPermeability name=\"rockPerm\"\n"
+  "                          permeabilityComponents=\"{2.0e-16, 1.0e-16, 3.0e-16}\"/>\n"
+  "  </Constitutive>\n"
+  "  <FieldSpecifications>\n"
+  "    <FieldSpecification name=\"initialPressure\"\n"
+  "                        initialCondition=\"1\"\n"
+  "                        setNames=\"{all}\"\n"
+  "                        objectPath=\"ElementRegions/region/cb1\"\n"
+  "                        fieldName=\"pressure\"\n"
+  "                        functionName=\"initialPressureFunc\"\n"
+  "                        scale=\"5e6\"/>\n"
+  "    <FieldSpecification name=\"initialFacePressure\"\n"
+  "                        initialCondition=\"1\"\n"
+  "                        setNames=\"{all}\"\n"
+  "                        objectPath=\"faceManager\"\n"
+  "                        fieldName=\"facePressure\"\n"
+  "                        functionName=\"initialFacePressureFunc\"\n"
+  "                        scale=\"5e6\"/>\n"
+  "  </FieldSpecifications>\n"
+  "  <Functions>\n"
+  "    <TableFunction name=\"initialPressureFunc\"\n"
+  "                   inputVarNames=\"{elementCenter}\"\n"
+  "                   coordinates=\"{0.0, 2.0, 4.0, 6.0, 8.0, 10.0 }\"\n"
+  "                   values=\"{ 1.0, 0.5, 0.2, 3.0, 2.1, 1.0 }\"/>\n"
+  "    <TableFunction name=\"initialFacePressureFunc\"\n"
+  "                   inputVarNames=\"{faceCenter}\"\n"
+  "                   coordinates=\"{0.0, 2.0, 4.0, 6.0, 8.0, 10.0 }\"\n"
+  "                   values=\"{ 2.0, 0.1, 0.2, 2.1, 2.1, 0.1 }\"/>\n"
+  "  </Functions>\n"
+  "</Problem>";
+
+/**
+ * @brief Check that the flux terms assembled with the stored transmissibility matrices match the on-the-fly ones
+ * @param innerProductType the type of inner product of the hybrid FVM discretization
+ */
+void testStoredTransMatrices( string const & innerProductType )
+{
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  string const xmlInput = string( xmlInputHead ) + innerProductType + xmlInputTail;
+  setupProblemFromXML( state.getProblemManager(), xmlInput.c_str() );
+
+  SinglePhaseHybridFVM & solver =
+    state.getProblemManager().getPhysicsSolverManager().getGroup< SinglePhaseHybridFVM >( "flow" );
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+  HybridMimeticDiscretization & hmDiscretization =
+    domain.getNumericalMethodManager().getFiniteVolumeManager().getHybridMimeticDiscretization( "fluidHM" );
+  CellElementSubRegion const & subRegion =
+    domain.getMeshBody( 0 ).getMeshLevel( 0 ).getElemManager().getRegion( "region" ).getSubRegion< CellElementSubRegion >( "cb1" );
+  array3d< real64 > const & transMatrix =
+    subRegion.getReference< array3d< real64 > >( extrinsicMeshData::flow::transMatrix::key() );
+
+  real64 const time = 0.0;
+  real64 const dt = 1e4;
+  solver.setupSystem( domain,
+                      solver.getDofManager(),
+                      solver.getLocalMatrix(),
+                      solver.getSystemRhs(),
+                      solver.getSystemSolution() );
+
+  CRSMatrix< real64, globalIndex > & jacobian = solver.getLocalMatrix();
+  array1d< real64 > residual( jacobian.numRows() );
+
+  // flux terms with the stored matrices
+  hmDiscretization.getReference< integer >( HybridMimeticDiscretization::viewKeyStruct::precomputeTransmissibilityString() ) = 1;
+  solver.implicitStepSetup( time, dt, domain );
+  ASSERT_EQ( transMatrix.size( 1 ), subRegion.numFacesPerElement() );
+
+  jacobian.zero();
+  residual.zero();
+  solver.assembleFluxTerms( time, dt, domain, solver.getDofManager(), jacobian.toViewConstSizes(), residual.toView() );
+  jacobian.move( LvArray::MemorySpace::host );
+  residual.move( LvArray::MemorySpace::host, false );
+  CRSMatrix< real64, globalIndex > const jacobianStored( jacobian );
+  array1d< real64 > const residualStored( residual );
+
+  // flux terms with the matrices computed in the flux kernel
+  hmDiscretization.getReference< integer >( HybridMimeticDiscretization::viewKeyStruct::precomputeTransmissibilityString() ) = 0;
+  solver.implicitStepSetup( time, dt, domain );
+  ASSERT_EQ( transMatrix.size( 1 ), 0 );
+
+  jacobian.zero();
+  residual.zero();
+  solver.assembleFluxTerms( time, dt, domain, solver.getDofManager(), jacobian.toViewConstSizes(), residual.toView() );
+  jacobian.move( LvArray::MemorySpace::host );
+  residual.move( LvArray::MemorySpace::host, false );
+
+  real64 maxResidual = 0.0;
+  for( localIndex i = 0; i < residual.size(); ++i )
+  {
+    maxResidual = LvArray::math::max( maxResidual, LvArray::math::abs( residual[i] ) );
+  }
+  ASSERT_GT( maxResidual, 0.0 );
+  for( localIndex i = 0; i < residual.size(); ++i )
+  {
+    checkRelativeError( residualStored[i], residual[i], 1e-12, 1e-12 * maxResidual );
+  }
+  compareLocalMatrices( jacobianStored.toViewConst(), jacobian.toViewConst(), 1e-12 );
+}
+
+TEST( SinglePhaseHybridFlow, storedTransMatrices_TPFA )
+{
+  testStoredTransMatrices( mimeticInnerProduct::MimeticInnerProductTypeStrings::TPFA );
+}
+
+TEST( SinglePhaseHybridFlow, storedTransMatrices_quasiTPFA )
+{
+  testStoredTransMatrices( mimeticInnerProduct::MimeticInnerProductTypeStrings::QuasiTPFA );
+}
+
+TEST( SinglePhaseHybridFlow, storedTransMatrices_quasiRT )
+{
+  testStoredTransMatrices( mimeticInnerProduct::MimeticInnerProductTypeStrings::QuasiRT );
+}
+
+TEST( SinglePhaseHybridFlow, storedTransMatrices_simple )
+{
+  testStoredTransMatrices( mimeticInnerProduct::MimeticInnerProductTypeStrings::Simple );
+}
+
+TEST( SinglePhaseHybridFlow, storedTransMatrices_beiraoDaVeigaLipnikovManzini )
+{
+  testStoredTransMatrices( mimeticInnerProduct::MimeticInnerProductTypeStrings::BdVLM );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
@@ -0,0 +1,307 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/fluidFlow/FlowSolverBaseExtrinsicData.hpp"
+#include "physicsSolvers/fluidFlow/SinglePhaseFVM.hpp"
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+using namespace geosx;
+using namespace geosx::dataRepository;
+using namespace geosx::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+// A compressible single-phase flow between a source and a sink, where the density and the viscosity depend
+// exponentially on the pressure. The options of the nonlinear and linear solvers are inserted in the
+// NonlinearSolverParameters and LinearSolverParameters.
+char const * xmlInputHead =
+  "<Problem>\n"
+  "  <Solvers gravityVector=\"{ 0.0, 0.0, 0.0 }\">\n"
+  "    <SinglePhaseFVM name=\"flow\"\n"
+  "                    discretization=\"tpfa\"\n"
+  "                    targetRegions=\"{region}\">\n"
+  "      <NonlinearSolverParameters newtonTol=\"1.0e-8\"\n"
+  "                                 newtonMaxIter=\"40\"\n"
+  "                                 maxTimeStepCuts=\"0\"\n";
+
+char const * xmlInputMiddle =
+  "      />\n"
+  "      <LinearSolverParameters ";
+
+char const * xmlInputTail =
+  "/>\n"
+  "    </SinglePhaseFVM>\n"
+  "  </Solvers>\n"
+  "  <Mesh>\n"
+  "    <InternalMesh name=\"mesh\"\n"
+  "                  elementTypes=\"{C3D8}\"\n"
+  "                  xCoords=\"{0, 10}\"\n"
+  "                  yCoords=\"{0, 1}\"\n"
+  "                  zCoords=\"{0, 1}\"\n"
+  "                  nx=\"{10}\"\n"
+  "                  ny=\"{1}\"\n"
+  "                  nz=\"{1}\"\n"
+  "                  cellBlockNames=\"{cb1}\"/>\n"
+  "  </Mesh>\n"
+  "  <Geometry>\n"
+  "    <Box name=\"source\" xMin=\"{ -0.01, -0.01, -0.01 }\" xMax=\"{ 1.01, 1.01, 1.01 }\"/>\n"
+  "    <Box name=\"sink\" xMin=\"{ 8.99, -0.01, -0.01 }\" xMax=\"{ 10.01, 1.01, 1.01 }\"/>\n"
+  "  </Geometry>\n"
+  "  <NumericalMethods>\n"
+  "    <FiniteVolume>\n"
+  "      <TwoPointFluxApproximation name=\"tpfa\"/>\n"
+  "    </FiniteVolume>\n"
+  "  </NumericalMethods>\n"
+  "  <ElementRegions>\n"
+  "    <CellElementRegion name=\"region\" cellBlocks=\"{cb1}\" materialList=\"{water, rock}\"/>\n"
+  "  </ElementRegions>\n"
+  "  <Constitutive>\n"
+  "    <CompressibleSinglePhaseFluid name=\"water\"\n"
+  "                                  defaultDensity=\"1000\"\n"
+  "                                  defaultViscosity=\"0.001\"\n"
+  "                                  referencePressure=\"0.0\"\n"
+  "                                  compressibility=\"5e-8\"\n"
+  "                                  viscosibility=\"5e-8\"/>\n"
+  "    <CompressibleSolidConstantPermeability name=\"rock\"\n"
+  "                                           solidModelName=\"nullSolid\"\n"
+  "                                           porosityModelName=\"rockPorosity\"\n"
+  "                                           permeabilityModelName=\"rockPerm\"/>\n"
+  "    <NullModel name=\"nullSolid\"/>\n"
+  "    <PressurePorosity name=\"rockPorosity\"\n"
+  "                      defaultReferencePorosity=\"0.05\"\n"
+  "                      referencePressure=\"0.0\"\n"
+  "                      compressibility=\"1.0e-9\"/>\n"
+  "    <ConstantPermeability name=\"rockPerm\"\n"
+  "                          permeabilityComponents=\"{2.0e-16, 2.0e-16, 2.0e-16}\"/>\n"
+  "  </Constitutive>\n"
+  "  <FieldSpecifications>\n"
+  "    <FieldSpecification name=\"initialPressure\"\n"
+  "                        initialCondition=\"1\"\n"
+  "                        setNames=\"{all}\"\n"
+  "                        objectPath=\"ElementRegions/region/cb1\"\n"
+  "                        fieldName=\"pressure\"\n"
+  "                        scale=\"0.0\"/>\n"
+  "    <FieldSpecification name=\"sourceTerm\"\n"
+  "                        objectPath=\"ElementRegions/region/cb1\"\n"
+  "                        fieldName=\"pressure\"\n"
+  "                        scale=\"5e6\"\n"
+  "                        setNames=\"{source}\"/>\n"
+  "    <FieldSpecification name=\"sinkTerm\"\n"
+  "                        objectPath=\"ElementRegions/region/cb1\"\n"
+  "                        fieldName=\"pressure\"\n"
+  "                        scale=\"-5e6\"\n"
+  "                        setNames=\"{sink}\"/>\n"
+  "  </FieldSpecifications>\n"
+  "</Problem>";
+
+/// Outcome of a run
+struct RunResult
+{
+  /// the pressure of the local cells at the end of the run
+  array1d< real64 > pressure;
+  /// whether every step converged without time step cut
+  bool converged = true;
+  /// the total number of Newton iterations
+  integer numNewtonIterations = 0;
+  /// the number of Newton iterations since the beginning of the run, at the end of each step
+  array1d< integer > stepTotalNewtonIterations;
+  /// the number of linear solves since the last preconditioner setup at the end of each step
+  array1d< integer > stepPrecondNumSolves;
+};
+
+/**
+ * @brief Run a few time steps of the problem
+ * @param nonlinearOptions attributes added to the NonlinearSolverParameters
+ * @param linearOptions attributes of the LinearSolverParameters
+ * @return the outcome of the run
+ */
+RunResult runSinglePhase( string const & nonlinearOptions,
+                          string const & linearOptions = "solverType=\"direct\"" )
+{
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  string const xmlInput = string( xmlInputHead ) + nonlinearOptions + xmlInputMiddle + linearOptions + xmlInputTail;
+  setupProblemFromXML( state.getProblemManager(), xmlInput.c_str() );
+
+  SolverBase & solver = state.getProblemManager().getPhysicsSolverManager().getGroup< SolverBase >( "flow" );
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+
+  RunResult result;
+  real64 const dt = 1e5;
+  real64 time = 0.0;
+  for( integer cycle = 0; cycle < 3; ++cycle )
+  {
+    real64 const dtReturn = solver.solverStep( time, dt, cycle, domain );
+    result.converged = result.converged && isEqual( dtReturn, dt );
+    result.numNewtonIterations += solver.getNonlinearSolverParameters().m_numNewtonIterations;
+    result.stepTotalNewtonIterations.emplace_back( result.numNewtonIterations );
+    result.stepPrecondNumSolves.emplace_back( solver.numSolvesSincePreconditionerSetup() );
+    time += dt;
+  }
+
+  ElementSubRegionBase const & subRegion =
+    domain.getMeshBody( 0 ).getMeshLevel( 0 ).getElemManager().getRegion( "region" ).getSubRegion( "cb1" );
+  arrayView1d< real64 const > const pres = subRegion.getExtrinsicData< extrinsicMeshData::flow::pressure >();
+  pres.move( LvArray::MemorySpace::host, false );
+  result.pressure.resize( pres.size() );
+  for( localIndex ei = 0; ei < pres.size(); ++ei )
+  {
+    result.pressure[ei] = pres[ei];
+  }
+  return result;
+}
+
+/**
+ * @brief Check that a run converged to the solution of the reference run
+ * @param result the outcome of the run
+ * @param reference the outcome of the reference run
+ */
+void checkSameSolution( RunResult const & result, RunResult const & reference )
+{
+  EXPECT_TRUE( result.converged );
+  ASSERT_EQ( result.pressure.size(), reference.pressure.size() );
+  for( localIndex ei = 0; ei < reference.pressure.size(); ++ei )
+  {
+    checkRelativeError( result.pressure[ei], reference.pressure[ei], 1e-6, 1.0 );
+  }
+}
+
+TEST( SinglePhaseNonlinearSolver, nonlinearPreconditioner )
+{
+  RunResult const reference = runSinglePhase( "" );
+  EXPECT_TRUE( reference.converged );
+
+  RunResult const result = runSinglePhase( "nonlinearPreconditioner=\"NonlinearBlockJacobi\"\n"
+                                           "subdomainMaxIter=\"3\"\n"
+                                           "subdomainTol=\"0.1\"\n" );
+  checkSameSolution( result, reference );
+}
+
+TEST( SinglePhaseNonlinearSolver, jacobianFree )
+{
+  RunResult const reference = runSinglePhase( "" );
+  EXPECT_TRUE( reference.converged );
+
+  // The state is restored after each residual evaluation, and the default finite-difference step is relative
+  // to the pressure of a few MPa, so the Newton iterations converge to the same solution
+  RunResult const result = runSinglePhase( "jacobianFree=\"1\"\n",
+                                           "solverType=\"gmres\"\n"
+                                           "krylovTol=\"1.0e-10\"\n"
+                                           "preconditionerType=\"iluk\"" );
+  checkSameSolution( result, reference );
+}
+
+TEST( SinglePhaseNonlinearSolver, jacobianLagging )
+{
+  RunResult const reference = runSinglePhase( "" );
+  EXPECT_TRUE( reference.converged );
+
+  // the factorization of the lagged Jacobian is reused by the direct solver
+  RunResult const result = runSinglePhase( "jacobianUpdateInterval=\"3\"\n" );
+  checkSameSolution( result, reference );
+
+  // the preconditioner of the lagged Jacobian is reused by the iterative solver
+  RunResult const resultIterative = runSinglePhase( "jacobianUpdateInterval=\"3\"\n",
+                                                    "solverType=\"gmres\"\n"
+                                                    "krylovTol=\"1.0e-10\"\n"
+                                                    "preconditionerType=\"iluk\"" );
+  checkSameSolution( resultIterative, reference );
+}
+
+TEST( SinglePhaseNonlinearSolver, broydenUpdate )
+{
+  RunResult const reference = runSinglePhase( "" );
+  EXPECT_TRUE( reference.converged );
+
+  // the lagged Jacobian is kept as long as the residual decreases, so that the rank-one corrections are applied
+  RunResult const result = runSinglePhase( "jacobianUpdateInterval=\"3\"\n"
+                                           "jacobianContractionLimit=\"1.0\"\n"
+                                           "broydenUpdate=\"1\"\n" );
+  checkSameSolution( result, reference );
+}
+
+/**
+ * @brief Run the problem with an iterative solver and a preconditioner reuse policy
+ * @param reuseOptions attributes added to the LinearSolverParameters
+ * @return the outcome of the run
+ */
+RunResult runWithPrecondReuse( string const & reuseOptions )
+{
+  return runSinglePhase( "", "solverType=\"gmres\"\n"
+                             "krylovTol=\"1.0e-10\"\n"
+                             "preconditionerType=\"iluk\"\n" + reuseOptions );
+}
+
+TEST( SinglePhaseNonlinearSolver, precondReuseNone )
+{
+  RunResult const reference = runSinglePhase( "" );
+
+  // no persistent preconditioner is kept, each solve sets up its own
+  RunResult const result = runWithPrecondReuse( "precondReusePolicy=\"none\"" );
+  checkSameSolution( result, reference );
+  for( localIndex step = 0; step < result.stepPrecondNumSolves.size(); ++step )
+  {
+    EXPECT_EQ( result.stepPrecondNumSolves[step], 0 );
+  }
+}
+
+TEST( SinglePhaseNonlinearSolver, precondReuseFixed )
+{
+  RunResult const reference = runSinglePhase( "" );
+
+  // the sparsity pattern rebuilt at each step is unchanged, so that the preconditioner is set up once per run
+  RunResult const result = runWithPrecondReuse( "precondReusePolicy=\"fixed\"\n"
+                                                "precondReuseMaxSolves=\"100\"" );
+  checkSameSolution( result, reference );
+  for( localIndex step = 0; step < result.stepPrecondNumSolves.size(); ++step )
+  {
+    EXPECT_EQ( result.stepPrecondNumSolves[step], result.stepTotalNewtonIterations[step] );
+  }
+
+  // every second solve sets up the preconditioner again, across the steps
+  RunResult const resultTwoSolves = runWithPrecondReuse( "precondReusePolicy=\"fixed\"\n"
+                                                         "precondReuseMaxSolves=\"2\"" );
+  checkSameSolution( resultTwoSolves, reference );
+  for( localIndex step = 0; step < resultTwoSolves.stepPrecondNumSolves.size(); ++step )
+  {
+    ASSERT_GT( resultTwoSolves.stepTotalNewtonIterations[step], 0 );
+    EXPECT_EQ( resultTwoSolves.stepPrecondNumSolves[step], ( resultTwoSolves.stepTotalNewtonIterations[step] - 1 ) % 2 + 1 );
+  }
+}
+
+TEST( SinglePhaseNonlinearSolver, precondReuseAdaptive )
+{
+  RunResult const reference = runSinglePhase( "" );
+
+  // all the solves converge, and the iteration count cannot grow by a factor 100 on this small problem
+  RunResult const result = runWithPrecondReuse( "precondReusePolicy=\"adaptive\"\n"
+                                                "precondReuseMaxSolves=\"100\"\n"
+                                                "precondReuseIterGrowth=\"100\"" );
+  checkSameSolution( result, reference );
+  for( localIndex step = 0; step < result.stepPrecondNumSolves.size(); ++step )
+  {
+    EXPECT_EQ( result.stepPrecondNumSolves[step], result.stepTotalNewtonIterations[step] );
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
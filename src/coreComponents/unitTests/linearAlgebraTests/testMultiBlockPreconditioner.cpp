@@ -0,0 +1,286 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file testMultiBlockPreconditioner.cpp
+ */
+
+#include "common/DataTypes.hpp"
+#include "linearAlgebra/DofManager.hpp"
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "linearAlgebra/solvers/KrylovSolver.hpp"
+#include "linearAlgebra/solvers/MultiBlockPreconditioner.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "unitTests/linearAlgebraTests/testDofManagerUtils.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace geosx;
+
+char const * xmlInput =
+  "<Problem>"
+  "  <Mesh>"
+  "    <InternalMesh name=\"mesh1\""
+  "                  elementTypes=\"{C3D8}\""
+  "                  xCoords=\"{0, 1}\""
+  "                  yCoords=\"{0, 1}\""
+  "                  zCoords=\"{0, 1}\""
+  "                  nx=\"{6}\""
+  "                  ny=\"{5}\""
+  "                  nz=\"{4}\""
+  "                  cellBlockNames=\"{block1}\"/>"
+  "  </Mesh>"
+  "  <ElementRegions>"
+  "    <CellElementRegion name=\"region1\" cellBlocks=\"{block1}\" materialList=\"{dummy}\" />"
+  "  </ElementRegions>"
+  "</Problem>";
+
+/// Couplings between the fields of the test operator
+enum class Coupling
+{
+  None,  ///< block diagonal operator
+  Lower, ///< field i only depends on fields j < i
+  Upper, ///< field i only depends on fields j > i
+  Full   ///< every field depends on every other field
+};
+
+template< typename LAI >
+class MultiBlockPreconditionerTest : public ::testing::Test
+{
+protected:
+
+  using Base = ::testing::Test;
+  using Matrix = typename LAI::ParallelMatrix;
+  using Vector = typename LAI::ParallelVector;
+
+  MultiBlockPreconditionerTest():
+    Base(),
+    state( std::make_unique< CommandLineOptions >() ),
+    dofManager( "test" )
+  {
+    geosx::testing::setupProblemFromXML( &state.getProblemManager(), xmlInput );
+  }
+
+  void SetUp() override
+  {
+    DomainPartition & domain = state.getProblemManager().getDomainPartition();
+    dofManager.setDomain( domain );
+
+    std::vector< DofManager::Regions > regions;
+    regions.push_back( { "mesh1", "Level0", { "region1" } } );
+    for( string const & field : fields )
+    {
+      dofManager.addField( field, DofManager::Location::Elem, 1, regions );
+      dofManager.addCoupling( field, field, DofManager::Connector::Face );
+    }
+    dofManager.reorderByRank();
+  }
+
+  /**
+   * @brief Assemble an operator made of a tridiagonal block per field, coupled cell by cell to the other fields.
+   * @param coupling the couplings between fields
+   * @param mat the output matrix
+   *
+   * The diagonal blocks only couple rank-local rows, so that the direct inner solvers are exact.
+   */
+  void computeOperator( Coupling const coupling, Matrix & mat ) const
+  {
+    localIndex const numFields = LvArray::integerConversion< localIndex >( fields.size() );
+
+    CRSMatrix< real64, globalIndex > localMatrix( dofManager.numLocalDofs(), dofManager.numGlobalDofs(), 2 + numFields );
+    for( localIndex f = 0; f < numFields; ++f )
+    {
+      localIndex const numLocal = dofManager.numLocalDofs( fields[f] );
+      globalIndex const rowOffset = dofManager.globalOffset( fields[f] );
+      localIndex const localOffset = LvArray::integerConversion< localIndex >( rowOffset - dofManager.rankOffset() );
+
+      for( localIndex i = 0; i < numLocal; ++i )
+      {
+        localIndex const localRow = localOffset + i;
+        localMatrix.insertNonZero( localRow, rowOffset + i, 4.0 + f );
+        if( i > 0 )
+        {
+          localMatrix.insertNonZero( localRow, rowOffset + i - 1, -1.0 );
+        }
+        if( i < numLocal - 1 )
+        {
+          localMatrix.insertNonZero( localRow, rowOffset + i + 1, -1.0 );
+        }
+
+        for( localIndex g = 0; g < numFields; ++g )
+        {
+          bool const coupled = ( g < f && ( coupling == Coupling::Lower || coupling == Coupling::Full ) ) ||
+                               ( g > f && ( coupling == Coupling::Upper || coupling == Coupling::Full ) );
+          if( coupled )
+          {
+            // every field has one dof per cell, so the same cell has the same local index in all fields
+            localMatrix.insertNonZero( localRow, dofManager.globalOffset( fields[g] ) + i, 0.5 );
+          }
+        }
+      }
+    }
+
+    mat.create( localMatrix.toViewConst(), dofManager.numLocalDofs(), MPI_COMM_GEOSX );
+    mat.setDofManager( &dofManager );
+  }
+
+  /**
+   * @brief Create a preconditioner with one exact (direct) inner solver per field.
+   * @param shapeOption block shape
+   * @param schurOption Schur complement approximation
+   * @param scalingOption block scaling
+   * @return the preconditioner
+   */
+  std::unique_ptr< MultiBlockPreconditioner< LAI > > createPreconditioner( BlockShapeOption const shapeOption,
+                                                                           SchurComplementOption const schurOption,
+                                                                           BlockScalingOption const scalingOption ) const
+  {
+    localIndex const numFields = LvArray::integerConversion< localIndex >( fields.size() );
+    auto precond = std::make_unique< MultiBlockPreconditioner< LAI > >( numFields, shapeOption, schurOption, scalingOption );
+
+    LinearSolverParameters directParams;
+    directParams.preconditionerType = LinearSolverParameters::PreconditionerType::direct;
+    for( localIndex f = 0; f < numFields; ++f )
+    {
+      // the last block is left empty to test the default selection of remaining components
+      std::vector< DofManager::SubComponent > blockDofs;
+      if( f < numFields - 1 )
+      {
+        blockDofs.push_back( { fields[f], { 1, true } } );
+      }
+      precond->setupBlock( f, std::move( blockDofs ), LAI::createPreconditioner( directParams ) );
+    }
+    return precond;
+  }
+
+  /**
+   * @brief Check that a preconditioner is the exact inverse of the operator it was set up with.
+   * @param coupling the couplings between fields
+   * @param shapeOption block shape
+   */
+  void testExactInverse( Coupling const coupling, BlockShapeOption const shapeOption )
+  {
+    Matrix mat;
+    computeOperator( coupling, mat );
+
+    std::unique_ptr< MultiBlockPreconditioner< LAI > > const precond =
+      createPreconditioner( shapeOption, SchurComplementOption::None, BlockScalingOption::None );
+    precond->setup( mat );
+
+    Vector solTrue;
+    solTrue.create( mat.numLocalCols(), MPI_COMM_GEOSX );
+    solTrue.rand( 1984 );
+    Vector rhs;
+    rhs.create( mat.numLocalRows(), MPI_COMM_GEOSX );
+    mat.apply( solTrue, rhs );
+
+    Vector solComp;
+    solComp.create( mat.numLocalCols(), MPI_COMM_GEOSX );
+    precond->apply( rhs, solComp );
+
+    solComp.axpy( -1.0, solTrue );
+    EXPECT_LT( solComp.norm2() / solTrue.norm2(), 1e-12 );
+  }
+
+  GeosxState state;
+  DofManager dofManager;
+  std::vector< string > const fields{ "field0", "field1", "field2" };
+};
+
+TYPED_TEST_SUITE_P( MultiBlockPreconditionerTest );
+
+TYPED_TEST_P( MultiBlockPreconditionerTest, DiagonalIsExactForUncoupledFields )
+{
+  this->testExactInverse( Coupling::None, BlockShapeOption::Diagonal );
+}
+
+TYPED_TEST_P( MultiBlockPreconditionerTest, LowerTriangularIsExactForLowerCoupling )
+{
+  this->testExactInverse( Coupling::Lower, BlockShapeOption::LowerTriangular );
+}
+
+TYPED_TEST_P( MultiBlockPreconditionerTest, UpperTriangularIsExactForUpperCoupling )
+{
+  this->testExactInverse( Coupling::Upper, BlockShapeOption::UpperTriangular );
+}
+
+TYPED_TEST_P( MultiBlockPreconditionerTest, GMRESWithSchurComplements )
+{
+  using Matrix = typename TypeParam::ParallelMatrix;
+  using Vector = typename TypeParam::ParallelVector;
+
+  Matrix mat;
+  this->computeOperator( Coupling::Full, mat );
+
+  std::unique_ptr< MultiBlockPreconditioner< TypeParam > > const precond =
+    this->createPreconditioner( BlockShapeOption::LowerUpperTriangular,
+                                SchurComplementOption::FirstBlockDiagonal,
+                                BlockScalingOption::FrobeniusNorm );
+  precond->setup( mat );
+
+  // a second setup with new values must reuse the block layout
+  mat.scale( 2.0 );
+  precond->setup( mat );
+
+  Vector solTrue;
+  solTrue.create( mat.numLocalCols(), MPI_COMM_GEOSX );
+  solTrue.rand( 1984 );
+  Vector rhs;
+  rhs.create( mat.numLocalRows(), MPI_COMM_GEOSX );
+  mat.apply( solTrue, rhs );
+
+  LinearSolverParameters params;
+  params.solverType = LinearSolverParameters::SolverType::gmres;
+  params.krylov.relTolerance = 1e-10;
+  params.krylov.maxIterations = 100;
+
+  Vector solComp;
+  solComp.create( mat.numLocalCols(), MPI_COMM_GEOSX );
+  solComp.zero();
+  std::unique_ptr< KrylovSolver< Vector > > const solver = KrylovSolver< Vector >::create( params, mat, *precond );
+  solver->solve( rhs, solComp );
+  EXPECT_TRUE( solver->result().success() );
+
+  solComp.axpy( -1.0, solTrue );
+  EXPECT_LT( solComp.norm2() / solTrue.norm2(), 1e-8 );
+}
+
+REGISTER_TYPED_TEST_SUITE_P( MultiBlockPreconditionerTest,
+                             DiagonalIsExactForUncoupledFields,
+                             LowerTriangularIsExactForLowerCoupling,
+                             UpperTriangularIsExactForUpperCoupling,
+                             GMRESWithSchurComplements );
+
+#ifdef GEOSX_USE_TRILINOS
+INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, MultiBlockPreconditionerTest, TrilinosInterface, );
+#endif
+
+#ifdef GEOSX_USE_HYPRE
+INSTANTIATE_TYPED_TEST_SUITE_P( Hypre, MultiBlockPreconditionerTest, HypreInterface, );
+#endif
+
+#ifdef GEOSX_USE_PETSC
+INSTANTIATE_TYPED_TEST_SUITE_P( Petsc, MultiBlockPreconditionerTest, PetscInterface, );
+#endif
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
@@ -0,0 +1,167 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "mainInterface/initialization.hpp"
+#include "physicsSolvers/FixedPointAccelerator.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace geosx;
+
+namespace
+{
+
+/// Size of the linear contraction
+localIndex constexpr n = 3;
+
+/// Linear contraction G(x) = A x + b (spectral radius below 1)
+real64 const A[n][n] = { { 0.5, 0.1, 0.0 },
+                         { 0.0, 0.3, 0.2 },
+                         { 0.1, 0.0, -0.2 } };
+real64 const b[n] = { 1.0, -2.0, 0.5 };
+
+/**
+ * @brief Apply one fixed-point sweep in place, x = G(x)
+ * @param x the iterate
+ */
+void applyContraction( arrayView1d< real64 > const & x )
+{
+  real64 y[n];
+  for( localIndex i = 0; i < n; ++i )
+  {
+    y[i] = b[i];
+    for( localIndex j = 0; j < n; ++j )
+    {
+      y[i] += A[i][j] * x[j];
+    }
+  }
+  for( localIndex i = 0; i < n; ++i )
+  {
+    x[i] = y[i];
+  }
+}
+
+/**
+ * @brief Compute the distance to the fixed point, solving (I - A) x = b by Cramer's rule
+ * @param x the iterate
+ * @return the maximum norm of the error
+ */
+real64 errorToFixedPoint( arrayView1d< real64 const > const & x )
+{
+  real64 M[n][n];
+  for( localIndex i = 0; i < n; ++i )
+  {
+    for( localIndex j = 0; j < n; ++j )
+    {
+      M[i][j] = ( i == j ? 1.0 : 0.0 ) - A[i][j];
+    }
+  }
+  auto const det = [&]( localIndex const col, bool const replace )
+  {
+    auto const m = [&]( localIndex const i, localIndex const j ){ return ( replace && j == col ) ? b[i] : M[i][j]; };
+    return m( 0, 0 ) * ( m( 1, 1 ) * m( 2, 2 ) - m( 1, 2 ) * m( 2, 1 ) )
+           - m( 0, 1 ) * ( m( 1, 0 ) * m( 2, 2 ) - m( 1, 2 ) * m( 2, 0 ) )
+           + m( 0, 2 ) * ( m( 1, 0 ) * m( 2, 1 ) - m( 1, 1 ) * m( 2, 0 ) );
+  };
+  real64 const detM = det( 0, false );
+
+  real64 error = 0.0;
+  for( localIndex i = 0; i < n; ++i )
+  {
+    error = LvArray::math::max( error, LvArray::math::abs( x[i] - det( i, true ) / detM ) );
+  }
+  return error;
+}
+
+/**
+ * @brief Run an accelerated fixed-point iteration on the linear contraction
+ * @param accelerator the accelerator
+ * @param numIterations number of accelerated sweeps
+ * @return the distance to the fixed point after each sweep
+ */
+array1d< real64 > runAccelerated( FixedPointAccelerator & accelerator,
+                                  integer const numIterations )
+{
+  array1d< real64 > x( n );
+  array1d< integer > ghostRank( n );
+  ghostRank.setValues< serialPolicy >( -1 );
+
+  accelerator.reset( x.toViewConst() );
+
+  array1d< real64 > errors( numIterations );
+  for( integer k = 0; k < numIterations; ++k )
+  {
+    applyContraction( x.toView() );
+    accelerator.accelerate( x.toView(), ghostRank.toViewConst() );
+    errors[k] = errorToFixedPoint( x.toViewConst() );
+  }
+  return errors;
+}
+
+} // namespace
+
+TEST( FixedPointAccelerator, noAccelerationIsPicard )
+{
+  FixedPointAccelerator accelerator( FixedPointAccelerator::Type::None, 1, 1.0 );
+  array1d< real64 > const errors = runAccelerated( accelerator, 10 );
+
+  // plain fixed-point iterations converge linearly, not in a finite number of steps
+  for( integer k = 1; k < errors.size(); ++k )
+  {
+    EXPECT_LT( errors[k], errors[k - 1] );
+  }
+  EXPECT_GT( errors[errors.size() - 1], 1.0e-8 );
+}
+
+TEST( FixedPointAccelerator, andersonConvergesInWindowPlusOneIterations )
+{
+  // With a window as large as the problem, Anderson mixing is equivalent to GMRES on (I - A) x = b:
+  // the combination of the last m iterates is exact after m = n sweeps, and one more sweep returns the fixed point
+  integer const windowSize = LvArray::integerConversion< integer >( n );
+  FixedPointAccelerator accelerator( FixedPointAccelerator::Type::Anderson, windowSize, 1.0 );
+  array1d< real64 > const errors = runAccelerated( accelerator, windowSize + 1 );
+
+  EXPECT_GT( errors[0], 1.0e-2 );
+  EXPECT_LT( errors[windowSize], 1.0e-10 );
+  EXPECT_EQ( accelerator.numIterations(), windowSize + 1 );
+}
+
+TEST( FixedPointAccelerator, aitkenIsExactForScalarContraction )
+{
+  // For a scalar linear map, the Aitken relaxation factor is the secant step, which is exact
+  FixedPointAccelerator accelerator( FixedPointAccelerator::Type::Aitken, 1, 0.5 );
+
+  array1d< real64 > x( 1 );
+  array1d< integer > ghostRank( 1 );
+  ghostRank.setValues< serialPolicy >( -1 );
+  accelerator.reset( x.toViewConst() );
+
+  real64 const a = 0.8;
+  real64 const c = 2.0;
+  for( integer k = 0; k < 2; ++k )
+  {
+    x[0] = a * x[0] + c;
+    accelerator.accelerate( x.toView(), ghostRank.toViewConst() );
+  }
+  EXPECT_NEAR( x[0], c / ( 1.0 - a ), 1.0e-12 );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
@@ -0,0 +1,367 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "codingUtilities/UnitTestUtilities.hpp"
+#include "common/MpiWrapper.hpp"
+#include "common/Path.hpp"
+#include "fileIO/Outputs/OutputBase.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/fluidFlow/FlowSolverBaseExtrinsicData.hpp"
+#include "physicsSolvers/fluidFlow/SinglePhaseFVM.hpp"
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+#include <gtest/gtest.h>
+#include <hdf5.h>
+
+using namespace geosx;
+using namespace geosx::dataRepository;
+using namespace geosx::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+// A compressible single-phase flow between a source and a sink, run for 8 steps of 1e5 s.
+// The maximum number of Parareal iterations and the time history events are inserted in the Events,
+// and the time history tasks and outputs at the end of the problem.
+char const * xmlInputHead =
+  "<Problem>\n"
+  "  <Solvers gravityVector=\"{ 0.0, 0.0, 0.0 }\">\n"
+  "    <SinglePhaseFVM name=\"flow\"\n"
+  "                    discretization=\"tpfa\"\n"
+  "                    targetRegions=\"{region}\">\n"
+  "      <NonlinearSolverParameters newtonTol=\"1.0e-10\"\n"
+  "                                 newtonMaxIter=\"40\"\n"
+  "                                 maxTimeStepCuts=\"0\"/>\n"
+  "      <LinearSolverParameters solverType=\"direct\"/>\n"
+  "    </SinglePhaseFVM>\n"
+  "  </Solvers>\n"
+  "  <Events maxTime=\"8e5\"\n"
+  "          pararealCoarseningFactor=\"2\"\n"
+  "          pararealTolerance=\"1e-14\"\n"
+  "          pararealMaxIterations=\"";
+
+char const * xmlInputTail =
+  "    <PeriodicEvent name=\"solverApplications\"\n"
+  "                   forceDt=\"1e5\"\n"
+  "                   target=\"/Solvers/flow\"/>\n"
+  "  </Events>\n"
+  "  <Mesh>\n"
+  "    <InternalMesh name=\"mesh\"\n"
+  "                  elementTypes=\"{C3D8}\"\n"
+  "                  xCoords=\"{0, 10}\"\n"
+  "                  yCoords=\"{0, 1}\"\n"
+  "                  zCoords=\"{0, 1}\"\n"
+  "                  nx=\"{10}\"\n"
+  "                  ny=\"{1}\"\n"
+  "                  nz=\"{1}\"\n"
+  "                  cellBlockNames=\"{cb1}\"/>\n"
+  "  </Mesh>\n"
+  "  <Geometry>\n"
+  "    <Box name=\"source\" xMin=\"{ -0.01, -0.01, -0.01 }\" xMax=\"{ 1.01, 1.01, 1.01 }\"/>\n"
+  "    <Box name=\"sink\" xMin=\"{ 8.99, -0.01, -0.01 }\" xMax=\"{ 10.01, 1.01, 1.01 }\"/>\n"
+  "  </Geometry>\n"
+  "  <NumericalMethods>\n"
+  "    <FiniteVolume>\n"
+  "      <TwoPointFluxApproximation name=\"tpfa\"/>\n"
+  "    </FiniteVolume>\n"
+  "  </NumericalMethods>\n"
+  "  <ElementRegions>\n"
+  "    <CellElementRegion name=\"region\" cellBlocks=\"{cb1}\" materialList=\"{water, rock}\"/>\n"
+  "  </ElementRegions>\n"
+  "  <Constitutive>\n"
+  "    <CompressibleSinglePhaseFluid name=\"water\"\n"
+  "                                  defaultDensity=\"1000\"\n"
+  "                                  defaultViscosity=\"0.001\"\n"
+  "                                  referencePressure=\"0.0\"\n"
+  "                                  compressibility=\"5e-8\"\n"
+  "                                  viscosibility=\"5e-8\"/>\n"
+  "    <CompressibleSolidConstantPermeability name=\"rock\"\n"
+  "                                           solidModelName=\"nullSolid\"\n"
+  "                                           porosityModelName=\"rockPorosity\"\n"
+  "                                           permeabilityModelName=\"rockPerm\"/>\n"
+  "    <NullModel name=\"nullSolid\"/>\n"
+  "    <PressurePorosity name=\"rockPorosity\"\n"
+  "                      defaultReferencePorosity=\"0.05\"\n"
+  "                      referencePressure=\"0.0\"\n"
+  "                      compressibility=\"1.0e-9\"/>\n"
+  "    <ConstantPermeability name=\"rockPerm\"\n"
+  "                          permeabilityComponents=\"{2.0e-16, 2.0e-16, 2.0e-16}\"/>\n"
+  "  </Constitutive>\n"
+  "  <FieldSpecifications>\n"
+  "    <FieldSpecification name=\"initialPressure\"\n"
+  "                        initialCondition=\"1\"\n"
+  "                        setNames=\"{all}\"\n"
+  "                        objectPath=\"ElementRegions/region/cb1\"\n"
+  "                        fieldName=\"pressure\"\n"
+  "                        scale=\"0.0\"/>\n"
+  "    <FieldSpecification name=\"sourceTerm\"\n"
+  "                        objectPath=\"ElementRegions/region/cb1\"\n"
+  "                        fieldName=\"pressure\"\n"
+  "                        scale=\"5e6\"\n"
+  "                        setNames=\"{source}\"/>\n"
+  "    <FieldSpecification name=\"sinkTerm\"\n"
+  "                        objectPath=\"ElementRegions/region/cb1\"\n"
+  "                        fieldName=\"pressure\"\n"
+  "                        scale=\"-5e6\"\n"
+  "                        setNames=\"{sink}\"/>\n"
+  "  </FieldSpecifications>\n";
+
+// The pressure is collected at the start of each step, before the solver event, and written at each step
+char const * xmlInputTimeHistoryEvents =
+  "    <PeriodicEvent name=\"pressureCollection\"\n"
+  "                   target=\"/Tasks/pressureCollection\"/>\n"
+  "    <PeriodicEvent name=\"timeHistoryOutput\"\n"
+  "                   target=\"/Outputs/timeHistoryOutput\"/>\n";
+
+char const * xmlInputTimeHistory =
+  "  <Tasks>\n"
+  "    <PackCollection name=\"pressureCollection\"\n"
+  "                    objectPath=\"ElementRegions/region/cb1\"\n"
+  "                    fieldName=\"pressure\"/>\n"
+  "  </Tasks>\n"
+  "  <Outputs>\n"
+  "    <TimeHistory name=\"timeHistoryOutput\"\n"
+  "                 sources=\"{/Tasks/pressureCollection}\"\n"
+  "                 filename=\"pararealPressureHistory\"/>\n"
+  "  </Outputs>\n";
+
+/// Name of the time history file, without the .hdf5 extension
+char const * timeHistoryFilename = "pararealPressureHistory";
+
+/// Number of fine steps of the whole run
+integer constexpr numSteps = 8;
+
+/// Fine timestep
+real64 constexpr fineDt = 1e5;
+
+/**
+ * @brief Build the input of the problem
+ * @param maxIterations the maximum number of Parareal iterations
+ * @param timeHistory whether the pressure is written to a time history file
+ * @return the XML input
+ */
+string buildXmlInput( integer const maxIterations, bool const timeHistory )
+{
+  return string( xmlInputHead ) + std::to_string( maxIterations ) + "\">\n" +
+         ( timeHistory ? xmlInputTimeHistoryEvents : "" ) + xmlInputTail +
+         ( timeHistory ? xmlInputTimeHistory : "" ) + "</Problem>";
+}
+
+/**
+ * @brief Copy the pressure of the local cells
+ * @param domain the domain partition
+ * @return the pressure
+ */
+array1d< real64 > getPressure( DomainPartition & domain )
+{
+  ElementSubRegionBase const & subRegion =
+    domain.getMeshBody( 0 ).getMeshLevel( 0 ).getElemManager().getRegion( "region" ).getSubRegion( "cb1" );
+  arrayView1d< real64 const > const pres = subRegion.getExtrinsicData< extrinsicMeshData::flow::pressure >();
+  pres.move( LvArray::MemorySpace::host, false );
+
+  array1d< real64 > pressure( pres.size() );
+  for( localIndex ei = 0; ei < pres.size(); ++ei )
+  {
+    pressure[ei] = pres[ei];
+  }
+  return pressure;
+}
+
+/**
+ * @brief Check that the Parareal run reproduces the sequential run at the end of the window of each time slice
+ * @param maxIterations the maximum number of Parareal iterations
+ */
+void testPararealMatchesSequential( integer const maxIterations )
+{
+  int const sliceSize = MpiWrapper::commSize( MPI_COMM_GEOSX );
+  int const numSlices = MpiWrapper::commSize( MPI_COMM_WORLD ) / sliceSize;
+  int const slice = MpiWrapper::commRank( MPI_COMM_WORLD ) / sliceSize;
+  ASSERT_EQ( numSlices, 2 );
+
+  string const xmlInput = buildXmlInput( maxIterations, false );
+
+  // sequential reference, computed on each time slice up to the end of its window
+  array1d< real64 > reference;
+  {
+    GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+    setupProblemFromXML( state.getProblemManager(), xmlInput.c_str() );
+
+    SolverBase & solver = state.getProblemManager().getPhysicsSolverManager().getGroup< SolverBase >( "flow" );
+    DomainPartition & domain = state.getProblemManager().getDomainPartition();
+
+    real64 time = 0.0;
+    for( integer cycle = 0; cycle < ( slice + 1 ) * numSteps / numSlices; ++cycle )
+    {
+      solver.execute( time, fineDt, cycle, 0, 0.0, domain );
+      time += fineDt;
+    }
+    reference = getPressure( domain );
+  }
+
+  // Parareal run: each time slice ends with the state at the end of its window
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  setupProblemFromXML( state.getProblemManager(), xmlInput.c_str() );
+  state.getProblemManager().runSimulation();
+
+  array1d< real64 > const pressure = getPressure( state.getProblemManager().getDomainPartition() );
+  ASSERT_EQ( pressure.size(), reference.size() );
+
+  real64 maxPressure = 0.0;
+  for( localIndex ei = 0; ei < reference.size(); ++ei )
+  {
+    maxPressure = LvArray::math::max( maxPressure, LvArray::math::abs( reference[ei] ) );
+  }
+  ASSERT_GT( maxPressure, 0.0 );
+  for( localIndex ei = 0; ei < reference.size(); ++ei )
+  {
+    checkRelativeError( pressure[ei], reference[ei], 1e-10, 1e-10 * maxPressure );
+  }
+}
+
+TEST( Parareal, matchesSequentialAfterOneIteration )
+{
+  // The first window start never changes, so that one iteration makes the second window start exact
+  testPararealMatchesSequential( 1 );
+}
+
+TEST( Parareal, matchesSequentialAfterNumSlicesIterations )
+{
+  testPararealMatchesSequential( 2 );
+}
+
+/**
+ * @brief Read a data set of a time history file
+ * @param fileId the HDF file id
+ * @param name the name of the data set
+ * @param dims the extents of the data set
+ * @return the values of the data set, in row-major order
+ */
+std::vector< real64 > readHistory( hid_t const fileId, string const & name, std::vector< hsize_t > & dims )
+{
+  hid_t const dataset = H5Dopen( fileId, name.c_str(), H5P_DEFAULT );
+  hid_t const space = H5Dget_space( dataset );
+  dims.resize( H5Sget_simple_extent_ndims( space ) );
+  H5Sget_simple_extent_dims( space, dims.data(), nullptr );
+
+  hsize_t size = 1;
+  for( hsize_t const extent : dims )
+  {
+    size *= extent;
+  }
+  std::vector< real64 > values( size );
+  H5Dread( dataset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, values.data() );
+
+  H5Sclose( space );
+  H5Dclose( dataset );
+  return values;
+}
+
+TEST( Parareal, mergesTimeHistoryOfTimeSlices )
+{
+  int const sliceSize = MpiWrapper::commSize( MPI_COMM_GEOSX );
+  int const numSlices = MpiWrapper::commSize( MPI_COMM_WORLD ) / sliceSize;
+  ASSERT_EQ( numSlices, 2 );
+  ASSERT_EQ( sliceSize, 1 );
+
+  // Enough iterations to reproduce the sequential run
+  string const xmlInput = buildXmlInput( numSlices, true );
+
+  // sequential reference: the pressure at the start of each step
+  std::vector< array1d< real64 > > reference;
+  {
+    GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+    setupProblemFromXML( state.getProblemManager(), buildXmlInput( numSlices, false ).c_str() );
+
+    SolverBase & solver = state.getProblemManager().getPhysicsSolverManager().getGroup< SolverBase >( "flow" );
+    DomainPartition & domain = state.getProblemManager().getDomainPartition();
+
+    real64 time = 0.0;
+    for( integer cycle = 0; cycle < numSteps; ++cycle )
+    {
+      reference.emplace_back( getPressure( domain ) );
+      solver.execute( time, fineDt, cycle, 0, 0.0, domain );
+      time += fineDt;
+    }
+  }
+
+  {
+    GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+    setupProblemFromXML( state.getProblemManager(), xmlInput.c_str() );
+    state.getProblemManager().runSimulation();
+  }
+
+  if( MpiWrapper::commRank( MPI_COMM_WORLD ) != 0 )
+  {
+    return;
+  }
+
+  // each time slice wrote its own file
+  for( integer slice = 0; slice < numSlices; ++slice )
+  {
+    string const sliceFile = joinPath( g_commandLineOptions.outputDirectory,
+                                       OutputBase::getTimeSliceDirectory( slice ),
+                                       string( timeHistoryFilename ) + ".hdf5" );
+    EXPECT_GT( H5Fis_hdf5( sliceFile.c_str() ), 0 ) << sliceFile;
+  }
+
+  // the merged file holds the history of the whole run, in the time order
+  string const mergedFile = joinPath( g_commandLineOptions.outputDirectory, string( timeHistoryFilename ) + ".hdf5" );
+  hid_t const fileId = H5Fopen( mergedFile.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT );
+  ASSERT_GE( fileId, 0 ) << mergedFile;
+
+  std::vector< hsize_t > timeDims;
+  std::vector< real64 > const times = readHistory( fileId, "pressure Time", timeDims );
+  ASSERT_EQ( timeDims.size(), 2u );
+  ASSERT_EQ( timeDims[0], static_cast< hsize_t >( numSteps ) );
+  for( integer step = 0; step < numSteps; ++step )
+  {
+    checkRelativeError( times[step], step * fineDt, 1e-12 );
+  }
+
+  std::vector< hsize_t > pressureDims;
+  std::vector< real64 > const pressure = readHistory( fileId, "pressure", pressureDims );
+  localIndex const numCells = reference[0].size();
+  ASSERT_EQ( pressureDims.size(), 2u );
+  ASSERT_EQ( pressureDims[0], static_cast< hsize_t >( numSteps ) );
+  ASSERT_EQ( pressureDims[1], static_cast< hsize_t >( numCells ) );
+
+  real64 maxPressure = 0.0;
+  for( integer step = 0; step < numSteps; ++step )
+  {
+    for( localIndex ei = 0; ei < numCells; ++ei )
+    {
+      maxPressure = LvArray::math::max( maxPressure, LvArray::math::abs( reference[step][ei] ) );
+    }
+  }
+  for( integer step = 0; step < numSteps; ++step )
+  {
+    for( localIndex ei = 0; ei < numCells; ++ei )
+    {
+      checkRelativeError( pressure[step * numCells + ei], reference[step][ei], 1e-10, 1e-10 * maxPressure );
+    }
+  }
+
+  H5Fclose( fileId );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
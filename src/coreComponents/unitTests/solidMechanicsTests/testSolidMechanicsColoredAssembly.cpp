@@ -0,0 +1,143 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "codingUtilities/UnitTestUtilities.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/solidMechanics/SolidMechanicsLagrangianFEM.hpp"
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace geosx;
+using namespace geosx::dataRepository;
+using namespace geosx::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+// A quasi-static elastic block, assembled with and without element coloring.
+char const * xmlInput =
+  "<Problem>\n"
+  "  <Solvers>\n"
+  "    <SolidMechanics_LagrangianFEM name=\"lagsolve\"\n"
+  "                                  timeIntegrationOption=\"QuasiStatic\"\n"
+  "                                  discretization=\"FE1\"\n"
+  "                                  targetRegions=\"{region}\"/>\n"
+  "  </Solvers>\n"
+  "  <Mesh>\n"
+  "    <InternalMesh name=\"mesh\"\n"
+  "                  elementTypes=\"{C3D8}\"\n"
+  "                  xCoords=\"{0, 1}\"\n"
+  "                  yCoords=\"{0, 1}\"\n"
+  "                  zCoords=\"{0, 1}\"\n"
+  "                  nx=\"{4}\"\n"
+  "                  ny=\"{3}\"\n"
+  "                  nz=\"{2}\"\n"
+  "                  cellBlockNames=\"{cb1}\"/>\n"
+  "  </Mesh>\n"
+  "  <NumericalMethods>\n"
+  "    <FiniteElements>\n"
+  "      <FiniteElementSpace name=\"FE1\" order=\"1\"/>\n"
+  "    </FiniteElements>\n"
+  "  </NumericalMethods>\n"
+  "  <ElementRegions>\n"
+  "    <CellElementRegion name=\"region\" cellBlocks=\"{cb1}\" materialList=\"{granite}\"/>\n"
+  "  </ElementRegions>\n"
+  "  <Constitutive>\n"
+  "    <ElasticIsotropic name=\"granite\"\n"
+  "                      defaultDensity=\"2700\"\n"
+  "                      defaultBulkModulus=\"5.5556e9\"\n"
+  "                      defaultShearModulus=\"4.16667e9\"/>\n"
+  "  </Constitutive>\n"
+  "</Problem>";
+
+TEST( SolidMechanicsColoredAssembly, coloredMatchesDefault )
+{
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  setupProblemFromXML( state.getProblemManager(), xmlInput );
+
+  SolidMechanicsLagrangianFEM & solver =
+    state.getProblemManager().getPhysicsSolverManager().getGroup< SolidMechanicsLagrangianFEM >( "lagsolve" );
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+
+  real64 const time = 0.0;
+  real64 const dt = 1.0;
+  solver.setupSystem( domain,
+                      solver.getDofManager(),
+                      solver.getLocalMatrix(),
+                      solver.getSystemRhs(),
+                      solver.getSystemSolution() );
+  solver.implicitStepSetup( time, dt, domain );
+
+  // a non-uniform displacement increment, so that the residual is not zero
+  NodeManager & nodeManager = domain.getMeshBody( 0 ).getMeshLevel( 0 ).getNodeManager();
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X = nodeManager.referencePosition();
+  arrayView2d< real64, nodes::TOTAL_DISPLACEMENT_USD > const u = nodeManager.totalDisplacement();
+  arrayView2d< real64, nodes::INCR_DISPLACEMENT_USD > const du = nodeManager.incrementalDisplacement();
+  forAll< serialPolicy >( nodeManager.size(), [=]( localIndex const a )
+  {
+    du( a, 0 ) = 1.0e-3 * X( a, 0 ) * X( a, 1 );
+    du( a, 1 ) = -2.0e-3 * X( a, 2 );
+    du( a, 2 ) = 1.0e-3 * X( a, 0 ) * X( a, 0 );
+    for( integer i = 0; i < 3; ++i )
+    {
+      u( a, i ) = du( a, i );
+    }
+  } );
+
+  CRSMatrix< real64, globalIndex > & jacobian = solver.getLocalMatrix();
+  array1d< real64 > residual( jacobian.numRows() );
+
+  // default assembly, with atomic updates
+  solver.assembleSystem( time, dt, domain, solver.getDofManager(), jacobian.toViewConstSizes(), residual.toView() );
+
+  jacobian.move( LvArray::MemorySpace::host );
+  residual.move( LvArray::MemorySpace::host, false );
+  CRSMatrix< real64, globalIndex > const jacobianDefault( jacobian );
+  array1d< real64 > const residualDefault( residual );
+
+  // colored assembly, one launch per color
+  solver.getReference< integer >( SolidMechanicsLagrangianFEM::viewKeyStruct::coloredAssemblyString() ) = 1;
+  solver.assembleSystem( time, dt, domain, solver.getDofManager(), jacobian.toViewConstSizes(), residual.toView() );
+
+  // the elements are colored by their nodes, which must have been possible on this mesh
+  ElementSubRegionBase const & subRegion =
+    domain.getMeshBody( 0 ).getMeshLevel( 0 ).getElemManager().getRegion( "region" ).getSubRegion( "cb1" );
+  EXPECT_GT( subRegion.getColorOffsets().size(), 0 );
+
+  // only the order of the additions differs
+  jacobian.move( LvArray::MemorySpace::host );
+  residual.move( LvArray::MemorySpace::host, false );
+  real64 maxResidual = 0.0;
+  for( localIndex i = 0; i < residual.size(); ++i )
+  {
+    maxResidual = LvArray::math::max( maxResidual, LvArray::math::abs( residualDefault[i] ) );
+  }
+  ASSERT_GT( maxResidual, 0.0 );
+  for( localIndex i = 0; i < residual.size(); ++i )
+  {
+    checkRelativeError( residual[i], residualDefault[i], 1e-12, 1e-12 * maxResidual );
+  }
+  compareLocalMatrices( jacobian.toViewConst(), jacobianDefault.toViewConst(), 1e-12 );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
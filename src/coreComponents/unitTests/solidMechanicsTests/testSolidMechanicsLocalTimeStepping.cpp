@@ -0,0 +1,155 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/solidMechanics/SolidMechanicsLagrangianFEM.hpp"
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace geosx;
+using namespace geosx::dataRepository;
+using namespace geosx::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+// The mesh is made of a coarse block (element size 1) and a fine block (element size 0.25 in x),
+// so that with dt = 2e-4 the coarse elements are stable at level 0 and the fine elements need level 2.
+// The left face is pulled with a displacement ramped in time.
+char const * xmlInput =
+  "<Problem>\n"
+  "  <Solvers>\n"
+  "    <SolidMechanics_LagrangianFEM name=\"lagsolve\"\n"
+  "                                  timeIntegrationOption=\"ExplicitDynamic\"\n"
+  "                                  cflFactor=\"0.5\"\n"
+  "                                  localTimeStepping=\"1\"\n"
+  "                                  maxLocalTimeStepLevel=\"4\"\n"
+  "                                  discretization=\"FE1\"\n"
+  "                                  targetRegions=\"{region}\"/>\n"
+  "  </Solvers>\n"
+  "  <Mesh>\n"
+  "    <InternalMesh name=\"mesh\"\n"
+  "                  elementTypes=\"{C3D8}\"\n"
+  "                  xCoords=\"{0, 4, 5}\"\n"
+  "                  yCoords=\"{0, 1}\"\n"
+  "                  zCoords=\"{0, 1}\"\n"
+  "                  nx=\"{4, 4}\"\n"
+  "                  ny=\"{1}\"\n"
+  "                  nz=\"{1}\"\n"
+  "                  cellBlockNames=\"{cb1}\"/>\n"
+  "  </Mesh>\n"
+  "  <NumericalMethods>\n"
+  "    <FiniteElements>\n"
+  "      <FiniteElementSpace name=\"FE1\" order=\"1\"/>\n"
+  "    </FiniteElements>\n"
+  "  </NumericalMethods>\n"
+  "  <ElementRegions>\n"
+  "    <CellElementRegion name=\"region\" cellBlocks=\"{cb1}\" materialList=\"{granite}\"/>\n"
+  "  </ElementRegions>\n"
+  "  <Constitutive>\n"
+  "    <ElasticIsotropic name=\"granite\"\n"
+  "                      defaultDensity=\"2700\"\n"
+  "                      defaultBulkModulus=\"5.5556e9\"\n"
+  "                      defaultShearModulus=\"4.16667e9\"/>\n"
+  "  </Constitutive>\n"
+  "  <Functions>\n"
+  "    <TableFunction name=\"ramp\"\n"
+  "                   inputVarNames=\"{time}\"\n"
+  "                   coordinates=\"{0.0, 4.0e-3}\"\n"
+  "                   values=\"{0.0, 1.0}\"/>\n"
+  "  </Functions>\n"
+  "  <FieldSpecifications>\n"
+  "    <FieldSpecification name=\"pull\"\n"
+  "                        objectPath=\"nodeManager\"\n"
+  "                        fieldName=\"TotalDisplacement\"\n"
+  "                        component=\"0\"\n"
+  "                        scale=\"-1.0e-4\"\n"
+  "                        functionName=\"ramp\"\n"
+  "                        setNames=\"{xneg}\"/>\n"
+  "  </FieldSpecifications>\n"
+  "</Problem>";
+
+real64 const coarseDt = 2.0e-4;
+integer const numCoarseSteps = 20;
+
+array2d< real64 > runExplicit( real64 const dt, integer const numSteps )
+{
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  setupProblemFromXML( state.getProblemManager(), xmlInput );
+
+  SolidMechanicsLagrangianFEM & solver =
+    state.getProblemManager().getPhysicsSolverManager().getGroup< SolidMechanicsLagrangianFEM >( "lagsolve" );
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+
+  real64 time = 0.0;
+  for( integer cycle = 0; cycle < numSteps; ++cycle )
+  {
+    solver.explicitStep( time, dt, cycle, domain );
+    time += dt;
+  }
+
+  NodeManager const & nodes = domain.getMeshBody( 0 ).getMeshLevel( 0 ).getNodeManager();
+  arrayView2d< real64 const, nodes::TOTAL_DISPLACEMENT_USD > const u = nodes.totalDisplacement();
+  u.move( LvArray::MemorySpace::host, false );
+
+  array2d< real64 > result( u.size( 0 ), 3 );
+  for( localIndex a = 0; a < u.size( 0 ); ++a )
+  {
+    for( integer i = 0; i < 3; ++i )
+    {
+      result( a, i ) = u( a, i );
+    }
+  }
+  return result;
+}
+
+TEST( SolidMechanicsLocalTimeStepping, multirateMatchesUniformFineStep )
+{
+  // multirate: coarse nodes at dt, fine nodes at dt/4
+  array2d< real64 > const uMultirate = runExplicit( coarseDt, numCoarseSteps );
+
+  // uniform: every element is stable at dt/4, so all the nodes are advanced at level 0
+  array2d< real64 > const uUniform = runExplicit( coarseDt / 4, 4 * numCoarseSteps );
+
+  ASSERT_EQ( uMultirate.size( 0 ), uUniform.size( 0 ) );
+
+  real64 diffNorm = 0.0;
+  real64 refNorm = 0.0;
+  for( localIndex a = 0; a < uUniform.size( 0 ); ++a )
+  {
+    for( integer i = 0; i < 3; ++i )
+    {
+      real64 const diff = uMultirate( a, i ) - uUniform( a, i );
+      diffNorm += diff * diff;
+      refNorm += uUniform( a, i ) * uUniform( a, i );
+    }
+  }
+  diffNorm = MpiWrapper::sum( diffNorm );
+  refNorm = MpiWrapper::sum( refNorm );
+
+  // the loading must have propagated, otherwise the comparison is meaningless
+  ASSERT_GT( refNorm, 0.0 );
+  EXPECT_LT( sqrt( diffNorm / refNorm ), 5.0e-2 );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}